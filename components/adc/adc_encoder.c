@@ -0,0 +1,306 @@
+/*
+ *
+ * (c) Wizmo 2023,
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ *
+ * Compressed encoding of the ADC stream
+ * - runs in its own task, fed by a ring buffer so that i2s_read is never blocked (if
+ *   the encoder can't keep up, input is dropped and counted)
+ * - FLAC (lossless) or Opus (48kHz family of rates only)
+ * - each encoded frame is handed to the owner's callback, FLAC headers are sent again
+ *   periodically so that receivers can join anytime
+ */
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/ringbuf.h"
+#include "esp_log.h"
+#include "esp_task.h"
+#include "esp_heap_caps.h"
+#include <FLAC/stream_encoder.h>
+#include <opus.h>
+#include "adc_encoder.h"
+#include "scheduler.h"
+
+#define ENCODER_STACK_SIZE			(16*1024)	// opus encoder is stack-hungry
+#define ENCODER_RING_MS				500			// how much audio can be buffered in front of encoder
+#define ENCODER_OPUS_MAX_PACKET		1275		// max opus packet (RFC6716)
+#define ENCODER_OPUS_COMPLEXITY		2
+#define ENCODER_FLAC_LEVEL			2
+#define ENCODER_FLAC_HEADER_MAX		128
+#define ENCODER_FLAC_HEADER_PERIOD	5000		// ms
+#define ENCODER_FLAC_FRAME_OVERHEAD	24			// frame header, subframe headers and CRC
+#define ENCODER_FLAC_MIN_BLOCKSIZE	16
+
+struct adc_encoder_s {
+	adc_fmt_t format;
+	uint32_t rate;
+	uint16_t channels;
+	size_t frames;				// frames per encoded packet
+	size_t frame_bytes;			// bytes of one packet worth of PCM
+	size_t max_packet;			// largest encoded packet owner accepts
+	RingbufHandle_t ring;
+	StaticRingbuffer_t *ring_struct;
+	uint8_t *ring_storage;
+	int16_t *pcm;
+	size_t fill;
+	union {
+		OpusEncoder *opus;
+		FLAC__StreamEncoder *flac;
+	};
+	FLAC__int32 *flac_pcm;
+	uint8_t *out;
+	struct {
+		uint8_t data[ENCODER_FLAC_HEADER_MAX];
+		size_t len;
+		TickType_t sent;
+	} header;
+	adc_encoder_cb_t out_cb;
+	void *owner;
+	bool running;
+	uint32_t dropped;
+	TaskHandle_t task, joiner;
+	StaticTask_t *xTaskBuffer;
+	StackType_t *xStack;
+};
+
+static const char TAG[] = "adc_encoder";
+
+static void encoder_thread(void *arg);
+
+/*----------------------------------------------------------------------------*/
+static FLAC__StreamEncoderWriteStatus flac_write_cb(const FLAC__StreamEncoder *encoder, const FLAC__byte buffer[], size_t bytes,
+													uint32_t samples, uint32_t current_frame, void *client_data) {
+	struct adc_encoder_s *enc = (struct adc_encoder_s*) client_data;
+
+	// metadata blocks are written at init, keep them to re-send periodically
+	if (!samples) {
+		if (enc->header.len + bytes <= ENCODER_FLAC_HEADER_MAX) {
+			memcpy(enc->header.data + enc->header.len, buffer, bytes);
+			enc->header.len += bytes;
+		} else {
+			ESP_LOGW(TAG, "FLAC header too large %u", enc->header.len + bytes);
+		}
+		return FLAC__STREAM_ENCODER_WRITE_STATUS_OK;
+	}
+
+	if (xTaskGetTickCount() - enc->header.sent > pdMS_TO_TICKS(ENCODER_FLAC_HEADER_PERIOD)) {
+		enc->out_cb(enc->owner, enc->header.data, enc->header.len, 0);
+		enc->header.sent = xTaskGetTickCount();
+	}
+
+	enc->out_cb(enc->owner, buffer, bytes, samples);
+	return FLAC__STREAM_ENCODER_WRITE_STATUS_OK;
+}
+
+/*----------------------------------------------------------------------------*/
+static bool flac_init(struct adc_encoder_s *enc) {
+	enc->flac = FLAC__stream_encoder_new();
+	enc->flac_pcm = malloc(enc->frames * enc->channels * sizeof(FLAC__int32));
+	if (!enc->flac || !enc->flac_pcm) return false;
+
+	FLAC__stream_encoder_set_verify(enc->flac, false);
+	FLAC__stream_encoder_set_channels(enc->flac, enc->channels);
+	FLAC__stream_encoder_set_bits_per_sample(enc->flac, 16);
+	FLAC__stream_encoder_set_sample_rate(enc->flac, enc->rate);
+	FLAC__stream_encoder_set_compression_level(enc->flac, ENCODER_FLAC_LEVEL);
+	FLAC__stream_encoder_set_blocksize(enc->flac, enc->frames);
+
+	// header will be sent with first frame
+	enc->header.sent = xTaskGetTickCount() - pdMS_TO_TICKS(ENCODER_FLAC_HEADER_PERIOD) - 1;
+
+	FLAC__StreamEncoderInitStatus status = FLAC__stream_encoder_init_stream(enc->flac, flac_write_cb, NULL, NULL, NULL, enc);
+	if (status != FLAC__STREAM_ENCODER_INIT_STATUS_OK) {
+		ESP_LOGE(TAG, "FLAC encoder init failed %d", status);
+		return false;
+	}
+
+	return true;
+}
+
+/*----------------------------------------------------------------------------*/
+static bool opus_init(struct adc_encoder_s *enc, uint32_t bitrate) {
+	int err;
+
+	enc->opus = opus_encoder_create(enc->rate, enc->channels, OPUS_APPLICATION_AUDIO, &err);
+	enc->out = malloc(ENCODER_OPUS_MAX_PACKET);
+	if (!enc->opus || !enc->out) {
+		ESP_LOGE(TAG, "Opus encoder creation failed %d (rate must be 8/12/16/24/48 kHz)", err);
+		return false;
+	}
+
+	if (bitrate) opus_encoder_ctl(enc->opus, OPUS_SET_BITRATE(bitrate));
+	opus_encoder_ctl(enc->opus, OPUS_SET_COMPLEXITY(ENCODER_OPUS_COMPLEXITY));
+
+	return true;
+}
+
+/*----------------------------------------------------------------------------*/
+struct adc_encoder_s* adc_encoder_create(adc_fmt_t format, uint32_t rate, uint16_t channels, uint16_t frame_ms,
+										 uint32_t bitrate, size_t max_packet, adc_encoder_cb_t out_cb, void *owner) {
+	struct adc_encoder_s *enc = calloc(1, sizeof(struct adc_encoder_s));
+	if (!enc) return NULL;
+
+	enc->format = format;
+	enc->rate = rate;
+	enc->channels = channels;
+	enc->out_cb = out_cb;
+	enc->owner = owner;
+
+	// opus only accepts 2.5, 5, 10, 20, 40 or 60 ms frames
+	if (format == ADC_FMT_OPUS && frame_ms != 5 && frame_ms != 10 && frame_ms != 20 && frame_ms != 40 && frame_ms != 60) {
+		ESP_LOGW(TAG, "invalid Opus frame %ums, using 20ms", frame_ms);
+		frame_ms = 20;
+	}
+
+	enc->frames = rate * frame_ms / 1000;
+
+	/* encoded frames must fit in max_packet. Opus is told so, but FLAC worst case is a 
+	 verbatim frame so its blocksize has to be capped */
+	if (format == ADC_FMT_FLAC) {
+		size_t frames = max_packet > ENCODER_FLAC_FRAME_OVERHEAD ? (max_packet - ENCODER_FLAC_FRAME_OVERHEAD) / (channels * sizeof(int16_t)) : 0;
+		if (frames < ENCODER_FLAC_MIN_BLOCKSIZE || max_packet < ENCODER_FLAC_HEADER_MAX || enc->frames < ENCODER_FLAC_MIN_BLOCKSIZE) {
+			ESP_LOGE(TAG, "FLAC frame of %ums can't fit in %u bytes", frame_ms, max_packet);
+			free(enc);
+			return NULL;
+		}
+		if (enc->frames > frames) {
+			ESP_LOGW(TAG, "FLAC frame of %ums does not fit in %u bytes, using %u frames", frame_ms, max_packet, frames);
+			enc->frames = frames;
+		}
+		enc->max_packet = max_packet;
+	} else {
+		enc->max_packet = max_packet < ENCODER_OPUS_MAX_PACKET ? max_packet : ENCODER_OPUS_MAX_PACKET;
+	}
+
+	enc->frame_bytes = enc->frames * channels * sizeof(int16_t);
+	enc->pcm = malloc(enc->frame_bytes);
+
+	// PCM ring buffer lives in PSRAM
+	size_t ring_size = ((rate * ENCODER_RING_MS / 1000) * channels * sizeof(int16_t) + 3) & ~3;
+	enc->ring_struct = heap_caps_malloc(sizeof(StaticRingbuffer_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	enc->ring_storage = heap_caps_malloc(ring_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+	if (enc->ring_struct && enc->ring_storage) {
+		enc->ring = xRingbufferCreateStatic(ring_size, RINGBUF_TYPE_BYTEBUF, enc->ring_storage, enc->ring_struct);
+	}
+
+	bool ok = enc->pcm && enc->ring;
+	if (ok && format == ADC_FMT_FLAC) ok = flac_init(enc);
+	else if (ok && format == ADC_FMT_OPUS) ok = opus_init(enc, bitrate);
+	else ok = false;
+
+	if (ok) {
+		enc->xTaskBuffer = (StaticTask_t*) heap_caps_malloc(sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+		enc->xStack = (StackType_t*) malloc(ENCODER_STACK_SIZE);
+		ok = enc->xTaskBuffer && enc->xStack;
+	}
+
+	if (!ok) {
+		ESP_LOGE(TAG, "can't create encoder fmt:%u rate:%u channels:%u", format, rate, channels);
+		if (format == ADC_FMT_FLAC && enc->flac) FLAC__stream_encoder_delete(enc->flac);
+		else if (format == ADC_FMT_OPUS && enc->opus) opus_encoder_destroy(enc->opus);
+		if (enc->ring) vRingbufferDelete(enc->ring);
+		free(enc->ring_struct);
+		free(enc->ring_storage);
+		free(enc->xTaskBuffer);
+		free(enc->xStack);
+		free(enc->flac_pcm);
+		free(enc->out);
+		free(enc->pcm);
+		free(enc);
+		return NULL;
+	}
+
+	sched_profile_t sched;
+	sched_get("ADC_enc", &sched);
+	enc->running = true;
+	enc->task = xTaskCreateStaticPinnedToCore( (TaskFunction_t) encoder_thread, "ADC_enc", ENCODER_STACK_SIZE, enc,
+											   sched.priority, enc->xStack, enc->xTaskBuffer, sched.core);
+
+	ESP_LOGI(TAG, "%s encoder rate:%u channels:%u frames:%u bitrate:%u", format == ADC_FMT_FLAC ? "FLAC" : "Opus",
+			 rate, channels, enc->frames, bitrate);
+
+	return enc;
+}
+
+/*----------------------------------------------------------------------------*/
+void adc_encoder_delete(struct adc_encoder_s *enc) {
+	if (!enc) return;
+
+	enc->joiner = xTaskGetCurrentTaskHandle();
+	enc->running = false;
+	ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+	vTaskDelete(enc->task);
+
+	if (enc->format == ADC_FMT_FLAC) {
+		FLAC__stream_encoder_finish(enc->flac);
+		FLAC__stream_encoder_delete(enc->flac);
+	} else {
+		opus_encoder_destroy(enc->opus);
+	}
+
+	vRingbufferDelete(enc->ring);
+	free(enc->ring_storage);
+	free(enc->ring_struct);
+
+	free(enc->xTaskBuffer);
+	free(enc->xStack);
+	free(enc->flac_pcm);
+	free(enc->out);
+	free(enc->pcm);
+	free(enc);
+}
+
+/*----------------------------------------------------------------------------
+   Never blocks, samples are dropped if encoder can't keep up
+*/
+bool adc_encoder_feed(struct adc_encoder_s *enc, const int16_t *samples, size_t bytes) {
+	if (xRingbufferSend(enc->ring, samples, bytes, 0) == pdTRUE) return true;
+	enc->dropped += bytes;
+	return false;
+}
+
+/*----------------------------------------------------------------------------*/
+uint32_t adc_encoder_dropped(struct adc_encoder_s *enc) {
+	return enc ? enc->dropped : 0;
+}
+
+/*----------------------------------------------------------------------------*/
+static void encoder_thread(void *arg) {
+	struct adc_encoder_s *enc = (struct adc_encoder_s*) arg;
+
+	while (enc->running) {
+		size_t size;
+		uint8_t *data = xRingbufferReceiveUpTo(enc->ring, &size, pdMS_TO_TICKS(100), enc->frame_bytes - enc->fill);
+
+		if (!data) continue;
+
+		memcpy((uint8_t*) enc->pcm + enc->fill, data, size);
+		vRingbufferReturnItem(enc->ring, data);
+		enc->fill += size;
+
+		// wait till we have a full frame
+		if (enc->fill < enc->frame_bytes) continue;
+		enc->fill = 0;
+
+		if (enc->format == ADC_FMT_FLAC) {
+			// output is done in write callback
+			for (int i = enc->frames * enc->channels; --i >= 0;) enc->flac_pcm[i] = enc->pcm[i];
+			if (!FLAC__stream_encoder_process_interleaved(enc->flac, enc->flac_pcm, enc->frames)) {
+				ESP_LOGE(TAG, "FLAC encoding error %d", FLAC__stream_encoder_get_state(enc->flac));
+			}
+		} else {
+			opus_int32 len = opus_encode(enc->opus, enc->pcm, enc->frames, enc->out, enc->max_packet);
+			if (len > 0) enc->out_cb(enc->owner, enc->out, len, enc->frames);
+			else ESP_LOGE(TAG, "Opus encoding error %d", len);
+		}
+	}
+
+	xTaskNotifyGive(enc->joiner);
+	vTaskSuspend(NULL);
+}
@@ -0,0 +1,24 @@
+/*
+ *  (c) Wizmo 2023
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "input_i2s.h"
+
+/* called from encoder task for each encoded packet, frames is 0 for codec headers */
+typedef void (*adc_encoder_cb_t)(void *owner, const uint8_t *data, size_t len, uint32_t frames);
+
+/* encoded packets never exceed max_packet, FLAC frames are shortened when needed */
+struct adc_encoder_s* adc_encoder_create(adc_fmt_t format, uint32_t rate, uint16_t channels, uint16_t frame_ms,
+										 uint32_t bitrate, size_t max_packet, adc_encoder_cb_t out_cb, void *owner);
+void				  adc_encoder_delete(struct adc_encoder_s *enc);
+bool				  adc_encoder_feed(struct adc_encoder_s *enc, const int16_t *samples, size_t bytes);
+uint32_t			  adc_encoder_dropped(struct adc_encoder_s *enc);
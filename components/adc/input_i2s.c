@@ -7,7 +7,8 @@
  *
  * Initalizes i2s input for loopback or streaming
  * - if host and port is provided, streaming will start on boot
- * - fmt specifies streaming format.  currently RAW or WAVE @16khz single channel.  
+ * - fmt specifies streaming format.  currently RAW or WAVE @16khz single channel or RTP/L16 (MTU-sized packets)
+ *   or FLAC/Opus over RTP (encoded in separate task, see adc_encoder.c)
  * - if i2s ws etc is porvided, will create new adac on channel 1, otherwise will use existing adac (and its i2c port if applicable).
  *     adac init should configure input stream and mixer (and will define mic /line-in config).  lineinon and lineinoff added as commands.
  * - if i2s and i2c is provided, will create port, otherwise use i2c_config 
@@ -31,10 +32,13 @@
 #include "mbedtls/net_sockets.h"
 #include "platform_config.h"
 #include "adac.h"
+#include "adc_encoder.h"
+#include "scheduler.h"
 
 #include "lwip/err.h"
 #include "lwip/sockets.h"
 #include "lwip/sys.h"
+#include "esp_system.h"
 
 #define ADC_SAMPLE_RATE_HZ              16000 // default, use 16000 for Rhasspy / OpenWakeWord (OWW)
 #define ADC_STREAM_FRAME_SIZE			2048 // Use 2048 for OWW (in bytes)  
@@ -48,6 +52,15 @@
 
 #define ADC_STACK_SIZE 	(4*1024)
 
+#define RTP_HEADER_SIZE					12
+#define RTP_MAX_PAYLOAD					(1500 - 20 - 8 - RTP_HEADER_SIZE) // fit in Ethernet/WiFi MTU (no IP fragmentation)
+#define RTP_DEFAULT_PTIME				20	// ms of audio per packet (capped by MTU)
+#define RTP_PT_L16_STEREO				10	// static payload types (RFC3551), only valid at 44.1kHz
+#define RTP_PT_L16_MONO					11
+#define RTP_PT_DYNAMIC					96
+#define RTP_OPUS_CLOCK					48000	// Opus RTP timestamps always use 48kHz clock (RFC7587)
+#define ADC_DEFAULT_FRAME_MS			20		// ms of audio per encoded frame
+
 #define SAFE_PTR_FREE(P)							\
 	do {											\
 		TimerHandle_t timer = xTimerCreate("cleanup", pdMS_TO_TICKS(10000), pdFALSE, P, _delayed_free);	\
@@ -67,6 +80,7 @@ typedef struct adc_ctx_s {
 	uint16_t channels;		// stream output channels
 	adc_fmt_t format;		// stream format (currently raw and wav chunks.  TODO:  mp3/flac streams)
 	int sock;               // stream socket
+	struct sockaddr_in dest_addr;
 	
 	bool running; 			// thread running
 	bool pause;				// stop i2s read
@@ -82,6 +96,17 @@ typedef struct adc_ctx_s {
 	int16_t *input_buff;	
 	int16_t *stream_buff;
 	size_t bytes_read;		
+	struct {
+		uint16_t ptime;		// ms of audio per packet
+		uint8_t *packet;	// header + payload
+		size_t size, fill;	// payload size and current fill (bytes)
+		uint16_t seq;
+		uint32_t timestamp, ssrc;
+		uint32_t sent, errors;
+	} rtp;
+	struct adc_encoder_s *encoder;
+	uint16_t frame_ms;		// encoded frame duration
+	uint32_t bitrate;		// Opus target bitrate (0 is codec's default)
 	adc_cmd_cb_t	cmd_cb;
 	adc_data_cb_t	data_cb;
 	void *owner;
@@ -116,6 +141,11 @@ struct adc_ctx_s *adc_create(adc_cmd_cb_t cmd_cb, adc_data_cb_t data_cb) {
 	ctx->channels = ADC_CHANNELS_OUT;
 	PARSE_PARAM(config, "ch",'=', ctx->channels);
 	PARSE_PARAM(config, "fmt", '=', ctx->format);
+	ctx->rtp.ptime = RTP_DEFAULT_PTIME;
+	PARSE_PARAM(config, "ptime", '=', ctx->rtp.ptime);
+	ctx->frame_ms = ADC_DEFAULT_FRAME_MS;
+	PARSE_PARAM(config, "frame", '=', ctx->frame_ms);
+	PARSE_PARAM(config, "bitrate", '=', ctx->bitrate);
 	free(config);
 
 	config = config_alloc_get_str("adc_config", NULL, CONFIG_ADC_CONFIG);
@@ -226,15 +256,19 @@ struct adc_ctx_s *adc_create(adc_cmd_cb_t cmd_cb, adc_data_cb_t data_cb) {
 		ctx->sock = sock;
 		ctx->stream = true;
 	
-		ESP_LOGI(TAG, "Configured ADC stream to %s:%d fmt:%s", host, ctx->port, ctx->format?"WAVE":"RAW");
+		const char *fmt = ctx->format == ADC_FMT_RTP ? "RTP" : ctx->format == ADC_FMT_FLAC ? "FLAC" :
+						  ctx->format == ADC_FMT_OPUS ? "OPUS" : ctx->format ? "WAVE" : "RAW";
+		ESP_LOGI(TAG, "Configured ADC stream to %s:%d fmt:%s", host, ctx->port, fmt);
 	}
 
 	ctx->running = true;
 	ctx->cmd_cb(ADC_SETUP, ctx->sample_rate); 
 
+	sched_profile_t sched;
+	sched_get("ADC", &sched);
     ctx->xTaskBuffer = (StaticTask_t*) heap_caps_malloc(sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
 	ctx->thread = xTaskCreateStaticPinnedToCore( (TaskFunction_t) adc_thread, "ADC", ADC_STACK_SIZE, ctx, 
-												 ESP_TASK_PRIO_MIN + 2, ctx->xStack, ctx->xTaskBuffer, CONFIG_PTHREAD_TASK_CORE_DEFAULT);
+												 sched.priority, ctx->xStack, ctx->xTaskBuffer, sched.core);
 
 	return ctx;
 }
@@ -360,6 +394,107 @@ static uint16_t encode_wav_data(int16_t* dst, int16_t* src, uint32_t offset, siz
 	return p*s;
 }
 
+/*----------------------------------------------------------------------------
+   Prepares RTP/L16 packet, header is built once and only sequence number and
+   timestamp are updated for each packet. Packet size is set by ptime but always
+   fits in MTU so there is no IP fragmentation. For compressed formats, encoder
+   is given the same limit and shortens FLAC frames (worst case is verbatim)
+*/
+static bool rtp_init(adc_ctx_t *ctx) {
+	size_t frame_size = ctx->channels * sizeof(int16_t);
+
+	if (ctx->format == ADC_FMT_RTP) {
+		ctx->rtp.size = (ctx->sample_rate * ctx->rtp.ptime / 1000) * frame_size;
+		if (ctx->rtp.size > RTP_MAX_PAYLOAD || !ctx->rtp.size) ctx->rtp.size = (RTP_MAX_PAYLOAD / frame_size) * frame_size;
+	} else {
+		ctx->rtp.size = RTP_MAX_PAYLOAD;
+	}
+
+	ctx->rtp.packet = malloc(RTP_HEADER_SIZE + ctx->rtp.size);
+	if (!ctx->rtp.packet) return false;
+
+	ctx->rtp.fill = 0;
+	ctx->rtp.seq = esp_random();
+	ctx->rtp.timestamp = esp_random();
+	ctx->rtp.ssrc = esp_random();
+
+	uint8_t pt = RTP_PT_DYNAMIC;
+	if (ctx->format == ADC_FMT_RTP && ctx->sample_rate == 44100) pt = ctx->channels == 2 ? RTP_PT_L16_STEREO : RTP_PT_L16_MONO;
+
+	// V=2, no padding, no extension, no CSRC, no marker
+	ctx->rtp.packet[0] = 0x80;
+	ctx->rtp.packet[1] = pt;
+	*(uint32_t*) (ctx->rtp.packet + 8) = htonl(ctx->rtp.ssrc);
+
+	if (ctx->format == ADC_FMT_RTP) {
+		ESP_LOGI(TAG, "RTP/L16 stream pt:%u, %u bytes per packet (%ums)", pt, ctx->rtp.size, 
+				 ctx->rtp.size * 1000 / (ctx->sample_rate * frame_size));
+	} else {
+		ESP_LOGI(TAG, "RTP/%s stream pt:%u, up to %u bytes per packet", ctx->format == ADC_FMT_FLAC ? "FLAC" : "Opus", pt, ctx->rtp.size);
+	}
+
+	return true;
+}
+
+/*----------------------------------------------------------------------------
+   Sends packet with current sequence number and timestamp then advances them
+*/
+static void rtp_emit(adc_ctx_t *ctx, size_t len, uint32_t frames) {
+	*(uint16_t*) (ctx->rtp.packet + 2) = htons(ctx->rtp.seq++);
+	*(uint32_t*) (ctx->rtp.packet + 4) = htonl(ctx->rtp.timestamp);
+	ctx->rtp.timestamp += frames;
+
+	if (sendto(ctx->sock, ctx->rtp.packet, RTP_HEADER_SIZE + len, 0, (struct sockaddr *) &ctx->dest_addr, sizeof(ctx->dest_addr)) < 0) {
+		// packets are lost, but sequence/timestamp let receiver conceal them
+		if (ctx->rtp.errors++ % 100 == 0) ESP_LOGW(TAG, "RTP send errors %u/%u (errno %d)", ctx->rtp.errors, ctx->rtp.sent, errno);
+	} else {
+		ctx->rtp.sent++;
+	}
+}
+
+/*----------------------------------------------------------------------------
+   Called from encoder task for each compressed frame (or FLAC header when frames
+   is 0, sent with the timestamp of next frame)
+*/
+static void rtp_encoded(void *owner, const uint8_t *data, size_t len, uint32_t frames) {
+	adc_ctx_t *ctx = (adc_ctx_t*) owner;
+
+	if (!ctx->stream) return;
+
+	if (len > ctx->rtp.size) {
+		ESP_LOGW(TAG, "encoded frame too large %u (max %u)", len, ctx->rtp.size);
+		ctx->rtp.errors++;
+		return;
+	}
+	
+	memcpy(ctx->rtp.packet + RTP_HEADER_SIZE, data, len);
+	if (ctx->format == ADC_FMT_OPUS) frames = frames * (RTP_OPUS_CLOCK / ctx->sample_rate);
+	rtp_emit(ctx, len, frames);
+}
+
+/*----------------------------------------------------------------------------
+   Converts interleaved stereo input to big-endian L16 with output channels and
+   sends packets as soon as they are full
+*/
+static void rtp_send(adc_ctx_t *ctx, int16_t *src, size_t samples) {
+	for (size_t i = 0; i < samples; i += ADC_CHANNELS_IN) {
+		uint16_t *dst = (uint16_t*) (ctx->rtp.packet + RTP_HEADER_SIZE + ctx->rtp.fill);
+
+		if (ctx->channels == ADC_CHANNELS_IN) {
+			dst[0] = htons(src[i]);
+			dst[1] = htons(src[i+1]);
+		} else {
+			dst[0] = htons((src[i] / 2) + (src[i+1] / 2));
+		}
+		ctx->rtp.fill += ctx->channels * sizeof(int16_t);
+
+		if (ctx->rtp.fill < ctx->rtp.size) continue;
+
+		ctx->rtp.fill = 0;
+		rtp_emit(ctx, ctx->rtp.size, ctx->rtp.size / (ctx->channels * sizeof(int16_t)));
+	}
+}
+
 /*----------------------------------------------------------------------------*/
 static void adc_thread(void *arg) {
 	// THIS IS THE ORIGIONAL CODE
@@ -385,7 +520,19 @@ static void adc_thread(void *arg) {
 	
 	int stream_byte_ptr = 0; 
 	size_t header_size = 0;
-	if (ctx->format == ADC_FMT_WAV) { 
+	if (ctx->format == ADC_FMT_RTP) {
+		if (!rtp_init(ctx)) {
+			ESP_LOGE(TAG, "RTP packet Memory Allocation Failed!");
+			ctx->stream = false;
+		}
+	} else if (ctx->format == ADC_FMT_FLAC || ctx->format == ADC_FMT_OPUS) {
+		// encoder runs in its own task so that i2s_read is never delayed by compression
+		if (!rtp_init(ctx) || (ctx->encoder = adc_encoder_create(ctx->format, ctx->sample_rate, ctx->channels, ctx->frame_ms, 
+																 ctx->bitrate, ctx->rtp.size, rtp_encoded, ctx)) == NULL) {
+			ESP_LOGE(TAG, "Can't create %s encoder", ctx->format == ADC_FMT_FLAC ? "FLAC" : "Opus");
+			ctx->stream = false;
+		}
+	} else if (ctx->format == ADC_FMT_WAV) { 
 		stream_byte_ptr = generate_wav_header(buf_ptr_stream, stream_size_bytes, ctx->sample_rate, ctx->channels);
 		header_size = (size_t)stream_byte_ptr;
 	}
@@ -394,6 +541,7 @@ static void adc_thread(void *arg) {
 	dest_addr.sin_addr.s_addr = ctx->host;
     dest_addr.sin_family = AF_INET;
     dest_addr.sin_port = htons(ctx->port); 
+	ctx->dest_addr = dest_addr;
 	
 	ESP_LOGI(TAG, "Initialized ADC stream: rate:%u (%ums), channels:%u bytes:%u" , ctx->sample_rate, buffer_size * 1000 / (ctx->sample_rate * ADC_CHANNELS_IN), ctx->channels, stream_size_bytes);
 
@@ -410,7 +558,17 @@ static void adc_thread(void *arg) {
 				//ESP_LOGD(TAG, "Sent Bytes %d to DAC",ctx->bytes_read);
 			}
 
-			if (ctx->sock && ctx->stream && ctx->bytes_read == buffer_size_bytes)
+			if (ctx->sock && ctx->stream && ctx->format == ADC_FMT_RTP) 
+			{
+				rtp_send(ctx, ctx->input_buff, ctx->bytes_read / sizeof(int16_t));
+			} 
+			else if (ctx->sock && ctx->stream && ctx->encoder)
+			{
+				// only downmix here, encoding is done by encoder task (never blocks)
+				size_t bytes = encode_wav_data(ctx->stream_buff, ctx->input_buff, 0, ctx->bytes_read / sizeof(int16_t), ctx->channels);
+				adc_encoder_feed(ctx->encoder, ctx->stream_buff, bytes);
+			}
+			else if (ctx->sock && ctx->stream && ctx->bytes_read == buffer_size_bytes)
 			{
             	stream_byte_ptr = encode_wav_data(ctx->stream_buff, ctx->input_buff, (size_t)stream_byte_ptr, buffer_size, ctx->channels);
 				
@@ -433,7 +591,12 @@ static void adc_thread(void *arg) {
         }
 	}
 	
+	if (ctx->encoder) {
+		ESP_LOGI(TAG, "encoder dropped %u bytes", adc_encoder_dropped(ctx->encoder));
+		adc_encoder_delete(ctx->encoder);
+	}
 	if (ctx->sock != -1) closesocket(ctx->sock);
+	free(ctx->rtp.packet);
 
 	xTaskNotifyGive(ctx->joiner);
 	vTaskSuspend(NULL);
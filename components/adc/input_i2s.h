@@ -10,7 +10,7 @@
 
 #include "adc_sink.h"
 
-typedef enum { 	ADC_FMT_RAW, ADC_FMT_WAV, ADC_FMT_WYOMING, ADC_FMT_MP3, ADC_FMT_FLAC } adc_fmt_t ; 
+typedef enum { 	ADC_FMT_RAW, ADC_FMT_WAV, ADC_FMT_WYOMING, ADC_FMT_MP3, ADC_FMT_FLAC, ADC_FMT_RTP, ADC_FMT_OPUS } adc_fmt_t ; 
 
 struct adc_ctx_s* adc_create(adc_cmd_cb_t cmd_cb, adc_data_cb_t data_cb);
 void  		  adc_delete(struct adc_ctx_s *ctx);
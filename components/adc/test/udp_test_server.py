@@ -4,6 +4,8 @@ import wave
 import pyaudio
 import numpy as np
 import time
+import sys
+import struct
 
 
 localIP     = "0.0.0.0"
@@ -24,8 +26,11 @@ print("bind ", localIP, localPort)
 
 player = pyaudio.PyAudio()
 address = ""
-rate = 16000
-channels = 1
+# RTP/L16 with dynamic payload type does not carry format, use command line (rate channels)
+rate = int(sys.argv[1]) if len(sys.argv) > 1 else 16000
+channels = int(sys.argv[2]) if len(sys.argv) > 2 else 1
+rtp_seq = None
+rtp_lost = 0
 i = 0
 stream = player.open(format = 8, channels = channels, rate = rate, output = True)
 
@@ -85,6 +90,32 @@ while(True):
             i+=1
             data = audio.readframes(RHASSPY_FRAMES)
             
+    elif bytesReceived > 12 and (message[0] & 0xc0) == 0x80:
+        # RTP/L16: 12 bytes header then big-endian samples
+        pt = message[1] & 0x7f
+        seq, timestamp, ssrc = struct.unpack("!HII", message[2:12])
+        if rtp_seq is not None and seq != (rtp_seq + 1) & 0xffff:
+            rtp_lost += (seq - rtp_seq - 1) & 0xffff
+        rtp_seq = seq
+
+        rtp_rate, rtp_ch = (44100, 2 if pt == 10 else 1) if pt in (10, 11) else (rate, channels)
+        if address != addr or rtp_rate != rate or rtp_ch != channels:
+            address = addr
+            print ("RTP client IP Address:{} pt:{} ssrc:{:08x}".format(address, pt, ssrc))
+            print
+            stream.close()
+            rate = rtp_rate
+            channels = rtp_ch
+            stream = player.open(format = 8, channels = channels, rate = rate, output = True)
+
+        int_data = np.frombuffer(message[12:], dtype='>i2').astype(np.int16)
+        volume = np.average(np.abs(int_data))
+        percent = min(BAR_SIZE, int(BAR_SIZE * volume / BAR_MAX))
+        sampleData = "[{}{}]".format('#' * percent, '_' * (BAR_SIZE-percent))
+        print(flow + "RTP seq:{} ts:{} lost:{},{} ({}B,{}Bps)".format(seq, timestamp, rtp_lost, sampleData, bytesReceived, bps))
+        stream.write(int_data.tobytes())
+        i+=1
+
     else:
         sampleData =  ":".join("{:02x}".format(c) for c in message[:40])
         print(flow + "{}-({}) {} ({}) ".format(i, bytesReceived, sampleData, bps))
@@ -214,36 +214,33 @@ void GDS_DrawBitmapCBR(struct GDS_Device* Device, uint8_t *Data, int Width, int
 			}	
 		}
 	} else if (Device->Depth == 4)	{
-		uint8_t *optr = Device->Framebuffer;
 		int LineLen = Device->Width >> 1;
 		
 		Height >>= 3;
 		Color &= 0x0f;
 		
-		for (int i = Width * Height, r = 0, c = 0; --i >= 0;) {
-			uint8_t Byte = BitReverseTable256[*Data++];
-			// we need to linearize code to let compiler better optimize
-			if (c & 0x01) {
-				*optr = (*optr & 0x0f) | (((Byte & 0x01)*Color)<<4); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0x0f) | (((Byte & 0x01)*Color)<<4); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0x0f) | (((Byte & 0x01)*Color)<<4); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0x0f) | (((Byte & 0x01)*Color)<<4); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0x0f) | (((Byte & 0x01)*Color)<<4); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0x0f) | (((Byte & 0x01)*Color)<<4); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0x0f) | (((Byte & 0x01)*Color)<<4); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0x0f) | (((Byte & 0x01)*Color)<<4); optr += LineLen; 
-			} else {
-				*optr = (*optr & 0xf0) | (((Byte & 0x01)*Color)); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0xf0) | (((Byte & 0x01)*Color)); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0xf0) | (((Byte & 0x01)*Color)); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0xf0) | (((Byte & 0x01)*Color)); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0xf0) | (((Byte & 0x01)*Color)); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0xf0) | (((Byte & 0x01)*Color)); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0xf0) | (((Byte & 0x01)*Color)); optr += LineLen; Byte >>= 1;
-				*optr = (*optr & 0xf0) | (((Byte & 0x01)*Color)); optr += LineLen;
+		// process columns by pairs so that each framebuffer byte is written once, no read-modify-write
+		for (int c = 0; c < Width; c += 2) {
+			uint8_t *optr = Device->Framebuffer + (c >> 1);
+			uint8_t *Left = Data + c * Height, *Right = Left + Height;
+			// odd width, last column is alone so preserve other nibble
+			uint8_t Mask = c + 1 < Width ? 0x00 : 0xf0;
+			
+			for (int r = Height; --r >= 0;) {
+				uint8_t L = BitReverseTable256[*Left++], R = Mask ? 0 : BitReverseTable256[*Right++];
+				
+				// we need to linearize code to let compiler better optimize
+				#define SET4(O) *O = (*O & Mask) | ((L & 0x01) * Color) | (((R & 0x01) * Color) << 4)
+				SET4(optr); optr += LineLen; L >>= 1; R >>= 1;
+				SET4(optr); optr += LineLen; L >>= 1; R >>= 1;
+				SET4(optr); optr += LineLen; L >>= 1; R >>= 1;
+				SET4(optr); optr += LineLen; L >>= 1; R >>= 1;
+				SET4(optr); optr += LineLen; L >>= 1; R >>= 1;
+				SET4(optr); optr += LineLen; L >>= 1; R >>= 1;
+				SET4(optr); optr += LineLen; L >>= 1; R >>= 1;
+				SET4(optr); optr += LineLen;
+				#undef SET4
 			}	
-			// end of a column, move to next one
-			if (++r == Height) { c++; r = 0; optr = Device->Framebuffer + (c >> 1); }		
 		}
 	} else if (Device->Depth == 8) {
 		uint8_t *optr = Device->Framebuffer;
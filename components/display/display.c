@@ -16,6 +16,7 @@
 #include "tools.h"
 #include "display.h"
 #include "services.h"
+#include "scheduler.h"
 #include "gds.h"
 #include "gds_default_if.h"
 #include "gds_draw.h"
@@ -162,7 +163,9 @@ void display_init(char *welcome) {
 		displayer.by = 2;
 		displayer.pause = 3600;
 		displayer.speed = 33;
-		displayer.task = xTaskCreateStatic( (TaskFunction_t) displayer_task, "common_displayer", DISPLAYER_STACK_SIZE, NULL, ESP_TASK_PRIO_MIN + 1, xStack, &xTaskBuffer);
+		sched_profile_t sched;
+		sched_get("common_displayer", &sched);
+		displayer.task = xTaskCreateStaticPinnedToCore( (TaskFunction_t) displayer_task, "common_displayer", DISPLAYER_STACK_SIZE, NULL, sched.priority, xStack, &xTaskBuffer, sched.core);
 		
 		// set lines for "fixed" text mode
 		GDS_TextSetFontAuto(display, 1, GDS_FONT_LINE_1, -3);
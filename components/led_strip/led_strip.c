@@ -5,6 +5,8 @@
     Last modified: 09/24/2023
 
     Updated: Wizmo - Adds support for APA102 using direct io 
+    Updated: Colors are translated to RMT items on the fly and only changed 
+    frames are sent
     Updated: C. Rohs  - The update thread now
     only runs when signalled. The double buffer code was modified to copy on show
     instead of the ping pong buffer that destroyed the buffers contents.
@@ -25,15 +27,14 @@
 #include "esp_log.h"
 
 static const char *TAG = "led_strip";
+static portMUX_TYPE led_strip_mux = portMUX_INITIALIZER_UNLOCKED;
 
 #define LED_STRIP_LOOP(N) for (uint8_t _i = 0; _i < N; _i++ )
 
 #define LED_STRIP_TASK_SIZE             (1024)
 #define LED_STRIP_TASK_PRIORITY         (configMAX_PRIORITIES - 1)
 
-#define LED_STRIP_REFRESH_PERIOD_MS     (30U) // TODO: add as parameter to led_strip_init
-
-#define LED_STRIP_NUM_RMT_ITEMS_PER_LED (24U) // Assumes 24 bit color for each led
+#define LED_STRIP_MIN_PERIOD_MS         (10U) // minimum time between two frames
 
 // RMT Clock source is @ 80 MHz. Dividing it by 8 gives us 10 MHz frequency, or 100ns period.
 #define LED_STRIP_RMT_CLK_DIV (8)
@@ -64,153 +65,57 @@ static const char *TAG = "led_strip";
 
 #define LED_STRIP_APA102_MAX_BRIGHTNESS  31
 
-// Function pointer for generating waveforms based on different LED drivers
-typedef void (*led_fill_rmt_items_fn)(struct led_color_t *led_strip_buf, rmt_item32_t *rmt_items, uint32_t led_strip_length);
-
-static inline void led_strip_fill_item_level(rmt_item32_t* item, int high_ticks, int low_ticks)
-{
-    item->level0 = 1;
-    item->duration0 = high_ticks;
-    item->level1 = 0;
-    item->duration1 = low_ticks;
-}
+// RMT item for one bit: high level for H ticks then low level for L ticks
+#define LED_STRIP_RMT_ITEM(H, L) ((uint32_t) (H) | (1U << 15) | ((uint32_t) (L) << 16))
 
-static inline void led_strip_rmt_bit_1_sk6812(rmt_item32_t* item)
+/* 
+ * Colors are translated into RMT items on the fly by the RMT driver (in ISR) using 
+ * small chunks instead of a full RMT items buffer (that was 96 bytes per LED). The 
+ * driver keeps going only if we fill exactly the items it wants, which is not a 
+ * multiple of a LED, so we translate bytes (8 items each) of a buffer already in 
+ * wire order
+ */
+static inline __attribute__((always_inline)) void led_strip_translate(const void *src, rmt_item32_t *dest, size_t src_size,
+                                       size_t wanted_num, size_t *translated_size, size_t *item_num,
+                                       uint32_t bit_0, uint32_t bit_1)
 {
-    led_strip_fill_item_level(item, LED_STRIP_RMT_TICKS_BIT_1_HIGH_SK6812, LED_STRIP_RMT_TICKS_BIT_1_LOW_SK6812);
-}
+    const uint8_t *byte = (const uint8_t*) src;
+    size_t count = wanted_num / 8;
 
-static inline void led_strip_rmt_bit_0_sk6812(rmt_item32_t* item)
-{
-    led_strip_fill_item_level(item, LED_STRIP_RMT_TICKS_BIT_0_HIGH_SK6812, LED_STRIP_RMT_TICKS_BIT_0_LOW_SK6812);
-}
+    if (count > src_size) count = src_size;
 
-static void led_strip_fill_rmt_items_sk6812(struct led_color_t *led_strip_buf, rmt_item32_t *rmt_items, uint32_t led_strip_length)
-{
-    uint32_t rmt_items_index = 0;
-    for (uint32_t led_index = 0; led_index < led_strip_length; led_index++) {
-        struct led_color_t led_color = led_strip_buf[led_index];
-
-        for (uint8_t bit = 8; bit != 0; bit--) {
-            uint8_t bit_set = (led_color.green >> (bit - 1)) & 1;
-            if(bit_set) {
-                led_strip_rmt_bit_1_sk6812(&(rmt_items[rmt_items_index]));
-            } else {
-                led_strip_rmt_bit_0_sk6812(&(rmt_items[rmt_items_index]));
-            }
-            rmt_items_index++;
-        }
-        for (uint8_t bit = 8; bit != 0; bit--) {
-            uint8_t bit_set = (led_color.red >> (bit - 1)) & 1;
-            if(bit_set) {
-                led_strip_rmt_bit_1_sk6812(&(rmt_items[rmt_items_index]));
-            } else {
-                led_strip_rmt_bit_0_sk6812(&(rmt_items[rmt_items_index]));
-            }
-            rmt_items_index++;
-        }
-        for (uint8_t bit = 8; bit != 0; bit--) {
-            uint8_t bit_set = (led_color.blue >> (bit - 1)) & 1;
-            if(bit_set) {
-                led_strip_rmt_bit_1_sk6812(&(rmt_items[rmt_items_index]));
-            } else {
-                led_strip_rmt_bit_0_sk6812(&(rmt_items[rmt_items_index]));
-            }
-            rmt_items_index++;
+    for (size_t i = 0; i < count; i++, byte++) {
+        for (uint8_t mask = 0x80; mask; mask >>= 1) {
+            (dest++)->val = (*byte & mask) ? bit_1 : bit_0;
         }
     }
-}
-
-static inline void led_strip_rmt_bit_1_ws2812(rmt_item32_t* item)
-{
-    led_strip_fill_item_level(item, LED_STRIP_RMT_TICKS_BIT_1_HIGH_WS2812, LED_STRIP_RMT_TICKS_BIT_1_LOW_WS2812);
-}
-
-static inline void led_strip_rmt_bit_0_ws2812(rmt_item32_t* item)
-{
-    led_strip_fill_item_level(item, LED_STRIP_RMT_TICKS_BIT_0_HIGH_WS2812, LED_STRIP_RMT_TICKS_BIT_0_LOW_WS2812);
-}
 
-static void led_strip_fill_rmt_items_ws2812(struct led_color_t *led_strip_buf, rmt_item32_t *rmt_items, uint32_t led_strip_length)
-{
-    uint32_t rmt_items_index = 0;
-    for (uint32_t led_index = 0; led_index < led_strip_length; led_index++) {
-        struct led_color_t led_color = led_strip_buf[led_index];
-
-        for (uint8_t bit = 8; bit != 0; bit--) {
-            uint8_t bit_set = (led_color.green >> (bit - 1)) & 1;
-            if(bit_set) {
-                led_strip_rmt_bit_1_ws2812(&(rmt_items[rmt_items_index]));
-            } else {
-                led_strip_rmt_bit_0_ws2812(&(rmt_items[rmt_items_index]));
-            }
-            rmt_items_index++;
-        }
-        for (uint8_t bit = 8; bit != 0; bit--) {
-            uint8_t bit_set = (led_color.red >> (bit - 1)) & 1;
-            if(bit_set) {
-                led_strip_rmt_bit_1_ws2812(&(rmt_items[rmt_items_index]));
-            } else {
-                led_strip_rmt_bit_0_ws2812(&(rmt_items[rmt_items_index]));
-            }
-            rmt_items_index++;
-        }
-        for (uint8_t bit = 8; bit != 0; bit--) {
-            uint8_t bit_set = (led_color.blue >> (bit - 1)) & 1;
-            if(bit_set) {
-                led_strip_rmt_bit_1_ws2812(&(rmt_items[rmt_items_index]));
-            } else {
-                led_strip_rmt_bit_0_ws2812(&(rmt_items[rmt_items_index]));
-            }
-            rmt_items_index++;
-        }
-    }
+    *translated_size = count;
+    *item_num = count * 8;
 }
 
-static inline void led_strip_rmt_bit_1_apa106(rmt_item32_t* item)
+static void IRAM_ATTR led_strip_translate_ws2812(const void *src, rmt_item32_t *dest, size_t src_size,
+                                                 size_t wanted_num, size_t *translated_size, size_t *item_num)
 {
-    led_strip_fill_item_level(item, LED_STRIP_RMT_TICKS_BIT_1_HIGH_APA106, LED_STRIP_RMT_TICKS_BIT_1_LOW_APA106);
+    led_strip_translate(src, dest, src_size, wanted_num, translated_size, item_num,
+                        LED_STRIP_RMT_ITEM(LED_STRIP_RMT_TICKS_BIT_0_HIGH_WS2812, LED_STRIP_RMT_TICKS_BIT_0_LOW_WS2812),
+                        LED_STRIP_RMT_ITEM(LED_STRIP_RMT_TICKS_BIT_1_HIGH_WS2812, LED_STRIP_RMT_TICKS_BIT_1_LOW_WS2812));
 }
 
-static inline void led_strip_rmt_bit_0_apa106(rmt_item32_t* item)
+static void IRAM_ATTR led_strip_translate_sk6812(const void *src, rmt_item32_t *dest, size_t src_size,
+                                                 size_t wanted_num, size_t *translated_size, size_t *item_num)
 {
-    led_strip_fill_item_level(item, LED_STRIP_RMT_TICKS_BIT_0_HIGH_APA106, LED_STRIP_RMT_TICKS_BIT_0_LOW_APA106);
+    led_strip_translate(src, dest, src_size, wanted_num, translated_size, item_num,
+                        LED_STRIP_RMT_ITEM(LED_STRIP_RMT_TICKS_BIT_0_HIGH_SK6812, LED_STRIP_RMT_TICKS_BIT_0_LOW_SK6812),
+                        LED_STRIP_RMT_ITEM(LED_STRIP_RMT_TICKS_BIT_1_HIGH_SK6812, LED_STRIP_RMT_TICKS_BIT_1_LOW_SK6812));
 }
 
-static void led_strip_fill_rmt_items_apa106(struct led_color_t *led_strip_buf, rmt_item32_t *rmt_items, uint32_t led_strip_length)
+static void IRAM_ATTR led_strip_translate_apa106(const void *src, rmt_item32_t *dest, size_t src_size,
+                                                 size_t wanted_num, size_t *translated_size, size_t *item_num)
 {
-    uint32_t rmt_items_index = 0;
-    for (uint32_t led_index = 0; led_index < led_strip_length; led_index++) {
-        struct led_color_t led_color = led_strip_buf[led_index];
-
-        for (uint8_t bit = 8; bit != 0; bit--) {
-            uint8_t bit_set = (led_color.red >> (bit - 1)) & 1;
-            if(bit_set) {
-                led_strip_rmt_bit_1_apa106(&(rmt_items[rmt_items_index]));
-            } else {
-                led_strip_rmt_bit_0_apa106(&(rmt_items[rmt_items_index]));
-            }
-            rmt_items_index++;
-        }
-        for (uint8_t bit = 8; bit != 0; bit--) {
-            uint8_t bit_set = (led_color.green >> (bit - 1)) & 1;
-            if(bit_set) {
-                led_strip_rmt_bit_1_apa106(&(rmt_items[rmt_items_index]));
-            } else {
-                led_strip_rmt_bit_0_apa106(&(rmt_items[rmt_items_index]));
-            }
-            rmt_items_index++;
-        }
-        for (uint8_t bit = 8; bit != 0; bit--) {
-            uint8_t bit_set = (led_color.blue >> (bit - 1)) & 1;
-            if(bit_set) {
-                led_strip_rmt_bit_1_apa106(&(rmt_items[rmt_items_index]));
-            } else {
-                led_strip_rmt_bit_0_apa106(&(rmt_items[rmt_items_index]));
-            }
-            rmt_items_index++;
-        }
-    }
+    led_strip_translate(src, dest, src_size, wanted_num, translated_size, item_num,
+                        LED_STRIP_RMT_ITEM(LED_STRIP_RMT_TICKS_BIT_0_HIGH_APA106, LED_STRIP_RMT_TICKS_BIT_0_LOW_APA106),
+                        LED_STRIP_RMT_ITEM(LED_STRIP_RMT_TICKS_BIT_1_HIGH_APA106, LED_STRIP_RMT_TICKS_BIT_1_LOW_APA106));
 }
 
 void apa102_init(struct led_strip_t *led_strip)
@@ -293,63 +198,41 @@ static void apa102_write(struct led_strip_t* led_strip, struct led_color_t *colo
 static void led_strip_task(void *arg)
 {
     struct led_strip_t *led_strip = (struct led_strip_t *)arg;
+    size_t size = sizeof(struct led_color_t) * led_strip->led_strip_length;
 
-    if (led_strip->rgb_led_type == RGB_LED_TYPE_APA102) {
-        uint8_t brightness = LED_STRIP_APA102_MAX_BRIGHTNESS;
-
-        for(;;) {
-            vTaskDelay(LED_STRIP_REFRESH_PERIOD_MS / portTICK_PERIOD_MS);
-            xSemaphoreTake(led_strip->access_semaphore, portMAX_DELAY);
-
-            apa102_write(led_strip, led_strip->led_strip_working, brightness);
-        }
-    } else {
-        led_fill_rmt_items_fn led_make_waveform = NULL;
-
-        size_t num_items_malloc = (LED_STRIP_NUM_RMT_ITEMS_PER_LED * led_strip->led_strip_length);
-        rmt_item32_t *rmt_items = (rmt_item32_t*) malloc(sizeof(rmt_item32_t) * num_items_malloc);
-        if (!rmt_items) {
-            vTaskDelete(NULL);
-        }
+    // private copy of the frame being sent, so that show() never waits for us
+    struct led_color_t *sending = (struct led_color_t*) malloc(size);
+    if (!sending) {
+        vTaskDelete(NULL);
+    }
 
-        switch (led_strip->rgb_led_type) {
-            case RGB_LED_TYPE_WS2812:
-                led_make_waveform = led_strip_fill_rmt_items_ws2812;
-                break;
-
-            case RGB_LED_TYPE_SK6812:
-                led_make_waveform = led_strip_fill_rmt_items_sk6812;
-                break;
-
-            case RGB_LED_TYPE_APA106:
-                led_make_waveform = led_strip_fill_rmt_items_apa106;
-                break;
-
-            default:
-                // Will avoid keeping it point to NULL
-                led_make_waveform = led_strip_fill_rmt_items_ws2812;
-                break;
-        };
-
-        for(;;) {
-            rmt_wait_tx_done(led_strip->rmt_channel, portMAX_DELAY);
-            vTaskDelay(LED_STRIP_REFRESH_PERIOD_MS / portTICK_PERIOD_MS);
-
-            xSemaphoreTake(led_strip->access_semaphore, portMAX_DELAY);
-
-            led_make_waveform(led_strip->led_strip_working,
-                            rmt_items,
-                            led_strip->led_strip_length);
-            rmt_write_items(led_strip->rmt_channel,
-                            rmt_items,
-                            num_items_malloc,
-                            false);
+    for(;;) {
+        // only wake-up when led_strip_show() has a new frame
+        xSemaphoreTake(led_strip->access_semaphore, portMAX_DELAY);
+
+        taskENTER_CRITICAL(&led_strip_mux);
+        memcpy(sending, led_strip->led_strip_showing, size);
+        taskEXIT_CRITICAL(&led_strip_mux);
+
+        if (led_strip->rgb_led_type == RGB_LED_TYPE_APA102) {
+            apa102_write(led_strip, sending, LED_STRIP_APA102_MAX_BRIGHTNESS);
+        } else {
+            // WS2812 and SK6812 expect green first, APA106 is already in wire order
+            if (led_strip->rgb_led_type != RGB_LED_TYPE_APA106) {
+                for (size_t i = 0; i < led_strip->led_strip_length; i++) {
+                    uint8_t green = sending[i].green;
+                    sending[i].green = sending[i].red;
+                    sending[i].red = green;
+                }
+            }
+            rmt_write_sample(led_strip->rmt_channel, (uint8_t*) sending, size, true);
         }
 
-        if (rmt_items) {
-            free(rmt_items);
-        }
+        // let the LEDs latch before next frame
+        vTaskDelay(LED_STRIP_MIN_PERIOD_MS / portTICK_PERIOD_MS);
     }
+
+    free(sending);
     vTaskDelete(NULL);
 }
 
@@ -360,7 +243,7 @@ static bool led_strip_init_rmt(struct led_strip_t *led_strip)
         .channel = led_strip->rmt_channel,
         .clk_div = LED_STRIP_RMT_CLK_DIV,
         .gpio_num = led_strip->gpio,
-        .mem_block_num = 1,
+        .mem_block_num = led_strip->rmt_mem_block_num ? led_strip->rmt_mem_block_num : 1,
         .tx_config = {
             .loop_en = false,
             .carrier_freq_hz = 100, // Not used, but has to be set to avoid divide by 0 err
@@ -381,6 +264,26 @@ static bool led_strip_init_rmt(struct led_strip_t *led_strip)
         return false;
     }
 
+    sample_to_rmt_t translator;
+    switch (led_strip->rgb_led_type) {
+        case RGB_LED_TYPE_SK6812:
+            translator = led_strip_translate_sk6812;
+            break;
+
+        case RGB_LED_TYPE_APA106:
+            translator = led_strip_translate_apa106;
+            break;
+
+        case RGB_LED_TYPE_WS2812:
+        default:
+            translator = led_strip_translate_ws2812;
+            break;
+    };
+
+    if (rmt_translator_init(rmt_cfg.channel, translator) != ESP_OK) {
+        return false;
+    }
+
     return true;
 }
 
@@ -473,17 +376,27 @@ bool led_strip_get_pixel_color(struct led_strip_t *led_strip, uint32_t pixel_num
 }
 
 /**
- * Updates the led buffer to be shown
+ * Updates the led buffer to be shown, only wakes up the refresh task when content has changed
  */
 bool led_strip_show(struct led_strip_t *led_strip)
 {
     bool success = true;
+    size_t size;
 
     if (!led_strip) {
         return false;
     }
+
+    /* nothing to do if frame is unchanged (we are the only writer of showing buffer) */
+    size = sizeof(struct led_color_t) * led_strip->led_strip_length;
+    if (!memcmp(led_strip->led_strip_showing, led_strip->led_strip_working, size)) {
+        return success;
+    }
+
     /* copy the current buffer for display */
-    memcpy(led_strip->led_strip_showing,led_strip->led_strip_working, sizeof(struct led_color_t) * led_strip->led_strip_length);
+    taskENTER_CRITICAL(&led_strip_mux);
+    memcpy(led_strip->led_strip_showing, led_strip->led_strip_working, size);
+    taskEXIT_CRITICAL(&led_strip_mux);
 
     xSemaphoreGive(led_strip->access_semaphore);
 
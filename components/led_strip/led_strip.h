@@ -47,6 +47,7 @@ struct led_strip_t {
 
     // RMT peripheral settings
     rmt_channel_t rmt_channel;
+    uint8_t rmt_mem_block_num; // 0 means 1 block
     
     gpio_num_t gpio; // Must be less than GPIO_NUM_33
     gpio_num_t clk; // APA102 only 
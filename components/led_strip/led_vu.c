@@ -14,11 +14,17 @@
  * The VU refresh rate has been decreaced (100->75) to optimize animation of spin dial.  Could make
  *   configurable like text scrolling (or use the same value) 
  * Artwork function, but not released as very buggy and not really practical
+ *
+ * Visualizer effects are rendered by a small engine that interpolates between analysis
+ * frames and uses palettes rebuilt only when brightness/style change. New effects can 
+ * be added using led_vu_fx_register() for any visualizer mode
  */
 
 #include <ctype.h>
 #include <math.h>
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_task.h"
 
 #include "globdefs.h"
 #include "monitor.h"
@@ -26,6 +32,7 @@
 #include "platform_config.h"
 #include "services.h"
 #include "led_vu.h"
+#include "scheduler.h"
 
 static const char *TAG = "led_vu";
 
@@ -35,7 +42,11 @@ static int battery_status = 0;
 
 #define LED_VU_STACK_SIZE (3*1024)
 
-#define LED_VU_PEAK_HOLD 6U
+#define LED_VU_FX_PERIOD_MS 16U     // ~60Hz
+#define LED_VU_FX_HOLD_MS 600U
+#define LED_VU_FX_DECAY_MS 1500U    // full scale peak decay
+#define LED_VU_FX_YIELD_MS 2000U    // explicit drawing keeps the strip that long
+#define LED_VU_FX_MAX 8
 
 #define LED_VU_DEFAULT_GPIO 22
 #define LED_VU_DEFAULT_LENGTH 19
@@ -60,12 +71,52 @@ static EXT_RAM_ATTR struct {
     int vu_scale;
 } strip;
 
+struct led_vu_fx_s {
+    int mode;
+    bool smooth;
+    led_vu_fx_render_t render;
+};
+
+static EXT_RAM_ATTR struct {
+    struct led_vu_fx_s effects[LED_VU_FX_MAX], *effect;
+    TaskHandle_t task;
+    SemaphoreHandle_t mutex;
+    bool active, fresh, idle;
+    int n, bright, style;
+    uint32_t stamp, period, yield;
+    uint8_t from[LED_VU_FX_BANDS], to[LED_VU_FX_BANDS], levels[LED_VU_FX_BANDS], peak[LED_VU_FX_BANDS];
+    struct {
+        uint32_t level, hold;
+    } peaks[LED_VU_FX_BANDS];
+    struct {
+        int bright, style;
+        uint32_t vu_scale, decay;
+        struct led_color_t spectrum[256];
+        struct led_color_t vu[LED_VU_MAX_LENGTH / 2];
+    } palette;
+} fx;
+
+static void fx_init(void);
+
 static int led_addr(int pos ) {
     if (pos < 0) return pos + strip.length;
     if (pos >= strip.length) return pos - strip.length;
     return pos;
 }
 
+/****************************************************************************************
+ * Explicit drawing takes the strip from the effects engine for LED_VU_FX_YIELD_MS
+ */
+static void strip_take(void) {
+    if (!fx.mutex) return;
+    xSemaphoreTake(fx.mutex, portMAX_DELAY);
+    fx.yield = esp_timer_get_time() / 1000 + LED_VU_FX_YIELD_MS;
+}
+
+static void strip_give(void) {
+    if (fx.mutex) xSemaphoreGive(fx.mutex);
+}
+
 static void battery_svc(float value, int cells) {
 	battery_status = battery_level_svc(); 
 	ESP_LOGI(TAG, "Called for battery service with volt:%f cells:%d status:%d", value, cells, battery_status);
@@ -78,6 +129,7 @@ static void battery_svc(float value, int cells) {
  * 
  */
 static void led_vu_sleep(void) {
+    led_vu_fx_stop();
     led_vu_clear(led_display); 
 }
 
@@ -142,6 +194,8 @@ void led_vu_init()
     } else {
         led_strip_config.rgb_led_type = RGB_LED_TYPE_WS2812;
         led_strip_config.rmt_channel = RMT_NEXT_TX_CHANNEL();
+        // reserve max memory for remote management systems (must be set before translator is installed)
+        led_strip_config.rmt_mem_block_num = 7;
     }
     led_strip_config.access_semaphore = xSemaphoreCreateBinary();
     led_strip_config.led_strip_length = strip.length;
@@ -159,11 +213,10 @@ void led_vu_init()
         goto done;
     }
 
-    // reserver max memory for remote management systems
-    rmt_set_mem_block_num(led_strip_config.rmt_channel, 7);
-
     services_sleep_setsuspend(led_vu_sleep);
 
+    fx_init();
+
     led_vu_clear(led_display);
 
     done:
@@ -196,9 +249,11 @@ uint16_t led_vu_scale() {
  */
 void led_vu_clear() {
     if (!led_display) return;
-    led_strip_clear(led_display);
 
+    strip_take();
+    led_strip_clear(led_display);
     led_strip_show(led_display);
+    strip_give();
 }
 
 /****************************************************************************************
@@ -211,11 +266,13 @@ void led_vu_color_all(uint8_t r, uint8_t g, uint8_t b) {
 
     struct led_color_t color_on = {.red = r, .green = g, .blue = b}; 
 
+    strip_take();
     for (int i = 0 ; i < strip.length ; i ++){
         led_strip_set_pixel_color(led_display, i, &color_on);
     }
 
     led_strip_show(led_display);
+    strip_give();
 }
 
 /****************************************************************************************
@@ -228,47 +285,16 @@ void led_vu_data(uint8_t* data, uint16_t offset, uint16_t length) {
     if (!led_display) return;
 
 	uint8_t* p = (uint8_t*) data;									        
+    strip_take();
 	for (int i = 0; i < length; i++) {					            
 		led_strip_set_pixel_rgb(led_display, i+offset, *p, *(p+1), *(p+2));
         p+=3;
 	} 
 
     led_strip_show(led_display);
+    strip_give();
 }
 
-/****************************************************************************************
- * Progress bar display
- * data - array of gain values(0-100)
- * offset - starting position
- * length - size of array
- */
-void led_vu_spectrum(uint8_t* data, int bright, int length, int style) {
-    if (!led_display) return;
-    uint8_t gain,r,g,b;
-    int width = strip.length / length;
-    int pos = 0;
-    uint8_t* p = (uint8_t*) data;									        
-	for (int i=0; i<length; i++) {
-		gain = *p;
-        r = gain*gain/bright;
-        if (!style) {
-            g = 0;
-            b = gain;
-        } else {
-            g = r;
-            r = 0;
-            b = gain * (bright-gain)/bright;
-        }
-        for (int j=0; j<width; j++) {
-            led_strip_set_pixel_rgb(led_display, pos, r, g, b);
-            pos++;
-        }
-        p++;
-    }
-    
-    led_strip_show(led_display);
- }
-
 /****************************************************************************************
  * Progress bar display
  * pct - percentage complete (0-100)
@@ -284,27 +310,75 @@ void led_vu_progress_bar(int pct, int bright) {
     int led_lit = strip.length * pct / 100;
 
     // set colors
+    strip_take();
     for (int i = 0; i < strip.length; i++) {
         led_strip_set_pixel_color(led_display, i, (i < led_lit) ? &color_off : &color_on);
     }
 
     led_strip_show(led_display);
+    strip_give();
+}
+
+/****************************************************************************************
+ * Rebuild palettes (only when brightness or style changes)
+ */
+static void fx_palette(int bright, int style) {
+    if (bright == fx.palette.bright && style == fx.palette.style) return;
+
+    fx.palette.bright = bright;
+    fx.palette.style = style;
+    bright = max(bright, 1);
+
+    // spectrum, indexed by level
+    for (int gain = 0; gain < 256; gain++) {
+        int level = gain > bright ? bright : gain;
+        struct led_color_t *color = fx.palette.spectrum + gain;
+        if (!style) {
+            color->red = level * level / bright;
+            color->green = 0;
+            color->blue = level;
+        } else {
+            color->red = 0;
+            color->green = level * level / bright;
+            color->blue = level * (bright - level) / bright;
+        }
+    }
+
+    // vu-meter, indexed by position (more red at top)
+    int step = strip.vu_length > 1 ? bright / (strip.vu_length - 1) : bright;
+    if (step < 1) step = 1; // for low brightness or larger strips
+    for (int i = 0, r = 0, g = bright * 2 / 3; i < strip.vu_length; i++) {
+        fx.palette.vu[i].red = r;
+        fx.palette.vu[i].green = g;
+        fx.palette.vu[i].blue = 0;
+        r = (r > bright - step) ? bright : r + step;
+        g = (g < step) ? 0 : g - step;
+    }
+
+    // level to vu-meter position in 16.16
+    fx.palette.vu_scale = (strip.vu_length << 16) / bright;
+    fx.palette.decay = (bright << 8) / LED_VU_FX_DECAY_MS;
+    if (!fx.palette.decay) fx.palette.decay = 1;
 }
 
 /****************************************************************************************
  * Spin dial display
- * gain - brightness (0-100), rate - color change speed (0-100) 
- * comet - alternate display mode
+ * levels[n-2] is brightness, levels[n/2+1] is color change speed, levels[1] is spin speed
+ * style - comet mode
  */
-void led_vu_spin_dial(int gain, int rate, int speed, bool comet) 
+static void fx_spin_dial(const uint8_t *levels, const uint8_t *peaks, int n, int bright, int style) 
 {
-    if (!led_display) return;
-
     static int led_pos = 0;
     static uint8_t r = 0;
     static uint8_t g = 0;
     static uint8_t b = 0;
+
+    if (n < 6) return;
     
+    int gain = levels[n-2];
+    int rate = levels[(n/2)+1] * 50 / max(bright, 1);
+    int speed = levels[1] * 4 / max(bright, 1);
+
     // calculate next color
     uint8_t step = rate / 2; // controls color change speed
     if (r == 0 && g == 0 && b == 0) {
@@ -323,102 +397,82 @@ void led_vu_spin_dial(int gain, int rate, int speed, bool comet)
         if (r == 0) b = step;
     }
 
-    uint8_t rp = r * gain / LED_VU_MAX; 
-    uint8_t gp = g * gain / LED_VU_MAX; 
-    uint8_t bp = b * gain / LED_VU_MAX; 
+    // LED_VU_MAX is 255, so /255 is close enough to >>8 (with rounding)
+    uint8_t rp = (r * gain + 128) >> 8; 
+    uint8_t gp = (g * gain + 128) >> 8; 
+    uint8_t bp = (b * gain + 128) >> 8; 
 
     // set led color
     speed++;
-    if (comet) {
+    if (style) {
         led_strip_clear(led_display);
         led_strip_set_pixel_rgb(led_display, led_addr(led_pos-1), rp/2, gp/2, bp/2);
         led_strip_set_pixel_rgb(led_display, led_addr(led_pos-2), rp/4, gp/4, bp/4);
         led_strip_set_pixel_rgb(led_display, led_addr(led_pos-3), rp/8, gp/8, bp/8);
-        //led_strip_set_pixel_rgb(led_display, led_addr(led_pos-4), 0, 0, 0);
     }
     for (int i = 0; i < speed; i++) {
         led_strip_set_pixel_rgb(led_display, led_pos, rp, gp, bp);
         led_pos = led_addr(++led_pos);
     }
-    
-    led_strip_show(led_display);
+}
+
+/****************************************************************************************
+ * Spectrum display
+ * levels - array of band levels (0-bright)
+ * style - color palette
+ */
+static void fx_spectrum(const uint8_t *levels, const uint8_t *peaks, int n, int bright, int style) {
+    int width = strip.length / n;
+    struct led_color_t *led = led_display->led_strip_working;
+
+    for (int i = 0; i < n; i++) {
+        struct led_color_t *color = fx.palette.spectrum + levels[i];
+        for (int j = 0; j < width; j++) *led++ = *color;
+    }
 }
 
 /****************************************************************************************
  * VU meter display
- * vu_l - left response (0-100), vu_r - right response (0-100)
- * comet - alternate display mode
+ * levels - left & right response (0-bright), peaks - left & right hold peaks
+ * style - comet mode
  */
-void led_vu_display(int vu_l, int vu_r, int bright, bool comet) {
-    static int peak_l = 0;
-    static int peak_r = 0;
-    static int decay_l = 0;
-    static int decay_r = 0;
-    if (!led_display) return;
+static void fx_vumeter(const uint8_t *levels, const uint8_t *peaks, int n, int bright, int style) {
+    int vu_l = levels[0], vu_r = levels[1];
+    int peak_l = peaks[0], peak_r = peaks[1];
 
     // single bar
     if (strip.vu_start_l == strip.vu_start_r) {
         vu_r = (vu_l + vu_r) / 2;
-        vu_l = 0;
+        peak_r = (peak_l + peak_r) / 2;
+        vu_l = peak_l = 0;
     }
 
     // scale vu samples to length
-    vu_l  = vu_l * strip.vu_length / bright;
-    vu_r = vu_r * strip.vu_length / bright;
-
-    // calculate hold peaks
-    if (peak_l > vu_l) {
-        if (decay_l-- < 0) {
-            decay_l = LED_VU_PEAK_HOLD;
-            peak_l--;
-        }
-    } else {
-        peak_l = vu_l;
-        decay_l = LED_VU_PEAK_HOLD;
-    }
-    if (peak_r > vu_r) {
-        if (decay_r-- < 0) {
-            decay_r = LED_VU_PEAK_HOLD;
-            peak_r--;
-        }
-    } else {
-        peak_r = vu_r;
-        decay_r = LED_VU_PEAK_HOLD;
-    }
+    vu_l = (vu_l * fx.palette.vu_scale) >> 16;
+    vu_r = (vu_r * fx.palette.vu_scale) >> 16;
+    peak_l = (peak_l * fx.palette.vu_scale) >> 16;
+    peak_r = (peak_r * fx.palette.vu_scale) >> 16;
 
     // turn off all leds
     led_strip_clear(led_display);
 
     // set the led bar values
-    uint8_t step = bright / (strip.vu_length-1);
-    if (step < 1) step = 1; // dor low brightness or larger strips     
-    uint8_t g = bright * 2 / 3; // more red at top
-    uint8_t r = 0;
-    int shift = 0;
     for (int i = 0; i < strip.vu_length; i++) {
+        struct led_color_t *color = fx.palette.vu + i;
         // set left
         if (i == peak_l) {
-            led_strip_set_pixel_rgb(led_display, strip.vu_start_l - i, r, g, bright);
+            led_strip_set_pixel_rgb(led_display, strip.vu_start_l - i, color->red, color->green, bright);
         } else if (i <= vu_l) {
-            shift = vu_l - i; 
-            if (comet)
-                led_strip_set_pixel_rgb(led_display, strip.vu_start_l - i, r>>shift, g>>shift, 0);
-            else
-                led_strip_set_pixel_rgb(led_display, strip.vu_start_l - i, r, g, 0);
+            int shift = style ? vu_l - i : 0; 
+            led_strip_set_pixel_rgb(led_display, strip.vu_start_l - i, color->red >> shift, color->green >> shift, 0);
         }
         // set right  
         if (i == peak_r) {
-            led_strip_set_pixel_rgb(led_display, strip.vu_start_r + i, r, g, bright);
+            led_strip_set_pixel_rgb(led_display, strip.vu_start_r + i, color->red, color->green, bright);
         }  else if (i <= vu_r) {
-            shift = vu_r - i;
-            if (comet)
-                led_strip_set_pixel_rgb(led_display, strip.vu_start_r + i, r>>shift, g>>shift, 0);
-            else
-                led_strip_set_pixel_rgb(led_display, strip.vu_start_r + i, r, g, 0);
+            int shift = style ? vu_r - i : 0; 
+            led_strip_set_pixel_rgb(led_display, strip.vu_start_r + i, color->red >> shift, color->green >> shift, 0);
         }
-        // adjust colors (with limit checks)
-        r = (r > bright-step) ? bright : r + step;
-        g = (g < step) ? 0 : g - step;
     }
 
     // show battery status
@@ -428,7 +482,196 @@ void led_vu_display(int vu_l, int vu_r, int bright, bool comet) {
         led_strip_set_pixel_rgb(led_display, strip.vu_status, bright/2, bright/2, 0);
     else if (battery_status > 0)
         led_strip_set_pixel_rgb(led_display, strip.vu_status, bright, 0, 0);
-    
-    led_strip_show(led_display);
 }
 
+/****************************************************************************************
+ * Effects engine task
+ * Renders at most every LED_VU_FX_PERIOD_MS, interpolating between the last two analysis
+ * frames for smooth effects and maintaining per-band peak hold & decay. It only wakes up
+ * when fed or when an animation step is due and only draws what has changed
+ */
+static void fx_task(void *arg) {
+    uint32_t last = esp_timer_get_time() / 1000;
+    TickType_t wait = portMAX_DELAY;
+    bool redraw = false;
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, wait);
+        xSemaphoreTake(fx.mutex, portMAX_DELAY);
+
+        uint32_t now = esp_timer_get_time() / 1000, elapsed = now - last;
+        struct led_vu_fx_s *effect = fx.active ? fx.effect : NULL;
+        last = now;
+
+        // non-smooth effects only render on new frames, otherwise sleep until we are fed
+        if (!effect || (!effect->smooth && !fx.fresh)) {
+            fx.idle = true;
+            wait = portMAX_DELAY;
+            xSemaphoreGive(fx.mutex);
+            continue;
+        }
+
+        // someone else is drawing, come back when it's our turn
+        if ((int32_t) (fx.yield - now) > 0) {
+            wait = pdMS_TO_TICKS(fx.yield - now) + 1;
+            redraw = true;
+            xSemaphoreGive(fx.mutex);
+            continue;
+        }
+
+        // interpolate levels between previous and last analysis frame (Q8)
+        uint32_t alpha = effect->smooth ? ((now - fx.stamp) << 8) / fx.period : 256;
+        bool settled = true, changed = fx.fresh || redraw;
+        if (alpha > 256) alpha = 256;
+
+        for (int i = 0; i < fx.n; i++) {
+            int level = fx.from[i] + (((fx.to[i] - fx.from[i]) * (int) alpha) >> 8);
+
+            // peak hold then linear decay (Q8)
+            if (level << 8 >= fx.peaks[i].level) {
+                fx.peaks[i].level = level << 8;
+                fx.peaks[i].hold = LED_VU_FX_HOLD_MS;
+            } else if (fx.peaks[i].hold > elapsed) {
+                fx.peaks[i].hold -= elapsed;
+            } else {
+                int decay = fx.palette.decay * elapsed;
+                fx.peaks[i].hold = 0;
+                fx.peaks[i].level = fx.peaks[i].level > decay ? fx.peaks[i].level - decay : 0;
+            }
+
+            if (fx.levels[i] != level || fx.peak[i] != fx.peaks[i].level >> 8) changed = true;
+            if (fx.peaks[i].level != level << 8) settled = false;
+            fx.levels[i] = level;
+            fx.peak[i] = fx.peaks[i].level >> 8;
+        }
+
+        if (changed) {
+            effect->render(fx.levels, fx.peak, fx.n, fx.bright, fx.style);
+            led_strip_show(led_display);
+        }
+
+        // once levels and peaks have reached their target, nothing moves until next frame
+        fx.fresh = redraw = false;
+        fx.idle = !effect->smooth || (settled && alpha == 256);
+        wait = fx.idle ? portMAX_DELAY : pdMS_TO_TICKS(LED_VU_FX_PERIOD_MS);
+
+        xSemaphoreGive(fx.mutex);
+    }
+}
+
+/****************************************************************************************
+ * Register an effect for a given visualizer mode (replaces existing one)
+ * smooth - render at full rate on interpolated levels or only on each analysis frame
+ */
+bool led_vu_fx_register(int mode, bool smooth, led_vu_fx_render_t render) {
+    int i;
+
+    for (i = 0; i < LED_VU_FX_MAX && fx.effects[i].render && fx.effects[i].mode != mode; i++);
+    if (i == LED_VU_FX_MAX) {
+        ESP_LOGW(TAG, "no room to register effect for mode %d", mode);
+        return false;
+    }
+
+    if (fx.mutex) xSemaphoreTake(fx.mutex, portMAX_DELAY);
+    fx.effects[i].mode = mode;
+    fx.effects[i].smooth = smooth;
+    fx.effects[i].render = render;
+    if (fx.mutex) xSemaphoreGive(fx.mutex);
+
+    return true;
+}
+
+/****************************************************************************************
+ * Feed a new analysis frame to the effects engine
+ * mode - visualizer mode, levels - band levels (0-bright), n - number of bands
+ */
+void led_vu_fx_feed(int mode, uint8_t *levels, int n, int bright, int style) {
+    if (!led_display || !fx.mutex) return;
+
+    if (n > LED_VU_FX_BANDS) n = LED_VU_FX_BANDS;
+
+    xSemaphoreTake(fx.mutex, portMAX_DELAY);
+
+    uint32_t now = esp_timer_get_time() / 1000;
+    bool reset = !fx.active || !fx.effect || fx.effect->mode != mode || fx.n != n;
+
+    // find effect when mode changes
+    if (!fx.effect || fx.effect->mode != mode) {
+        fx.effect = NULL;
+        for (int i = 0; i < LED_VU_FX_MAX && fx.effects[i].render; i++) {
+            if (fx.effects[i].mode == mode) fx.effect = fx.effects + i;
+        }
+    }
+
+    fx_palette(bright, style);
+    fx.bright = bright;
+    fx.style = style;
+    fx.n = n;
+
+    // track analysis rate to interpolate on the right duration
+    if (!reset) {
+        uint32_t period = now - fx.stamp;
+        if (period < LED_VU_FX_PERIOD_MS) period = LED_VU_FX_PERIOD_MS;
+        else if (period > 1000) period = 1000;
+        fx.period = (fx.period * 3 + period) / 4;
+    } else {
+        fx.period = 100;
+        memset(fx.peaks, 0, sizeof(fx.peaks));
+    }
+
+    // start from what is being displayed
+    for (int i = 0; i < n; i++) {
+        uint8_t level = levels[i] > bright ? bright : levels[i];
+        fx.from[i] = reset ? level : fx.levels[i];
+        fx.to[i] = level;
+        if (reset) fx.levels[i] = level;
+    }
+
+    fx.stamp = now;
+    fx.fresh = true;
+
+    // task only needs to be woken up when it sleeps until next frame
+    fx.active = fx.effect != NULL;
+    bool wake = fx.active && fx.idle;
+    if (wake) fx.idle = false;
+
+    xSemaphoreGive(fx.mutex);
+
+    if (wake) xTaskNotifyGive(fx.task);
+}
+
+/****************************************************************************************
+ * Stop effects engine
+ */
+void led_vu_fx_stop(void) {
+    if (!fx.mutex) return;
+    xSemaphoreTake(fx.mutex, portMAX_DELAY);
+    fx.active = false;
+    fx.effect = NULL;
+    xSemaphoreGive(fx.mutex);
+}
+
+/****************************************************************************************
+ * Create effects engine and register built-in effects
+ */
+static void fx_init(void) {
+    StaticTask_t* xTaskBuffer = (StaticTask_t*) heap_caps_malloc(sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    static EXT_RAM_ATTR StackType_t xStack[LED_VU_STACK_SIZE] __attribute__ ((aligned (4)));
+
+    // fx.mutex stays NULL so feeding is a no-op and explicit drawing still works
+    if (!xTaskBuffer) {
+        ESP_LOGE(TAG, "can't allocate effects engine task");
+        return;
+    }
+
+    fx.palette.bright = -1;
+    fx.idle = true;
+    fx.mutex = xSemaphoreCreateMutex();
+    sched_profile_t sched;
+    sched_get("led_vu_fx", &sched);
+    fx.task = xTaskCreateStaticPinnedToCore(fx_task, "led_vu_fx", LED_VU_STACK_SIZE, NULL, sched.priority, xStack, xTaskBuffer, sched.core);
+
+    led_vu_fx_register(LED_VU_FX_VUMETER, true, fx_vumeter);
+    led_vu_fx_register(LED_VU_FX_SPECTRUM, true, fx_spectrum);
+    led_vu_fx_register(LED_VU_FX_WAVEFORM, false, fx_spin_dial);
+}
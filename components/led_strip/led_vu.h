@@ -18,14 +18,22 @@
 #define led_vu_color_blue(B)    led_vu_color_all(0, 0, B)
 #define led_vu_color_yellow(B)    led_vu_color_all(B/2, B/2, 0)
 
+#define LED_VU_FX_VUMETER    0x01
+#define LED_VU_FX_SPECTRUM   0x02
+#define LED_VU_FX_WAVEFORM   0x03
+#define LED_VU_FX_BANDS      48
+
 extern struct led_strip_t* led_display;
 
+/* effects render into led_display working buffer, levels & peaks are 0..bright */
+typedef void (*led_vu_fx_render_t)(const uint8_t *levels, const uint8_t *peaks, int n, int bright, int style);
+
 uint16_t led_vu_string_length();
 uint16_t led_vu_scale();
 void led_vu_progress_bar(int pct, int bright);
-void led_vu_display(int vu_l, int vu_r, int bright, bool comet);
-void led_vu_spin_dial(int gain, int rate, int speed, bool comet);
-void led_vu_spectrum(uint8_t* data, int bright, int length, int style);
+bool led_vu_fx_register(int mode, bool smooth, led_vu_fx_render_t render);
+void led_vu_fx_feed(int mode, uint8_t *levels, int n, int bright, int style);
+void led_vu_fx_stop(void);
 void led_vu_color_all(uint8_t r, uint8_t g, uint8_t b);
 void led_vu_data(uint8_t* data, uint16_t offset, uint16_t length);
 void led_vu_clear();
@@ -187,6 +187,20 @@ esp_err_t store_nvs_value_len_for_partition(const char * partition,const char *
 		return err;
 	}
 
+	err = store_nvs_value_for_handle(nvs, type, key, data, data_len);
+	if (err == ESP_OK) {
+		err = nvs_commit(nvs);
+		if (err == ESP_OK) {
+			ESP_LOGI(TAG,   "Value stored under key '%s'", key);
+		}
+	}
+	nvs_close(nvs);
+	return err;
+}
+/* set value in an already opened handle, caller is responsible for commit */
+esp_err_t store_nvs_value_for_handle(nvs_handle nvs, nvs_type_t type, const char *key, const void * data, size_t data_len) {
+	esp_err_t err = ESP_ERR_NVS_TYPE_MISMATCH;
+
 	if (type == NVS_TYPE_I8) {
 		err = nvs_set_i8(nvs, key, *(int8_t *) data);
 	} else if (type == NVS_TYPE_U8) {
@@ -208,13 +222,6 @@ esp_err_t store_nvs_value_len_for_partition(const char * partition,const char *
 	} else if (type == NVS_TYPE_BLOB) {
 		err = nvs_set_blob(nvs, key, (void *) data, data_len);
 	}
-	if (err == ESP_OK) {
-		err = nvs_commit(nvs);
-		if (err == ESP_OK) {
-			ESP_LOGI(TAG,   "Value stored under key '%s'", key);
-		}
-	}
-	nvs_close(nvs);
 	return err;
 }
 esp_err_t store_nvs_value_len(nvs_type_t type, const char *key, void * data,
@@ -15,6 +15,7 @@ esp_err_t get_nvs_value(nvs_type_t type, const char *key, void*value, const uint
 void * get_nvs_value_alloc(nvs_type_t type, const char *key);
 void * get_nvs_value_alloc_for_partition(const char * partition,const char * name_space,nvs_type_t type, const char *key, size_t * size);
 esp_err_t erase_nvs_for_partition(const char * partition, const char * name_space,const char *key);
+esp_err_t store_nvs_value_for_handle(nvs_handle nvs, nvs_type_t type, const char *key, const void * data, size_t data_len);
 esp_err_t store_nvs_value_len_for_partition(const char * partition,const char * name_space,nvs_type_t type, const char *key, const void * data,size_t data_len);
 esp_err_t erase_nvs(const char *key);
 void print_blob(const char *blob, size_t len);
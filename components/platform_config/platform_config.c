@@ -39,13 +39,20 @@
 #include "freertos/event_groups.h"
 #include "tools.h"
 #include "trace.h"
+#include "telemetry.h"
 
 #define CONFIG_COMMIT_DELAY 1000
+#define CONFIG_HOLD_MAX (60*1000)
 #define LOCK_MAX_WAIT 20*CONFIG_COMMIT_DELAY
 static const char * TAG = "config";
+static TELEMETRY_COUNTER_DEFINE(commit_writes, "config.writes");
+static TELEMETRY_COUNTER_DEFINE(commit_skipped, "config.skipped");
+static TELEMETRY_COUNTER_DEFINE(commit_deferred, "config.deferred");
+static TELEMETRY_HISTOGRAM_DEFINE(commit_us, "config.commit_us");
 EXT_RAM_ATTR static cJSON * nvs_json=NULL;
 EXT_RAM_ATTR static TimerHandle_t timer;
 EXT_RAM_ATTR static SemaphoreHandle_t config_mutex = NULL;
+EXT_RAM_ATTR static SemaphoreHandle_t commit_mutex = NULL;
 EXT_RAM_ATTR static EventGroupHandle_t config_group;
 /* @brief indicate that the ESP32 is currently connected. */
 EXT_RAM_ATTR static const int CONFIG_NO_COMMIT_PENDING = BIT0;
@@ -66,9 +73,152 @@ void config_set_entry_changed_flag(cJSON * entry, cJSON_bool flag);
 	config_set_default(nt, key,pval,0);\
 	free(pval); }
 #define IMPLEMENT_GET_NUM(t,nt) esp_err_t config_get_## t (const char *key, t *  value){\
-		void * pval = config_alloc_get(nt, key);\
-		if(pval!=NULL){ *value = *(t * )pval; free(pval); return ESP_OK; }\
+		double num;\
+		if(config_get_number(nt, key, &num)){ *value = (t) num; return ESP_OK; }\
 		return ESP_FAIL;}
+
+/*
+ nvs_json remains the master copy (it is what is committed and what the UI gets) but
+ lookups go through an open-addressing (linear probing) hash index of its entries. Each
+ slot caches the entry's type and value item, and the parsed document of JSON strings
+ so that it is parsed once per change instead of once per reader
+*/
+#define CONFIG_INDEX_MIN 256
+
+typedef struct {
+	uint32_t hash;
+	cJSON * entry;			// item of nvs_json, entry->string is the key
+	cJSON * value;			// entry's "value" item
+	nvs_type_t type;
+	cJSON * parsed;			// lazily parsed value of JSON strings
+	// commit engine
+	uint32_t committed;		// hash of value in nvs
+	bool stored;			// committed is valid
+	uint32_t writes;
+	TickType_t written;
+	uint32_t hold;			// ms before next write
+} config_slot_t;
+
+EXT_RAM_ATTR static struct {
+	config_slot_t * slots;
+	uint32_t size, count;
+} config_index;
+
+static uint32_t config_fnv(const void *data, size_t len, uint32_t hash){
+	// FNV-1a
+	for(const uint8_t *p = data; len--; p++) hash = (hash ^ *p) * 16777619u;
+	return hash;
+}
+
+static uint32_t config_hash(const char *key){
+	// 0 is reserved for empty slots
+	uint32_t hash = config_fnv(key, strlen(key), 2166136261u);
+	return hash ? hash : 1;
+}
+
+static uint32_t config_value_hash(config_slot_t * slot){
+	uint32_t hash = config_fnv(&slot->type, sizeof(slot->type), 2166136261u);
+	if(cJSON_IsString(slot->value)) return config_fnv(slot->value->valuestring, strlen(slot->value->valuestring), hash);
+	if(slot->value) return config_fnv(&slot->value->valuedouble, sizeof(slot->value->valuedouble), hash);
+	return hash;
+}
+
+static config_slot_t * config_index_find(const char *key){
+	if(!config_index.slots || !key) return NULL;
+	uint32_t hash = config_hash(key);
+	for(uint32_t i = hash & (config_index.size - 1); config_index.slots[i].hash; i = (i + 1) & (config_index.size - 1)){
+		config_slot_t * slot = config_index.slots + i;
+		if(slot->hash == hash && !strcmp(slot->entry->string, key)) return slot;
+	}
+	return NULL;
+}
+
+static void config_index_fill(config_slot_t * slot, cJSON * entry){
+	cJSON * type = cJSON_GetObjectItemCaseSensitive(entry, "type");
+	slot->entry = entry;
+	slot->value = cJSON_GetObjectItemCaseSensitive(entry, "value");
+	slot->type = type ? type->valuedouble : 0;
+	if(slot->parsed) cJSON_Delete(slot->parsed);
+	slot->parsed = NULL;
+}
+
+static bool config_index_grow(){
+	config_slot_t * old = config_index.slots;
+	uint32_t old_size = config_index.size;
+	uint32_t size = old_size ? old_size * 2 : CONFIG_INDEX_MIN;
+	config_slot_t * slots = malloc_init_external(size * sizeof(config_slot_t));
+	if(!slots){
+		ESP_LOGE(TAG, "Unable to grow config index to %u", size);
+		return false;
+	}
+	config_index.slots = slots;
+	config_index.size = size;
+	for(uint32_t i = 0; i < old_size; i++){
+		if(!old[i].hash) continue;
+		uint32_t j = old[i].hash & (size - 1);
+		while(slots[j].hash) j = (j + 1) & (size - 1);
+		slots[j] = old[i];
+	}
+	free(old);
+	return true;
+}
+
+// must be called every time an entry is added or replaced in nvs_json
+static void config_index_set(cJSON * entry){
+	config_slot_t * slot = config_index_find(entry->string);
+	if(!slot){
+		// keep load factor under 75%
+		if((config_index.count + 1) * 4 > config_index.size * 3 && !config_index_grow()) return;
+		uint32_t hash = config_hash(entry->string);
+		uint32_t i = hash & (config_index.size - 1);
+		while(config_index.slots[i].hash) i = (i + 1) & (config_index.size - 1);
+		slot = config_index.slots + i;
+		// vacated slots still have stale content
+		memset(slot, 0, sizeof(config_slot_t));
+		slot->hash = hash;
+		config_index.count++;
+	}
+	config_index_fill(slot, entry);
+	// loaded (or unchanged) entries are what nvs holds
+	if(!config_is_entry_changed(entry)){
+		slot->committed = config_value_hash(slot);
+		slot->stored = true;
+	}
+}
+
+static void config_index_remove(const char *key){
+	config_slot_t * slot = config_index_find(key);
+	if(!slot) return;
+	if(slot->parsed) cJSON_Delete(slot->parsed);
+	config_index.count--;
+	// backward shift so that probing sequences are not broken
+	uint32_t mask = config_index.size - 1, i = slot - config_index.slots, j = i;
+	while(true){
+		config_index.slots[i].hash = 0;
+		do {
+			j = (j + 1) & mask;
+			if(!config_index.slots[j].hash) return;
+		} while((((config_index.slots[j].hash & mask) - i - 1) & mask) < ((j - i) & mask));
+		config_index.slots[i] = config_index.slots[j];
+		i = j;
+	}
+}
+
+static cJSON * config_index_parsed(config_slot_t * slot){
+	if(!slot || slot->type != NVS_TYPE_STR || !cJSON_IsString(slot->value)) return NULL;
+	if(!slot->parsed) slot->parsed = cJSON_Parse(slot->value->valuestring);
+	if(!slot->parsed) ESP_LOGE(TAG, "Unable to parse config value for key [%s]", slot->entry->string);
+	return slot->parsed;
+}
+
+static void config_index_reset(){
+	for(uint32_t i = 0; i < config_index.size; i++){
+		if(config_index.slots[i].hash && config_index.slots[i].parsed) cJSON_Delete(config_index.slots[i].parsed);
+	}
+	FREE_RESET(config_index.slots);
+	config_index.size = config_index.count = 0;
+	config_index_grow();
+}
 static void * malloc_fn(size_t sz){
 
 	void * ptr = is_recovery_running?malloc(sz):heap_caps_malloc(sz, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
@@ -85,7 +235,9 @@ void init_cJSON(){
 void config_init(){
 	ESP_LOGD(TAG, "Creating mutex for Config");
 	MEMTRACE_PRINT_DELTA();
-	config_mutex = xSemaphoreCreateMutex();
+	// recursive so that view holders can still call config functions
+	config_mutex = xSemaphoreCreateRecursiveMutex();
+	commit_mutex = xSemaphoreCreateMutex();
 	MEMTRACE_PRINT_DELTA();
 	ESP_LOGD(TAG, "Creating event group");
 	MEMTRACE_PRINT_DELTA();
@@ -99,6 +251,7 @@ void config_init(){
 		cJSON_Delete(nvs_json);
 	}
 	nvs_json = cJSON_CreateObject();
+	config_index_reset();
 
 	config_set_group_bit(CONFIG_LOAD_BIT,true);
 	MEMTRACE_PRINT_DELTA();
@@ -142,7 +295,8 @@ cJSON * config_set_value_safe(nvs_type_t nvs_type, const char *key,  const void
 		return NULL;
 	}
 
-cJSON * existing = cJSON_GetObjectItemCaseSensitive(nvs_json, key);
+	config_slot_t * slot = config_index_find(key);
+	cJSON * existing = slot ? slot->entry : NULL;
 	if(existing !=NULL && nvs_type == NVS_TYPE_STR && config_get_item_type(existing) != NVS_TYPE_STR  ) {
 		ESP_LOGW(TAG, "Storing numeric value from string");
 		numvalue = atof((char *)value);
@@ -207,6 +361,8 @@ cJSON * existing = cJSON_GetObjectItemCaseSensitive(nvs_json, key);
 			config_set_entry_changed_flag(entry,true);
 			ESP_LOGI(TAG, "Updating config [%s]", key);
 			cJSON_ReplaceItemInObject(nvs_json,key, entry);
+			// existing is freed now, refill its slot without looking it up (keeps commit state)
+			config_index_fill(slot, entry);
 			entry_str = cJSON_PrintUnformatted(entry);
 			if(entry_str!=NULL){
 				ESP_LOGD(TAG,"New config: %s", entry_str );
@@ -226,6 +382,7 @@ cJSON * existing = cJSON_GetObjectItemCaseSensitive(nvs_json, key);
 		// This is a new entry.
 		config_set_entry_changed_flag(entry,true);
 		cJSON_AddItemToObject(nvs_json, key, entry);
+		config_index_set(entry);
 	}
 
 	return entry;
@@ -387,74 +544,152 @@ void * config_safe_alloc_get_entry_value(nvs_type_t nvs_type, cJSON * entry){
 	return value;
 }
 
-void config_commit_to_nvs(){
-	ESP_LOGI(TAG,"Committing configuration to nvs. Locking config object.");
+/****************************************************************************************
+ * Commit engine. Dirty entries are collected under the config lock, but written outside
+ * of it, all in one NVS handle and commit. A value identical to what NVS already holds
+ * is not written at all, and a key rewritten shortly after its last write is held back
+ * for a delay that doubles each time (so volume or EQ changes are coalesced)
+ */
+typedef struct {
+	char * key;
+	nvs_type_t type;
+	void * value;
+	uint32_t hash;
+	esp_err_t err;
+} config_batch_t;
+
+static void config_commit(bool force){
+	TickType_t now = xTaskGetTickCount();
+	uint32_t start = telemetry_now();
+	size_t count = 0, size = 0;
+	config_batch_t * batch = NULL;
+	bool deferred = false;
+
+	xSemaphoreTake(commit_mutex, portMAX_DELAY);
 	if(!config_lock(LOCK_MAX_WAIT/portTICK_PERIOD_MS)){
-		ESP_LOGE(TAG, "config_commit_to_nvs: Unable to lock config for commit ");
+		ESP_LOGE(TAG, "config_commit: Unable to lock config for commit ");
+		xSemaphoreGive(commit_mutex);
 		return ;
 	}
-	if(nvs_json==NULL){
-		ESP_LOGE(TAG, ": cJSON nvs cache object not set.");
-		return;
-	}
-	ESP_LOGV(TAG,"config_commit_to_nvs. Config Locked!");
-	cJSON * entry=nvs_json->child;
-	while(entry!= NULL){
-		char * entry_str = cJSON_PrintUnformatted(entry);
-		if(entry_str!=NULL){
-			ESP_LOGV(TAG,"config_commit_to_nvs processing item %s",entry_str);
-			free(entry_str);
+
+	for(cJSON * entry=nvs_json->child; entry; entry = entry->next){
+		if(!config_is_entry_changed(entry)) continue;
+		config_slot_t * slot = config_index_find(entry->string);
+		if(!slot) continue;
+
+		uint32_t hash = config_value_hash(slot);
+		if(slot->stored && slot->committed == hash){
+			ESP_LOGD(TAG, "Value of %s is already in nvs", entry->string);
+			config_set_entry_changed_flag(entry, false);
+			telemetry_count(&commit_skipped, 1);
+			continue;
+		}
+		if(!force && (now - slot->written) * portTICK_PERIOD_MS < slot->hold){
+			deferred = true;
+			continue;
 		}
 
-		if(config_is_entry_changed(entry)){
-			ESP_LOGD(TAG, "Committing entry %s value to nvs.",(entry->string==NULL)?"UNKNOWN":entry->string);
-			nvs_type_t type = config_get_entry_type(entry);
-			void * value = config_safe_alloc_get_entry_value(type, entry);
-			if(value!=NULL){
-				size_t len=strlen(entry->string);
-				char * key=(void *)malloc_init_external(len+1);
-				memcpy(key,entry->string,len);
-				esp_err_t err = store_nvs_value(type,key,value);
-				FREE_AND_NULL(key);
-				FREE_AND_NULL(value);
-
-				if(err!=ESP_OK){
-					char * entry_str = cJSON_PrintUnformatted(entry);
-					if(entry_str!=NULL){
-						ESP_LOGE(TAG, "Error comitting value to nvs for key %s, Object: \n%s",entry->string,entry_str);
-						free(entry_str);
-					}
-					else {
-						ESP_LOGE(TAG, "Error comitting value to nvs for key %s",entry->string);
-					}
-				}
-				else {
-					config_set_entry_changed_flag(entry, false);
-				}
-			}
-			else {
-				char * entry_str = cJSON_PrintUnformatted(entry);
-				if(entry_str!=NULL){
-					ESP_LOGE(TAG, "Unable to retrieve value. Error comitting value to nvs for key %s, Object: \n%s",entry->string,entry_str);
-					free(entry_str);
-				}
-				else {
-					ESP_LOGE(TAG, "Unable to retrieve value. Error comitting value to nvs for key %s",entry->string);
-				}
-			}
+		if(count == size){
+			config_batch_t * grown = realloc(batch, (size += 8) * sizeof(config_batch_t));
+			if(!grown) { deferred = true; break; }
+			batch = grown;
 		}
-		else {
-			ESP_LOGV(TAG,"config_commit_to_nvs. Item already committed.  Ignoring.");
+		batch[count] = (config_batch_t) { strdup_psram(entry->string), slot->type, config_safe_alloc_get_entry_value(slot->type, entry), hash, ESP_FAIL };
+		if(!batch[count].key || !batch[count].value){
+			ESP_LOGE(TAG, "Unable to retrieve value. Error comitting value to nvs for key %s",entry->string);
+			free(batch[count].key);
+			free(batch[count].value);
+			continue;
 		}
-		taskYIELD();  /* allows the freeRTOS scheduler to take over if needed. */
-		entry = entry->next;
+		// cleared now, so that a change made while we write is not lost
+		config_set_entry_changed_flag(entry, false);
+		count++;
 	}
-	ESP_LOGV(TAG,"config_commit_to_nvs. Resetting the global commit flag.");
-	config_raise_change(false);
-	ESP_LOGV(TAG,"config_commit_to_nvs. Releasing the lock object.");
 	config_unlock();
+
+	if(count){
+		nvs_handle nvs;
+		esp_err_t err = nvs_open_from_partition(settings_partition, current_namespace, NVS_READWRITE, &nvs);
+		if(err == ESP_OK){
+			for(size_t i = 0; i < count; i++){
+				batch[i].err = store_nvs_value_for_handle(nvs, batch[i].type, batch[i].key, batch[i].value, 0);
+				if(batch[i].err != ESP_OK) ESP_LOGE(TAG, "Error comitting value to nvs for key %s: %s", batch[i].key, esp_err_to_name(batch[i].err));
+				taskYIELD();
+			}
+			err = nvs_commit(nvs);
+			nvs_close(nvs);
+		}
+		if(err != ESP_OK){
+			ESP_LOGE(TAG, "Unable to commit %u values to nvs: %s", count, esp_err_to_name(err));
+			for(size_t i = 0; i < count; i++) batch[i].err = err;
+		}
+
+		// slots might have moved while unlocked
+		config_lock(portMAX_DELAY);
+		for(size_t i = 0; i < count; i++){
+			config_slot_t * slot = config_index_find(batch[i].key);
+			if(slot && batch[i].err == ESP_OK){
+				// rewritten while held back means it's churning
+				uint32_t elapsed = (now - slot->written) * portTICK_PERIOD_MS;
+				if(slot->writes && elapsed < CONFIG_HOLD_MAX) slot->hold = slot->hold ? slot->hold * 2 : CONFIG_COMMIT_DELAY * 2;
+				else slot->hold = 0;
+				if(slot->hold > CONFIG_HOLD_MAX) slot->hold = CONFIG_HOLD_MAX;
+				slot->committed = batch[i].hash;
+				slot->stored = true;
+				slot->written = now;
+				slot->writes++;
+				telemetry_count(&commit_writes, 1);
+				ESP_LOGI(TAG, "Value stored under key '%s' (%u writes)", batch[i].key, slot->writes);
+			} else if(slot){
+				config_set_entry_changed_flag(slot->entry, true);
+				deferred = true;
+			}
+			free(batch[i].key);
+			free(batch[i].value);
+		}
+		config_unlock();
+	}
+
+	free(batch);
+	if(deferred) telemetry_count(&commit_deferred, 1);
+	config_raise_change(deferred);
+	xSemaphoreGive(commit_mutex);
+	if(count) telemetry_elapsed(&commit_us, start);
+}
+
+/****************************************************************************************
+ * Flush everything now, ignoring hold delays
+ */
+void config_commit_to_nvs(){
+	ESP_LOGI(TAG,"Committing configuration to nvs.");
+	config_commit(true);
 	ESP_LOGI(TAG,"Done Committing configuration to nvs.");
 }
+
+/****************************************************************************************
+ * Per key write counters, held keys are flagged as pending
+ */
+char * config_alloc_get_commit_stats(){
+	cJSON * stats = cJSON_CreateObject();
+	char * json = NULL;
+	if(!config_lock(LOCK_MAX_WAIT/portTICK_PERIOD_MS)){
+		ESP_LOGE(TAG, "Unable to lock config");
+		cJSON_Delete(stats);
+		return NULL;
+	}
+	for(cJSON * entry=nvs_json->child; entry; entry = entry->next){
+		config_slot_t * slot = config_index_find(entry->string);
+		if(!slot || (!slot->writes && !config_is_entry_changed(entry))) continue;
+		cJSON * item = cJSON_AddObjectToObject(stats, entry->string);
+		cJSON_AddNumberToObject(item, "writes", slot->writes);
+		cJSON_AddNumberToObject(item, "hold", slot->hold);
+		cJSON_AddBoolToObject(item, "pending", config_is_entry_changed(entry));
+	}
+	config_unlock();
+	json = cJSON_PrintUnformatted(stats);
+	cJSON_Delete(stats);
+	return json;
+}
 bool config_has_changes(){
 	return  (xEventGroupGetBits(config_group) & CONFIG_NO_COMMIT_PENDING)==0;
 }
@@ -462,6 +697,9 @@ bool config_has_changes(){
 
 bool wait_for_commit(){
 	bool commit_pending=(xEventGroupGetBits(config_group) & CONFIG_NO_COMMIT_PENDING)==0;
+	// don't wait for held back keys
+	if(commit_pending) config_commit_to_nvs();
+	commit_pending=(xEventGroupGetBits(config_group) & CONFIG_NO_COMMIT_PENDING)==0;
 	while (commit_pending){
 		ESP_LOGW(TAG,"Waiting for config commit ...");
 		commit_pending = (xEventGroupWaitBits(config_group, CONFIG_NO_COMMIT_PENDING,pdFALSE, pdTRUE, (CONFIG_COMMIT_DELAY*2) / portTICK_PERIOD_MS) & CONFIG_NO_COMMIT_PENDING)==0;
@@ -477,7 +715,7 @@ bool wait_for_commit(){
 
 bool config_lock(TickType_t xTicksToWait) {
 	ESP_LOGV(TAG, "Locking config json object");
-	if( xSemaphoreTake( config_mutex, xTicksToWait ) == pdTRUE ) {
+	if( xSemaphoreTakeRecursive( config_mutex, xTicksToWait ) == pdTRUE ) {
 		ESP_LOGV(TAG, "config Json object locked!");
 		return true;
 	}
@@ -489,14 +727,14 @@ bool config_lock(TickType_t xTicksToWait) {
 
 void config_unlock() {
 	ESP_LOGV(TAG, "Unlocking json buffer!");
-	xSemaphoreGive( config_mutex );
+	xSemaphoreGiveRecursive( config_mutex );
 }
 
 static void vCallbackFunction( TimerHandle_t xTimer ) {
 	static int cnt=0;
 	if(config_has_changes()){
-		ESP_LOGI(TAG, "configuration has some uncommitted entries");
-		config_commit_to_nvs();
+		ESP_LOGD(TAG, "configuration has some uncommitted entries");
+		config_commit(false);
 	}
 	else{
 		if(++cnt>=15){
@@ -545,7 +783,8 @@ void config_set_default(nvs_type_t type, const char *key, const void * default_v
 	}
 
 	ESP_LOGV(TAG, "Checking if key %s exists in nvs cache for type %s.", key,type_to_str(type));
-	cJSON * entry = cJSON_GetObjectItemCaseSensitive(nvs_json, key);
+	config_slot_t * slot = config_index_find(key);
+	cJSON * entry = slot ? slot->entry : NULL;
 
 	if(entry !=NULL){
 		ESP_LOGV(TAG, "Entry found.");
@@ -601,6 +840,7 @@ void config_delete_key(const char *key){
 		ESP_LOGV(TAG, "Structure before delete \n%s", struc_str);
 		free(struc_str);
 	}
+	config_index_remove(key);
 	cJSON * entry = cJSON_DetachItemFromObjectCaseSensitive(nvs_json, key);
 	if(entry !=NULL){
 		ESP_LOGI(TAG, "Removing config key [%s]", entry->string);
@@ -620,17 +860,72 @@ void config_delete_key(const char *key){
 void * config_alloc_get(nvs_type_t nvs_type, const char *key) {
 	return config_alloc_get_default(nvs_type, key, NULL, 0);
 }
+
+/****************************************************************************************
+ * Zero-copy accessors. What they return belongs to the config cache and is only valid
+ * while caller holds config_view_lock(), otherwise use config_alloc_get* to get a copy
+ */
+bool config_view_lock(){
+	return config_lock(LOCK_MAX_WAIT/portTICK_PERIOD_MS);
+}
+
+void config_view_unlock(){
+	config_unlock();
+}
+
+const char * config_get_str_view(const char *key){
+	const char * value = NULL;
+	if(!config_lock(LOCK_MAX_WAIT/portTICK_PERIOD_MS)){
+		ESP_LOGE(TAG, "Unable to lock config");
+		return NULL;
+	}
+	config_slot_t * slot = config_index_find(key);
+	if(slot && slot->type == NVS_TYPE_STR) value = cJSON_GetStringValue(slot->value);
+	config_unlock();
+	return value;
+}
+
+const cJSON * config_get_cjson_view(const char *key){
+	const cJSON * value = NULL;
+	if(!config_lock(LOCK_MAX_WAIT/portTICK_PERIOD_MS)){
+		ESP_LOGE(TAG, "Unable to lock config");
+		return NULL;
+	}
+	value = config_index_parsed(config_index_find(key));
+	config_unlock();
+	return value;
+}
+
+bool config_get_number(nvs_type_t nvs_type, const char *key, double *value){
+	bool found = false;
+	if(!config_lock(LOCK_MAX_WAIT/portTICK_PERIOD_MS)){
+		ESP_LOGE(TAG, "Unable to lock config");
+		return false;
+	}
+	config_slot_t * slot = config_index_find(key);
+	if(slot && slot->type == nvs_type && cJSON_IsNumber(slot->value)){
+		*value = slot->value->valuedouble;
+		found = true;
+	}
+	else if(slot){
+		ESP_LOGE(TAG, "Requested value type %s for key %s, found value type %s instead", type_to_str(nvs_type), key, type_to_str(slot->type));
+	}
+	config_unlock();
+	return found;
+}
+
 cJSON * config_alloc_get_cjson(const char *key){
-	char * conf_str = config_alloc_get_default(NVS_TYPE_STR, key, NULL, 0);
-	if(conf_str==NULL){
-		ESP_LOGE(TAG, "Unable to get config value for key [%s]", key);
+	cJSON * conf_json = NULL;
+	if(!config_lock(LOCK_MAX_WAIT/portTICK_PERIOD_MS)){
+		ESP_LOGE(TAG, "Unable to lock config");
 		return NULL;
 	}
-	cJSON * conf_json = cJSON_Parse(conf_str);
-	free(conf_str);
+	// duplicating the cached document is cheaper than parsing the string again
+	cJSON * parsed = config_index_parsed(config_index_find(key));
+	if(parsed) conf_json = cJSON_Duplicate(parsed, true);
+	config_unlock();
 	if(conf_json==NULL){
-		ESP_LOGE(TAG, "Unable to parse config value for key [%s]", key);
-		return NULL;
+		ESP_LOGE(TAG, "Unable to get config value for key [%s]", key);
 	}
 	return conf_json;
 }
@@ -683,7 +978,8 @@ void * config_alloc_get_default(nvs_type_t nvs_type, const char *key, void * def
 		return value;
 	}
 	ESP_LOGD(TAG,"Getting config entry for key %s",key);
-	cJSON * entry = cJSON_GetObjectItemCaseSensitive(nvs_json, key);
+	config_slot_t * slot = config_index_find(key);
+	cJSON * entry = slot ? slot->entry : NULL;
 	if(entry !=NULL){
 		ESP_LOGV(TAG, "Entry found, getting value.");
 		value = config_safe_alloc_get_entry_value(nvs_type, entry);
@@ -53,6 +53,7 @@ DECLARE_GET_NUM(int32_t);
 
 bool config_has_changes();
 void config_commit_to_nvs();
+char * config_alloc_get_commit_stats();
 void config_start_timer();
 void config_init();
 bool config_parse_param_int(const char * config,const char * param,  char  delimiter,int * value);
@@ -61,6 +62,12 @@ bool config_parse_param_str(const char *source, const char *param, char delimite
 void * config_alloc_get_default(nvs_type_t type, const char *key, void * default_value, size_t blob_size);
 void * config_alloc_get_str(const char *key, char *lead, char *fallback);
 cJSON * config_alloc_get_cjson(const char *key);
+// views must be used between config_view_lock() and config_view_unlock()
+bool config_view_lock();
+void config_view_unlock();
+const char * config_get_str_view(const char *key);
+const cJSON * config_get_cjson_view(const char *key);
+bool config_get_number(nvs_type_t nvs_type, const char *key, double *value);
 esp_err_t config_set_cjson_str_and_free(const char *key, cJSON *value);
 esp_err_t config_set_cjson(const char *key, cJSON *value, bool free_cjson);
 void config_get_uint16t_from_str(const char *key, uint16_t *value, uint16_t default_value);
@@ -103,6 +103,7 @@ cJSON * get_gpio_list(bool refresh){
 
 
 extern int squeezelite_main(int argc, char **argv);
+extern char *squeezelite_alloc_bench(void);
 
 static int launchsqueezelite(int argc, char **argv);
 
@@ -187,6 +188,17 @@ static int launchsqueezelite(int argc, char **argv) {
     return 0;
 }
 
+static int bench_squeezelite(int argc, char **argv) {
+	char *report = squeezelite_alloc_bench();
+	if (!report) {
+		cmd_send_messaging(argv[0], MESSAGING_ERROR, "Unable to run benchmark");
+		return 1;
+	}
+	cmd_send_messaging(argv[0], MESSAGING_INFO, "%s", report);
+	free(report);
+	return 0;
+}
+
 void register_squeezelite() {
 	squeezelite_args.parameters = arg_str0(NULL, NULL, "<parms>", "command line for squeezelite. -h for help, --defaults to launch with default values.");
 	squeezelite_args.end = arg_end(1);
@@ -198,6 +210,14 @@ void register_squeezelite() {
 		.argtable = &squeezelite_args
 	};
 	ESP_ERROR_CHECK( esp_console_cmd_register(&launch_squeezelite) );
+
+	const esp_console_cmd_t bench = {
+		.command = "bench",
+		.help = "Measure the cpu cost of audio processing (DoP to PCM, resampler profiles)",
+		.hint = NULL,
+		.func = &bench_squeezelite,
+	};
+	ESP_ERROR_CHECK( esp_console_cmd_register(&bench) );
 }
 
 esp_err_t start_ota(const char * bin_url, char * bin_buffer, uint32_t length) {
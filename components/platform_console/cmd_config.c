@@ -120,6 +120,9 @@ static struct {
     struct arg_int *port;
 	struct arg_int *channels;
 	struct arg_str *format;
+	struct arg_int *ptime;
+	struct arg_int *frame;
+	struct arg_int *bitrate;
 	struct arg_lit *clear;
     struct arg_end *end;
 } adcout_args;
@@ -216,8 +219,8 @@ static struct {
 	#endif
 	#if RESAMPLE16
 	struct arg_lit * resample;
-	struct arg_str * resample_parms; //" -R -u [params]\tResample, params = (b|l|m)[:i],\n"
-	//			   "   \t\t\t b = basic linear interpolation, l = 13 taps, m = 21 taps, i = interpolate filter coefficients\n"
+	struct arg_str * resample_parms; //" -R -u [params]\tResample, params = (b|l|m|p|a)[:i[:budget]],\n"
+	//			   "   \t\t\t b = basic linear interpolation, l = 13 taps, m = 21 taps, p = 32 taps polyphase, a = best profile within budget, i = interpolate filter coefficients (b, l, m)\n"
 	#endif
 	struct arg_int * rate;//			   "  -Z <rate>\t\tReport rate to server in helo as the maximum sample rate we can support\n"
     struct arg_lit *amp_off;	//            -G for ESP32 [y/n/x] for ESP32, the format is 'y' for auto on/off with jack, 'n' for always on, 'x' for always off. default is always on.
@@ -894,7 +897,8 @@ static int do_adc_cmd(int argc, char **argv)
 }
 static int do_adcout_cmd(int argc, char **argv)
 {
-	adcout_struct_t adcout;
+	// start from current configuration so that omitted options are kept
+	adcout_struct_t adcout = *config_adcout_get();
 
 	ESP_LOGD(TAG,"Processing adc stream command %s with %d parameters",argv[0],argc);
 
@@ -928,7 +932,20 @@ static int do_adcout_cmd(int argc, char **argv)
 			adcout.ch = (adcout_args.channels->ival[0]==2)?2:1;
 		}
 		if (adcout_args.format->count > 0) {
-			adcout.fmt = (strcmp(adcout_args.format->sval[0],"PCM") == 0)?0:1;
+			if (strcasecmp(adcout_args.format->sval[0],"PCM") == 0) adcout.fmt = 0;
+			else if (strcasecmp(adcout_args.format->sval[0],"RTP") == 0) adcout.fmt = 5;
+			else if (strcasecmp(adcout_args.format->sval[0],"FLAC") == 0) adcout.fmt = 4;
+			else if (strcasecmp(adcout_args.format->sval[0],"OPUS") == 0) adcout.fmt = 6;
+			else adcout.fmt = 1;
+		}
+		if (adcout_args.ptime->count > 0) {
+			adcout.ptime = adcout_args.ptime->ival[0];
+		}
+		if (adcout_args.frame->count > 0) {
+			adcout.frame = adcout_args.frame->ival[0];
+		}
+		if (adcout_args.bitrate->count > 0) {
+			adcout.bitrate = adcout_args.bitrate->ival[0];
 		}
 
 		if (!nerrors) {
@@ -969,9 +986,16 @@ cJSON * cspot_cb(){
 		ESP_LOGE(TAG,"cspot_cb: Failed to create JSON object");
 		return NULL;
 	}
-	cJSON * cspot_config = config_alloc_get_cjson("cspot_config");
+	if(!config_view_lock()){
+		ESP_LOGE(TAG,"cspot_cb: Failed to lock configuration");
+		cJSON_Delete(values);
+		return NULL;
+	}
+	const cJSON * cspot_config = config_get_cjson_view("cspot_config");
 	if(!cspot_config){
+		config_view_unlock();
 		ESP_LOGE(TAG,"cspot_cb: Failed to get cspot config");
+		cJSON_Delete(values);
 		return NULL;
 	}
 	cJSON * cspot_values = cJSON_GetObjectItem(cspot_config,cspot_args.deviceName->hdr.longopts);
@@ -986,8 +1010,8 @@ cJSON * cspot_cb(){
 	if(cspot_values){
 		cJSON_AddNumberToObject(values,cspot_args.zeroConf->hdr.longopts,cJSON_GetNumberValue(cspot_values));
 	}
+	config_view_unlock();
 
-	cJSON_Delete(cspot_config);
 	return values;
 }
 #endif
@@ -1615,9 +1639,12 @@ void register_adcout_config(void){
 	adcout_args.host = arg_str0(NULL,"host","<ip>","Output stream destination address (use 0.0.0.0 for multi-cast)");
     adcout_args.port = arg_int0(NULL,"port","<n>","Output stream port number");
     adcout_args.channels = arg_int0(NULL,"channels","1|2","Output stream channels (mono = 1, stereo = 2) [default: 1]");
-    adcout_args.format = arg_str0(NULL,"format","PCM|WAV","Output stream format (use WAV for Rhasspy, use PCM for raw stream) [default: WAV]");
+    adcout_args.format = arg_str0(NULL,"format","PCM|WAV|RTP|FLAC|OPUS","Output stream format (use WAV for Rhasspy, use PCM for raw stream, RTP for RTP/L16, FLAC/OPUS for compressed RTP) [default: WAV]");
+    adcout_args.ptime = arg_int0(NULL,"ptime","<ms>","RTP packet duration, capped to fit network MTU [default: 20]");
+    adcout_args.frame = arg_int0(NULL,"frame","<ms>","FLAC/OPUS frame duration (Opus: 5|10|20|40|60) [default: 20]");
+    adcout_args.bitrate = arg_int0(NULL,"bitrate","<bps>","OPUS target bitrate [default: codec's choice]");
 	adcout_args.clear = arg_lit0(NULL, "clear", "Clear configuration (factory)");
-    adcout_args.end = arg_end(6);
+    adcout_args.end = arg_end(9);
 
 	const esp_console_cmd_t cmd = {
         .command = CFG_TYPE_SYST("adc"),
@@ -1751,7 +1778,7 @@ void register_squeezelite_config(void){
 #endif
 #if RESAMPLE16
 	squeezelite_args.resample = arg_lit0("R","resample","Activate Resample");
-	squeezelite_args.resample_parms = arg_str0("u","resample_parms","(b|l|m)[:i]","Resample, params. b = basic linear interpolation, l = 13 taps, m = 21 taps, i = interpolate filter coefficients");
+	squeezelite_args.resample_parms = arg_str0("u","resample_parms","(b|l|m|p|a)[:i[:budget]]","Resample, params. b = basic linear interpolation, l = 13 taps, m = 21 taps, p = 32 taps polyphase (44.1 <-> 48kHz and small ratios), a = best profile within budget, i = interpolate filter coefficients (b, l, m), budget = cpu share in percent for a (default 25)");
 #endif
 	squeezelite_args.rate = arg_int0("Z","max_rate", "<n>", "Report rate to server in helo as the maximum sample rate we can support");
     squeezelite_args.amp_off = arg_lit0("G", "amp_off", "Disable Amplifier. Select to turn off the amplifier. (supported hardware only)");
@@ -24,6 +24,7 @@ extern "C" {
 #include "cmd_nvs.h"
 #include "nvs.h"
 #include "nvs_utilities.h"
+#include "platform_config.h"
 #include "platform_console.h"
 #include "messaging.h"
 #include "tools.h"
@@ -484,6 +485,17 @@ static int list(const char *part, const char *name, const char *str_type)
 
     return 0;
 }
+static int commit_stats(int argc, char **argv)
+{
+    char *json = config_alloc_get_commit_stats();
+    if (!json) {
+        cmd_send_messaging(argv[0],MESSAGING_ERROR,"Unable to retrieve configuration write statistics");
+        return 1;
+    }
+    cmd_send_messaging(argv[0],MESSAGING_INFO,"%s", json);
+    free(json);
+    return 0;
+}
 static int list_entries(int argc, char **argv)
 {
     list_args.partition->sval[0] = "";
@@ -590,6 +602,16 @@ void register_nvs()
            .argtable = &list_args
        };
 
+    const esp_console_cmd_t stats_cmd = {
+           .command = "nvs_stats",
+           .help = "Number of writes to NVS per configuration key, and keys held back because they change too often",
+           .hint = NULL,
+           .func = &commit_stats,
+           .argtable = NULL
+       };
+
+    MEMTRACE_PRINT_DELTA_MESSAGE("registering stats_cmd");
+    ESP_ERROR_CHECK(esp_console_cmd_register(&stats_cmd));
     MEMTRACE_PRINT_DELTA_MESSAGE("registering list_entries_cmd");
     ESP_ERROR_CHECK(esp_console_cmd_register(&list_entries_cmd));
     MEMTRACE_PRINT_DELTA_MESSAGE("registering set_cmd");
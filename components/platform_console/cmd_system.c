@@ -31,6 +31,8 @@
 #include "messaging.h"				  
 #include "platform_console.h"
 #include "tools.h"
+#include "telemetry.h"
+#include "monitor.h"
 #include "nvs_utilities.h"
 #if defined(CONFIG_WITH_METRICS)
 #include "Metrics.h"
@@ -71,6 +73,8 @@ static const char * TAG = "cmd_system";
 
 //static void register_setbtsource();
 static void register_free();
+static void register_telemetry();
+static void register_stats();
 static void register_setdevicename();
 static void register_heap();
 static void register_dump_heap();
@@ -100,6 +104,8 @@ void register_system()
     register_setdevicename();
     register_set_services();
     register_free();
+    register_telemetry();
+    register_stats();
     register_heap();
     register_dump_heap();
     register_version();
@@ -315,6 +321,52 @@ static void register_free()
 
     ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
 }
+/** 'telemetry' command prints audio pipeline metrics as JSON */
+static int telemetry_dump(int argc, char **argv)
+{
+	char *json = telemetry_alloc_json();
+	if (!json) {
+		cmd_send_messaging(argv[0],MESSAGING_ERROR,"Unable to retrieve telemetry");
+		return 1;
+	}
+	cmd_send_messaging(argv[0],MESSAGING_INFO,"%s", json);
+	free(json);
+	return 0;
+}
+
+static void register_telemetry()
+{
+    const esp_console_cmd_t cmd = {
+        .command = "telemetry",
+        .help = "Get audio pipeline telemetry (counters, gauges and histograms) as JSON",
+        .hint = NULL,
+        .func = &telemetry_dump,
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
+/** 'stats' command prints latest task and heap profile as JSON */
+static int stats_dump(int argc, char **argv)
+{
+	char *json = monitor_alloc_stats_json();
+	if (!json) {
+		cmd_send_messaging(argv[0],MESSAGING_ERROR,"No profile available yet");
+		return 1;
+	}
+	cmd_send_messaging(argv[0],MESSAGING_INFO,"%s", json);
+	free(json);
+	return 0;
+}
+
+static void register_stats()
+{
+    const esp_console_cmd_t cmd = {
+        .command = "stats",
+        .help = "Get latest task load, per-core idle and heap fragmentation as JSON",
+        .hint = NULL,
+        .func = &stats_dump,
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&cmd) );
+}
 static int dump_heap(int argc, char **argv)
 {
     ESP_LOGD(TAG, "Dumping heap");
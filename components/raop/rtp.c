@@ -50,12 +50,16 @@
 #include <openssl/aes.h>
 #include "alac_wrapper.h"
 #define MSG_DONTWAIT 0
+#define TELEMETRY_COUNTER_DEFINE(var, name) int var
+#define telemetry_count(metric, n)
 #else
 #include "esp_pthread.h"
 #include "esp_system.h"
 #include <mbedtls/version.h>
 #include <mbedtls/aes.h>
 #include "alac_wrapper.h"
+#include "telemetry.h"
+#include "scheduler.h"
 #endif
 
 #define NTP2MS(ntp) ((((ntp) >> 10) * 1000L) >> 22)
@@ -87,6 +91,10 @@ static log_level 	*loglevel = &raop_loglevel;
 enum { DATA = 0, CONTROL, TIMING };
 
 static const u8_t silence_frame[MAX_PACKET] = { 0 };
+static TELEMETRY_COUNTER_DEFINE(telemetry_resent_req, "raop.resent_req");
+static TELEMETRY_COUNTER_DEFINE(telemetry_resent_rec, "raop.resent_rec");
+static TELEMETRY_COUNTER_DEFINE(telemetry_silence, "raop.silence");
+static TELEMETRY_COUNTER_DEFINE(telemetry_discarded, "raop.discarded");
 uint32_t buffer_frames = ((150 * RAOP_SAMPLE_RATE * 2) / (352 * 100));
 
 typedef u16_t seq_t;
@@ -283,10 +291,11 @@ rtp_resp_t rtp_init(struct in_addr host, int latency, char *aeskey, char *aesiv,
 #ifdef WIN32
 	pthread_create(&ctx->thread, NULL, rtp_thread_func, (void *) ctx);
 #else
+	sched_profile_t sched;
+	sched_get("RTP_thread", &sched);
 	ctx->xTaskBuffer = (StaticTask_t*) heap_caps_malloc(sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
 	ctx->thread = xTaskCreateStaticPinnedToCore( (TaskFunction_t) rtp_thread_func, "RTP_thread", RTP_STACK_SIZE, ctx,
-									 CONFIG_ESP32_PTHREAD_TASK_PRIO_DEFAULT + 1, ctx->xStack, ctx->xTaskBuffer,
-									 CONFIG_PTHREAD_TASK_CORE_DEFAULT );
+									 sched.priority, ctx->xStack, ctx->xTaskBuffer, sched.core );
 #endif
 	
 	// cleanup everything if we failed
@@ -494,6 +503,7 @@ static void buffer_put_packet(rtp_t *ctx, seq_t seqno, unsigned rtptime, bool fi
 		// recovered packet, not yet sent
 		abuf = ctx->audio_buffer + BUFIDX(seqno);
 		ctx->resent_rec++;
+		telemetry_count(&telemetry_resent_rec, 1);
 		LOG_DEBUG("[%p]: packet recovered seqno:%hu rtptime:%u (W:%hu R:%hu)", ctx, seqno, rtptime, ctx->ab_write, ctx->ab_read);
 	} else {
 		// too late
@@ -542,6 +552,7 @@ static void buffer_push_packet(rtp_t *ctx) {
 		if (now > playtime) {
 			LOG_DEBUG("[%p]: discarded frame now:%u missed by:%d (W:%hu R:%hu)", ctx, now, now - playtime, ctx->ab_write, ctx->ab_read);
 			ctx->discarded++;
+			telemetry_count(&telemetry_discarded, 1);
 			curframe->ready = 0;
 		} else if (playtime - now <= hold) {
 			if (curframe->ready) {
@@ -551,6 +562,7 @@ static void buffer_push_packet(rtp_t *ctx) {
 				LOG_DEBUG("[%p]: created zero frame (W:%hu R:%hu)", ctx, ctx->ab_write, ctx->ab_read);
 				ctx->data_cb(silence_frame, ctx->frame_size * 4, playtime);
 				ctx->silent_frames++;
+				telemetry_count(&telemetry_silence, 1);
 			}
 		} else if (curframe->ready) {
 			ctx->data_cb((const u8_t*) curframe->data, curframe->len, playtime);
@@ -582,7 +594,8 @@ static void buffer_push_packet(rtp_t *ctx) {
 			frame->last_resend = now;
 		}
 	}
-}
+
+}
 
 
 /*---------------------------------------------------------------------------*/
@@ -816,6 +829,7 @@ static bool rtp_request_resend(rtp_t *ctx, seq_t first, seq_t last) {
 	if (seq_order(last, first) || last - first > buffer_frames / 2) return false;
 	
 	ctx->resent_req += (seq_t) (last - first) + 1;
+	telemetry_count(&telemetry_resent_req, (seq_t) (last - first) + 1);
 
 	LOG_DEBUG("resend request [W:%hu R:%hu first=%hu last=%hu]", ctx->ab_write, ctx->ab_read, first, last);
 
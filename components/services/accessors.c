@@ -321,6 +321,18 @@ esp_err_t config_adcout_set(adcout_struct_t * adcout){
 			snprintf(config_buffer2,buffer_size,"%s,fmt=%u",config_buffer, adcout->fmt);
 			strcpy(config_buffer,config_buffer2);		
 		}
+		if (adcout->ptime > 0) {
+			snprintf(config_buffer2,buffer_size,"%s,ptime=%u",config_buffer, adcout->ptime);
+			strcpy(config_buffer,config_buffer2);		
+		}
+		if (adcout->frame > 0) {
+			snprintf(config_buffer2,buffer_size,"%s,frame=%u",config_buffer, adcout->frame);
+			strcpy(config_buffer,config_buffer2);		
+		}
+		if (adcout->bitrate > 0) {
+			snprintf(config_buffer2,buffer_size,"%s,bitrate=%u",config_buffer, adcout->bitrate);
+			strcpy(config_buffer,config_buffer2);		
+		}
 		log_send_messaging(MESSAGING_INFO,"Updating adc output configuration to %s",config_buffer);
 		err = config_set_value(NVS_TYPE_STR, "adc_stream", config_buffer);
 		if(err!=ESP_OK){
@@ -801,6 +813,9 @@ const adcout_struct_t * config_adcout_get() {
 		PARSE_PARAM(config, "port", '=', adcout.port);
 		PARSE_PARAM(config, "ch", '=', adcout.ch);
 		PARSE_PARAM(config, "fmt", '=', adcout.fmt);
+		PARSE_PARAM(config, "ptime", '=', adcout.ptime);
+		PARSE_PARAM(config, "frame", '=', adcout.frame);
+		PARSE_PARAM(config, "bitrate", '=', adcout.bitrate);
 		free(config);
 	}
 	return &adcout;
@@ -101,6 +101,9 @@ typedef struct {
 	int port;
 	int ch;
 	int fmt;
+	int ptime;
+	int frame;
+	int bitrate;
 } adcout_struct_t;
 #endif
 typedef struct {
@@ -15,92 +15,80 @@
 #include "platform_esp32.h"
 #include "messaging.h"
 #include "tools.h"
+#include "freertos/semphr.h"
+#include <sys/param.h>
 /************************************
  * Globals
  */
 
 const static char tag[] = "messaging";
+
+/*
+ All messages go to a single log of reference counted entries, each subscriber only
+ has a read cursor. Posting is one allocation and one format, whatever the number of
+ subscribers. Log keeps the latest MESSAGING_LOG_SIZE messages (and no more than
+ MESSAGING_LOG_BYTES) so late subscribers still get recent history. Readers take a
+ reference under the lock and format outside of it.
+*/
+#define MESSAGING_LOG_SIZE	16
+#define MESSAGING_LOG_BYTES	(32*1024)
+
 typedef struct {
+	uint32_t refs;
+	time_t sent_time;
+	messaging_types type;
+	messaging_classes msg_class;
+	size_t msg_size;
+	char message[];
+} messaging_entry_t;
+
+typedef struct messaging_list_t {
 	struct messaging_list_t * next;
 	char * subscriber_name;
 	size_t max_count;
-	RingbufHandle_t buf_handle;
+	uint32_t cursor;
 } messaging_list_t;
-static messaging_list_t top;
-#define MSG_LENGTH_AVG 1024
 
-messaging_list_t * get_struct_ptr(messaging_handle_t handle){
-	return (messaging_list_t *)handle;
-}
-messaging_handle_t  get_handle_ptr(messaging_list_t * handle){
-	return (messaging_handle_t )handle;
-}
+static struct {
+	messaging_entry_t * entries[MESSAGING_LOG_SIZE];
+	uint32_t head, tail;
+	size_t bytes;
+	SemaphoreHandle_t mutex;
+	messaging_list_t * subscribers;
+} messaging_log;
 
-RingbufHandle_t messaging_create_ring_buffer(uint8_t max_count){
-	RingbufHandle_t buf_handle = NULL;
-	StaticRingbuffer_t *buffer_struct = malloc_init_external(sizeof(StaticRingbuffer_t));
-	if (buffer_struct != NULL) {
-		size_t buf_size = (size_t )(sizeof(single_message_t)+8+MSG_LENGTH_AVG)*(size_t )(max_count>0?max_count:5); // no-split buffer requires an additional 8 bytes
-		buf_size = buf_size - (buf_size % 4);
-		uint8_t *buffer_storage = (uint8_t *)heap_caps_malloc(buf_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_32BIT);
-		if (buffer_storage== NULL) {
-			ESP_LOGE(tag,"buff alloc failed");
-		}
-		else {
-			buf_handle = xRingbufferCreateStatic(buf_size, RINGBUF_TYPE_NOSPLIT, buffer_storage, buffer_struct);
-		}
-	}
-	else {
-		ESP_LOGE(tag,"ringbuf alloc failed");
+static void messaging_release(messaging_entry_t * entry){
+	if(entry && __atomic_sub_fetch(&entry->refs, 1, __ATOMIC_ACQ_REL) == 0){
+		free(entry);
 	}
-	return buf_handle;
 }
-void messaging_fill_messages(messaging_list_t * target_subscriber){
-	single_message_t * message=NULL;
-    UBaseType_t uxItemsWaiting;
 
-    vRingbufferGetInfo(top.buf_handle, NULL, NULL, NULL, NULL, &uxItemsWaiting);
-    for(size_t i=0;i<uxItemsWaiting;i++){
-    	message= messaging_retrieve_message(top.buf_handle);
-    	if(message){
-			//re-post to original queue so it is available to future subscribers
-			messaging_post_to_queue(get_handle_ptr(&top), message, message->msg_size);
-			// post to new subscriber
-			messaging_post_to_queue(get_handle_ptr(target_subscriber) , message, message->msg_size);
-			FREE_AND_NULL(message);
-    	}
-    }
-}
 messaging_handle_t messaging_register_subscriber(uint8_t max_count, char * name){
-	messaging_list_t * cur=&top;
-	while(cur->next){
-		cur = get_struct_ptr(cur->next);
+	if(!messaging_log.mutex){
+		ESP_LOGE(tag,"messaging service not initialized");
+		return NULL;
 	}
-	cur->next=malloc_init_external(sizeof(messaging_list_t));
-	if(!cur->next){
+	messaging_list_t * subscriber = malloc_init_external(sizeof(messaging_list_t));
+	if(!subscriber){
 		ESP_LOGE(tag,"subscriber alloc failed");
 		return NULL;
 	}
-	memset(cur->next,0x00,sizeof(messaging_list_t));
-	cur = get_struct_ptr(cur->next);
-	cur->max_count=max_count;
-	cur->subscriber_name=strdup_psram(name);
-	cur->buf_handle = messaging_create_ring_buffer(max_count);
-	if(cur->buf_handle){
-		messaging_fill_messages(cur);
-	}
-	return cur->buf_handle;
+	subscriber->max_count = max_count > 0 ? max_count : 5;
+	subscriber->subscriber_name = strdup_psram(name);
+	xSemaphoreTake(messaging_log.mutex, portMAX_DELAY);
+	// start from what is still in the log, like a queue filled with past messages
+	subscriber->cursor = messaging_log.tail;
+	subscriber->next = messaging_log.subscribers;
+	messaging_log.subscribers = subscriber;
+	xSemaphoreGive(messaging_log.mutex);
+	return subscriber;
 }
+
 void messaging_service_init(){
-	size_t max_count=15;
-	top.buf_handle = messaging_create_ring_buffer(max_count);
-	if(!top.buf_handle){
+	messaging_log.mutex = xSemaphoreCreateMutex();
+	if(!messaging_log.mutex){
 		ESP_LOGE(tag, "messaging service init failed.");
 	}
-	else {
-		top.max_count = max_count;
-		top.subscriber_name = strdup_psram("messaging");
-	}
 	return;
 }
 
@@ -127,81 +115,104 @@ const char * messaging_get_class_desc(messaging_classes msg_class){
 	}
 }
 
-cJSON *  messaging_retrieve_messages(RingbufHandle_t buf_handle){
-	single_message_t * message=NULL;
-	cJSON * json_messages=cJSON_CreateArray();
-	cJSON * json_message=NULL;
-	size_t item_size;
-    UBaseType_t uxItemsWaiting;
-    vRingbufferGetInfo(buf_handle, NULL, NULL, NULL, NULL, &uxItemsWaiting);
-	for(int i = 0;i<uxItemsWaiting;i++){
-		message = (single_message_t *)xRingbufferReceive(buf_handle, &item_size, pdMS_TO_TICKS(50));
-		//Check received data
-		if (message== NULL) {
-			ESP_LOGE(tag,"received null ptr");
-		}
-		else {
-			json_message = cJSON_CreateObject();
-			cJSON_AddStringToObject(json_message, "message", message->message);
-			cJSON_AddStringToObject(json_message, "type", messaging_get_type_desc(message->type));
-			cJSON_AddStringToObject(json_message, "class", messaging_get_class_desc(message->msg_class));
-			cJSON_AddNumberToObject(json_message,"sent_time",message->sent_time);
-			cJSON_AddNumberToObject(json_message,"current_time",esp_timer_get_time() / 1000);
-			cJSON_AddItemToArray(json_messages,json_message);
-			vRingbufferReturnItem(buf_handle, (void *)message);
-		}
+/* Take references on messages not yet read by subscriber, returns how many */
+static size_t messaging_take(messaging_list_t * subscriber, messaging_entry_t ** entries){
+	size_t count = 0;
+	if(!subscriber || !messaging_log.mutex) return 0;
+	xSemaphoreTake(messaging_log.mutex, portMAX_DELAY);
+	uint32_t start = subscriber->cursor;
+	// messages that fell off the log or subscriber's depth are lost, as in a full queue
+	if((int32_t)(messaging_log.tail - start) > 0) start = messaging_log.tail;
+	if(messaging_log.head - start > subscriber->max_count) start = messaging_log.head - subscriber->max_count;
+	for(uint32_t seq = start; seq != messaging_log.head; seq++){
+		entries[count] = messaging_log.entries[seq % MESSAGING_LOG_SIZE];
+		__atomic_add_fetch(&entries[count]->refs, 1, __ATOMIC_ACQ_REL);
+		count++;
 	}
-	return json_messages;
+	subscriber->cursor = messaging_log.head;
+	xSemaphoreGive(messaging_log.mutex);
+	return count;
 }
-single_message_t *  messaging_retrieve_message(RingbufHandle_t buf_handle){
-	single_message_t * message=NULL;
-	single_message_t * message_copy=NULL;
-	size_t item_size;
-    UBaseType_t uxItemsWaiting;
-    vRingbufferGetInfo(buf_handle, NULL, NULL, NULL, NULL, &uxItemsWaiting);
-	if(uxItemsWaiting>0){
-		message = (single_message_t *)xRingbufferReceive(buf_handle, &item_size, pdMS_TO_TICKS(50));
-		message_copy  = clone_obj_psram(message,item_size);
-		vRingbufferReturnItem(buf_handle, (void *)message);
-	}
-	return message_copy;
+
+size_t messaging_pending(messaging_handle_t subscriber_handle){
+	messaging_list_t * subscriber = subscriber_handle;
+	if(!subscriber || !messaging_log.mutex) return 0;
+	xSemaphoreTake(messaging_log.mutex, portMAX_DELAY);
+	uint32_t start = subscriber->cursor;
+	if((int32_t)(messaging_log.tail - start) > 0) start = messaging_log.tail;
+	size_t pending = MIN(messaging_log.head - start, subscriber->max_count);
+	xSemaphoreGive(messaging_log.mutex);
+	return pending;
 }
 
-esp_err_t messaging_post_to_queue(messaging_handle_t subscriber_handle, single_message_t * message, size_t message_size){
-	size_t item_size=0;
-	messaging_list_t * subscriber=get_struct_ptr(subscriber_handle);
-	if(!subscriber->buf_handle){
-		ESP_LOGE(tag,"post failed: null buffer for %s", str_or_unknown(subscriber->subscriber_name));
-		return ESP_FAIL;
-	}
-	void * pItem=NULL;
-	UBaseType_t res=pdFALSE;
-	while(1){
-		ESP_LOGD(tag,"Attempting to reserve %d bytes for %s",message_size, str_or_unknown(subscriber->subscriber_name));
-		res =  xRingbufferSendAcquire(subscriber->buf_handle, &pItem, message_size, pdMS_TO_TICKS(50));
-		if(res == pdTRUE && pItem){
-			ESP_LOGD(tag,"Reserving complete for %s", str_or_unknown(subscriber->subscriber_name));
-			memcpy(pItem,message,message_size);
-			xRingbufferSendComplete(subscriber->buf_handle, pItem);
-			break;
+/* JSON string escaping, same as cJSON. When out is NULL, only returns length */
+static size_t messaging_json_escape(char * out, const char * in){
+	size_t len = 0;
+	for(const unsigned char * p = (const unsigned char *)in; *p; p++){
+		char esc = 0;
+		switch(*p){
+		case '"': esc = '"'; break;
+		case '\\': esc = '\\'; break;
+		case '\b': esc = 'b'; break;
+		case '\f': esc = 'f'; break;
+		case '\n': esc = 'n'; break;
+		case '\r': esc = 'r'; break;
+		case '\t': esc = 't'; break;
+		default: break;
 		}
-		ESP_LOGD(tag,"Dropping for %s",str_or_unknown(subscriber->subscriber_name));
-		single_message_t * dummy = (single_message_t *)xRingbufferReceive(subscriber->buf_handle, &item_size, pdMS_TO_TICKS(50));
-		if (dummy== NULL) {
-			ESP_LOGE(tag,"Dropping message failed");
-			break;
+		if(esc){
+			if(out){ out[len] = '\\'; out[len+1] = esc; }
+			len += 2;
+		} else if(*p < 32){
+			if(out) sprintf(out + len, "\\u%04x", *p);
+			len += 6;
+		} else {
+			if(out) out[len] = *p;
+			len++;
 		}
-		else {
-			ESP_LOGD(tag,"Dropping message of %d bytes for %s",item_size, str_or_unknown(subscriber->subscriber_name));
-			vRingbufferReturnItem(subscriber->buf_handle, (void *)dummy);
+	}
+	return len;
+}
+
+#define MESSAGING_JSON_HEAD "{\"message\":\""
+#define MESSAGING_JSON_TAIL "\",\"type\":\"%s\",\"class\":\"%s\",\"sent_time\":%lld,\"current_time\":%lld}"
+
+/* Messages not yet read by subscriber as a JSON array, written directly without cJSON tree */
+char * messaging_alloc_messages_json(messaging_handle_t subscriber_handle){
+	messaging_entry_t * entries[MESSAGING_LOG_SIZE];
+	size_t count = messaging_take(subscriber_handle, entries);
+	long long now = esp_timer_get_time() / 1000;
+	size_t size = 3;
+	char * json = NULL;
+
+	for(size_t i = 0; i < count; i++){
+		size += strlen(MESSAGING_JSON_HEAD) + messaging_json_escape(NULL, entries[i]->message) + 1 +
+				snprintf(NULL, 0, MESSAGING_JSON_TAIL, messaging_get_type_desc(entries[i]->type),
+						 messaging_get_class_desc(entries[i]->msg_class), (long long)entries[i]->sent_time, now);
+	}
+
+	json = malloc_init_external(size);
+	if(json){
+		size_t len = 0;
+		json[len++] = '[';
+		for(size_t i = 0; i < count; i++){
+			if(i) json[len++] = ',';
+			len += sprintf(json + len, MESSAGING_JSON_HEAD);
+			len += messaging_json_escape(json + len, entries[i]->message);
+			len += sprintf(json + len, MESSAGING_JSON_TAIL, messaging_get_type_desc(entries[i]->type),
+						   messaging_get_class_desc(entries[i]->msg_class), (long long)entries[i]->sent_time, now);
 		}
+		json[len++] = ']';
+		json[len] = '\0';
 	}
-	if (res != pdTRUE) {
-		ESP_LOGE(tag,"post to %s failed",str_or_unknown(subscriber->subscriber_name));
-		return ESP_FAIL;
+	else {
+		ESP_LOGE(tag,"Unable to allocate %zu bytes for messages", size);
 	}
-	return ESP_OK;
+
+	for(size_t i = 0; i < count; i++) messaging_release(entries[i]);
+	return json;
 }
+
 	esp_err_t messaging_type_to_err_type(messaging_types type){
 		switch (type) {
 		case MESSAGING_INFO:
@@ -228,14 +239,21 @@ void messaging_post_message(messaging_types type,messaging_classes msg_class, co
 }
     
 void vmessaging_post_message(messaging_types type,messaging_classes msg_class, const char *fmt, va_list va){    
-	single_message_t * message=NULL;
+	messaging_entry_t * message=NULL;
 	size_t msg_size=0;
 	size_t ln =0;
-	messaging_list_t * cur=&top;
-	ln = vsnprintf(NULL, 0, fmt, va)+1;
-	msg_size = sizeof(single_message_t)+ln;
-	message = (single_message_t *)malloc_init_external(msg_size);
+	va_list args;
+	va_copy(args, va);
+	ln = vsnprintf(NULL, 0, fmt, args)+1;
+	va_end(args);
+	msg_size = sizeof(messaging_entry_t)+ln;
+	message = (messaging_entry_t *)malloc_init_external(msg_size);
+	if(!message){
+		ESP_LOGE(tag, "Memory allocation failed while sending message");
+		return;
+	}
 	vsprintf(message->message, fmt, va);
+	message->refs = 1;
 	message->msg_size = msg_size;
 	message->type = type;
 	message->msg_class = msg_class;
@@ -250,11 +268,23 @@ void vmessaging_post_message(messaging_types type,messaging_classes msg_class, c
 		ESP_LOGD(tag,"Post: %s",message->message);
 	}
 
-	while(cur){
-		messaging_post_to_queue(get_handle_ptr(cur),  message, msg_size);
-		cur = get_struct_ptr(cur->next);
+	if(!messaging_log.mutex){
+		ESP_LOGE(tag,"post failed: messaging service not initialized");
+		free(message);
+		return;
+	}
+
+	xSemaphoreTake(messaging_log.mutex, portMAX_DELAY);
+	// make room, readers still holding a dropped message keep it alive
+	while(messaging_log.head != messaging_log.tail &&
+		  (messaging_log.head - messaging_log.tail >= MESSAGING_LOG_SIZE || messaging_log.bytes + msg_size > MESSAGING_LOG_BYTES)){
+		messaging_entry_t * oldest = messaging_log.entries[messaging_log.tail++ % MESSAGING_LOG_SIZE];
+		messaging_log.bytes -= oldest->msg_size;
+		messaging_release(oldest);
 	}
-	FREE_AND_NULL(message);
+	messaging_log.entries[messaging_log.head++ % MESSAGING_LOG_SIZE] = message;
+	messaging_log.bytes += msg_size;
+	xSemaphoreGive(messaging_log.mutex);
 	return;
 
 }
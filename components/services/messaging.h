@@ -22,21 +22,11 @@ typedef enum {
 
 typedef struct messaging_list_t *messaging_handle_t;
 
-typedef struct {
-	time_t sent_time;
-	messaging_types type;
-	messaging_classes msg_class;
-	size_t msg_size;
-	char message[];
-} single_message_t;
-
-cJSON *  messaging_retrieve_messages(RingbufHandle_t buf_handle);
 messaging_handle_t messaging_register_subscriber(uint8_t max_count, char * name);
-esp_err_t messaging_post_to_queue(messaging_handle_t subscriber_handle, single_message_t * message, size_t message_size);
 void messaging_post_message(messaging_types type,messaging_classes msg_class, const char * fmt, ...);
 void vmessaging_post_message(messaging_types type,messaging_classes msg_class, const char *fmt, va_list va);
-cJSON *  messaging_retrieve_messages(RingbufHandle_t buf_handle);
-single_message_t *  messaging_retrieve_message(RingbufHandle_t buf_handle);
+size_t messaging_pending(messaging_handle_t subscriber_handle);
+char * messaging_alloc_messages_json(messaging_handle_t subscriber_handle);
 void log_send_messaging(messaging_types msgtype,const char *fmt, ...);
 void cmd_send_messaging(const char * cmdname,messaging_types msgtype, const char *fmt, ...);
 esp_err_t messaging_type_to_err_type(messaging_types type);
@@ -25,11 +25,13 @@
 #include "messaging.h"
 #include "cJSON.h"
 #include "tools.h"
+#include "telemetry.h"
+#include "scheduler.h"
 
 #define PSEUDO_IDLE_STACK_SIZE	(6*1024)
 
 #define MONITOR_TIMER	(10*1000)
-#define SCRATCH_SIZE	256
+#define MONITOR_SPARE_TASKS	16
 
 static const char *TAG = "monitor";
 
@@ -45,78 +47,230 @@ static monitor_gpio_t jack = { CONFIG_JACK_GPIO, 0 };
 static monitor_gpio_t spkfault = { CONFIG_SPKFAULT_GPIO, 0 };
 static bool monitor_stats;
 
-/****************************************************************************************
- *
- */
-static void task_stats( cJSON* top ) {
+/*
+ Profiling is always on: every MONITOR_TIMER a binary sample is taken into one of two
+ preallocated buffers and published with a sequence counter, so nothing is allocated
+ or formatted. JSON is only built when somebody asks (stats option, console, web...)
+ Task load and idle are in per-mille of elapsed run time.
+*/
+enum { HEAP_INTERNAL, HEAP_SPIRAM, HEAP_DMA, HEAP_COUNT };
+static const uint32_t heap_caps[HEAP_COUNT] = { MALLOC_CAP_INTERNAL, MALLOC_CAP_SPIRAM, MALLOC_CAP_DMA };
+
+typedef struct {
+	char name[configMAX_TASK_NAME_LEN];
+	uint32_t stack;
+	uint16_t num, load;
+	uint8_t state, bprio, cprio;
+} monitor_task_t;
+
+typedef struct {
+	uint32_t time;
+	uint16_t idle[portNUM_PROCESSORS];
+	struct {
+		uint32_t free, min_free, largest;
+	} heap[HEAP_COUNT];
+	uint16_t ntasks;
+	monitor_task_t tasks[];
+} monitor_sample_t;
+
+static struct {
+	monitor_sample_t *samples[2];
+	uint32_t seq, front, size, capacity;
 #ifdef CONFIG_FREERTOS_USE_TRACE_FACILITY
-#pragma message("Compiled with trace facility")
-	static struct {
+	struct {
 		TaskStatus_t *tasks;
 		uint32_t total, n;
-	} current, previous;
-    
-	cJSON * tlist=cJSON_CreateArray();
-	current.n = uxTaskGetNumberOfTasks();
-	current.tasks = malloc_init_external( current.n * sizeof( TaskStatus_t ) );
-	current.n = uxTaskGetSystemState( current.tasks, current.n, &current.total );
-	cJSON_AddNumberToObject(top,"ntasks",current.n);
+	} status[2];
+	uint32_t current;
+#endif
+} profiler;
 
-	char scratch[SCRATCH_SIZE] = { };
+static TELEMETRY_GAUGE_DEFINE(telemetry_idle0, "cpu.idle0");
+#if portNUM_PROCESSORS > 1
+static TELEMETRY_GAUGE_DEFINE(telemetry_idle1, "cpu.idle1");
+#endif
+static TELEMETRY_GAUGE_DEFINE(telemetry_largest, "heap.largest_internal");
 
-#ifdef CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
-#pragma message("Compiled with runtime stats")
-	uint32_t elapsed = current.total - previous.total;
-
-	for(int i = 0, n = 0; i < current.n; i++ ) {
-		for (int j = 0; j < previous.n; j++) {
-			if (current.tasks[i].xTaskNumber == previous.tasks[j].xTaskNumber) {
-				n += snprintf(scratch + n, SCRATCH_SIZE - n, "%16s (%u) %2u%% s:%5u", current.tasks[i].pcTaskName,
-																		   current.tasks[i].eCurrentState,
-																		   100 * (current.tasks[i].ulRunTimeCounter - previous.tasks[j].ulRunTimeCounter) / elapsed,
-																		   current.tasks[i].usStackHighWaterMark);
-				cJSON * t=cJSON_CreateObject();
-				cJSON_AddNumberToObject(t,"cpu",100 * (current.tasks[i].ulRunTimeCounter - previous.tasks[j].ulRunTimeCounter) / elapsed);
-				cJSON_AddNumberToObject(t,"minstk",current.tasks[i].usStackHighWaterMark);
-				cJSON_AddNumberToObject(t,"bprio",current.tasks[i].uxBasePriority);
-				cJSON_AddNumberToObject(t,"cprio",current.tasks[i].uxCurrentPriority);
-				cJSON_AddStringToObject(t,"nme",current.tasks[i].pcTaskName);
-				cJSON_AddNumberToObject(t,"st",current.tasks[i].eCurrentState);
-				cJSON_AddNumberToObject(t,"num",current.tasks[i].xTaskNumber);
-				cJSON_AddItemToArray(tlist,t);
-				if (i % 3 == 2 || i == current.n - 1) {
-					ESP_LOGI(TAG, "%s", scratch);
-					n = 0;
-				}
-				break;
-			}
+/****************************************************************************************
+ * Allocate sampling buffers once, with room for tasks created later
+ */
+static bool profiler_init(void) {
+#ifdef CONFIG_FREERTOS_USE_TRACE_FACILITY
+	profiler.capacity = uxTaskGetNumberOfTasks() + MONITOR_SPARE_TASKS;
+#endif
+	profiler.size = sizeof(monitor_sample_t) + profiler.capacity * sizeof(monitor_task_t);
+
+	for (int i = 0; i < 2; i++) {
+		profiler.samples[i] = malloc_init_external(profiler.size);
+#ifdef CONFIG_FREERTOS_USE_TRACE_FACILITY
+		profiler.status[i].tasks = malloc_init_external(profiler.capacity * sizeof(TaskStatus_t));
+		if (!profiler.status[i].tasks) return false;
+#endif
+		if (!profiler.samples[i]) return false;
+	}
+
+	return true;
+}
+
+/****************************************************************************************
+ * Fill tasks and per-core idle of a sample
+ */
+static void profiler_tasks(monitor_sample_t *sample) {
+#ifdef CONFIG_FREERTOS_USE_TRACE_FACILITY
+	uint32_t n = uxTaskGetNumberOfTasks();
+
+	// very unlikely, only status list must grow as samples just won't show extra tasks
+	if (n > profiler.capacity) {
+		for (int i = 0; i < 2; i++) {
+			free(profiler.status[i].tasks);
+			profiler.status[i].tasks = malloc_init_external((n + MONITOR_SPARE_TASKS) * sizeof(TaskStatus_t));
+			profiler.status[i].n = 0;
 		}
+		profiler.capacity = n + MONITOR_SPARE_TASKS;
 	}
-#else
-#pragma message("Compiled WITHOUT runtime stats")
-
-	for (int i = 0, n = 0; i < current.n; i ++) {
-		n += sprintf(scratch + n, "%16s s:%5u\t", current.tasks[i].pcTaskName, current.tasks[i].usStackHighWaterMark);
-		cJSON * t=cJSON_CreateObject();
-		cJSON_AddNumberToObject(t,"minstk",current.tasks[i].usStackHighWaterMark);
-		cJSON_AddNumberToObject(t,"bprio",current.tasks[i].uxBasePriority);
-		cJSON_AddNumberToObject(t,"cprio",current.tasks[i].uxCurrentPriority);
-		cJSON_AddStringToObject(t,"nme",current.tasks[i].pcTaskName);
-		cJSON_AddNumberToObject(t,"st",current.tasks[i].eCurrentState);
-		cJSON_AddNumberToObject(t,"num",current.tasks[i].xTaskNumber);
-		cJSON_AddItemToArray(tlist,t);
-		if (i % 3 == 2 || i == current.n - 1) {
-			ESP_LOGI(TAG, "%s", scratch);
-			n = 0;
+
+	typeof(profiler.status[0]) *current = profiler.status + profiler.current;
+	typeof(profiler.status[0]) *previous = profiler.status + !profiler.current;
+	uint32_t max = (profiler.size - sizeof(monitor_sample_t)) / sizeof(monitor_task_t);
+
+	current->n = current->tasks ? uxTaskGetSystemState(current->tasks, profiler.capacity, &current->total) : 0;
+	sample->ntasks = 0;
+
+#ifdef CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+	uint32_t elapsed = current->total - previous->total;
+	TaskHandle_t idle[portNUM_PROCESSORS];
+	for (int core = 0; core < portNUM_PROCESSORS; core++) idle[core] = xTaskGetIdleTaskHandleForCPU(core);
+#endif
+
+	for (int i = 0, j = 0; i < current->n && sample->ntasks < max; i++) {
+		TaskStatus_t *task = current->tasks + i;
+		monitor_task_t *out = sample->tasks + sample->ntasks++;
+
+		strlcpy(out->name, task->pcTaskName, sizeof(out->name));
+		out->stack = task->usStackHighWaterMark;
+		out->num = task->xTaskNumber;
+		out->state = task->eCurrentState;
+		out->bprio = task->uxBasePriority;
+		out->cprio = task->uxCurrentPriority;
+		out->load = 0;
+
+#ifdef CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+		// order rarely changes, so try where we left off first
+		for (int k = 0; k < previous->n && elapsed; k++, j = (j + 1) % previous->n) {
+			if (previous->tasks[j].xTaskNumber != task->xTaskNumber) continue;
+			out->load = 1000ULL * (task->ulRunTimeCounter - previous->tasks[j].ulRunTimeCounter) / elapsed;
+			for (int core = 0; core < portNUM_PROCESSORS; core++) if (task->xHandle == idle[core]) sample->idle[core] = out->load;
+			break;
 		}
+#endif
 	}
+
+	profiler.current = !profiler.current;
 #endif
-	cJSON_AddItemToObject(top,"tasks",tlist);
-	if (previous.tasks) free(previous.tasks);
-	previous = current;
-#else
-#pragma message("Compiled WITHOUT trace facility")
+}
+
+/****************************************************************************************
+ * Take a sample in the back buffer and make it the front one
+ */
+static void profiler_sample(uint32_t now) {
+	monitor_sample_t *sample = profiler.samples[!profiler.front];
+
+	if (!profiler.samples[0] || !sample) return;
+
+	// odd sequence tells readers a sample is being written
+	__atomic_add_fetch(&profiler.seq, 1, __ATOMIC_ACQ_REL);
+
+	sample->time = now;
+	memset(sample->idle, 0, sizeof(sample->idle));
+	for (int i = 0; i < HEAP_COUNT; i++) {
+		sample->heap[i].free = heap_caps_get_free_size(heap_caps[i]);
+		sample->heap[i].min_free = heap_caps_get_minimum_free_size(heap_caps[i]);
+		sample->heap[i].largest = heap_caps_get_largest_free_block(heap_caps[i]);
+	}
+	profiler_tasks(sample);
+	profiler.front = !profiler.front;
+
+	__atomic_add_fetch(&profiler.seq, 1, __ATOMIC_ACQ_REL);
+
+	telemetry_gauge(&telemetry_idle0, sample->idle[0], 1000);
+#if portNUM_PROCESSORS > 1
+	telemetry_gauge(&telemetry_idle1, sample->idle[1], 1000);
+#endif
+	telemetry_gauge(&telemetry_largest, sample->heap[HEAP_INTERNAL].largest, sample->heap[HEAP_INTERNAL].free);
+}
+
+/****************************************************************************************
+ * Convert latest sample into JSON
+ */
+static cJSON* profiler_get_json(const monitor_sample_t *sample) {
+	static const char *heap_names[HEAP_COUNT] = { "iram", "spiram", "dma" };
+	char key[24];
+	cJSON *top = cJSON_CreateObject();
+
+	cJSON_AddNumberToObject(top, "time", sample->time);
+	for (int i = 0; i < HEAP_COUNT; i++) {
+		snprintf(key, sizeof(key), "free_%s", heap_names[i]);
+		cJSON_AddNumberToObject(top, key, sample->heap[i].free);
+		snprintf(key, sizeof(key), "min_free_%s", heap_names[i]);
+		cJSON_AddNumberToObject(top, key, sample->heap[i].min_free);
+		snprintf(key, sizeof(key), "largest_%s", heap_names[i]);
+		cJSON_AddNumberToObject(top, key, sample->heap[i].largest);
+	}
+
+#ifdef CONFIG_FREERTOS_USE_TRACE_FACILITY
+	cJSON *idle = cJSON_AddArrayToObject(top, "idle");
+	for (int core = 0; core < portNUM_PROCESSORS; core++) cJSON_AddItemToArray(idle, cJSON_CreateNumber(sample->idle[core] / 10.0));
+
+	cJSON_AddNumberToObject(top, "ntasks", sample->ntasks);
+	cJSON *tlist = cJSON_AddArrayToObject(top, "tasks");
+	for (int i = 0; i < sample->ntasks; i++) {
+		const monitor_task_t *task = sample->tasks + i;
+		cJSON *t = cJSON_CreateObject();
+#ifdef CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+		cJSON_AddNumberToObject(t, "cpu", task->load / 10.0);
 #endif
+		cJSON_AddNumberToObject(t, "minstk", task->stack);
+		cJSON_AddNumberToObject(t, "bprio", task->bprio);
+		cJSON_AddNumberToObject(t, "cprio", task->cprio);
+		cJSON_AddStringToObject(t, "nme", task->name);
+		cJSON_AddNumberToObject(t, "st", task->state);
+		cJSON_AddNumberToObject(t, "num", task->num);
+		cJSON_AddItemToArray(tlist, t);
+	}
+#endif
+
+	return top;
+}
+
+/****************************************************************************************
+ * Latest profile as JSON, NULL if none has been taken yet
+ */
+static cJSON* monitor_get_stats_json(void) {
+	cJSON *json = NULL;
+	uint32_t seq;
+
+	if (!profiler.samples[0]) return NULL;
+
+	// sample may be overwritten while we read it (only when reader stalls for a full period)
+	do {
+		cJSON_Delete(json);
+		while ((seq = __atomic_load_n(&profiler.seq, __ATOMIC_ACQUIRE)) & 0x01) vTaskDelay(1);
+		if (!seq) return NULL;
+		json = profiler_get_json(profiler.samples[profiler.front]);
+	} while (seq != __atomic_load_n(&profiler.seq, __ATOMIC_ACQUIRE));
+
+	return json;
+}
+
+/****************************************************************************************
+ *
+ */
+char* monitor_alloc_stats_json(void) {
+	cJSON *json = monitor_get_stats_json();
+	if (!json) return NULL;
+	char *text = cJSON_PrintUnformatted(json);
+	cJSON_Delete(json);
+	return text;
 }
 
 /****************************************************************************************
@@ -128,21 +282,28 @@ static void monitor_trace(uint32_t now) {
     if (now < last + MONITOR_TIMER) return;
     last = now;
 
-	cJSON * top=cJSON_CreateObject();
-	cJSON_AddNumberToObject(top,"free_iram",heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
-	cJSON_AddNumberToObject(top,"min_free_iram",heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
-	cJSON_AddNumberToObject(top,"free_spiram",heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
-	cJSON_AddNumberToObject(top,"min_free_spiram",heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM));
+	profiler_sample(now);
 
-	ESP_LOGI(TAG, "Heap internal:%zu (min:%zu) external:%zu (min:%zu) dma:%zu (min:%zu)",
-			heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
-			heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
-			heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
-			heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM),
-			heap_caps_get_free_size(MALLOC_CAP_DMA),
-			heap_caps_get_minimum_free_size(MALLOC_CAP_DMA));
+	// only stats option wants JSON, with pipeline metrics whose min/max are over MONITOR_TIMER
+	if (!monitor_stats) {
+		telemetry_reset_window();
+		return;
+	}
 
-	task_stats(top);
+	cJSON *top = monitor_get_stats_json();
+	if (!top) {
+		telemetry_reset_window();
+		return;
+	}
+
+	const monitor_sample_t *sample = profiler.samples[profiler.front];
+	ESP_LOGI(TAG, "Heap internal:%u (min:%u, largest:%u) external:%u (min:%u, largest:%u) idle:%u.%u%%",
+			sample->heap[HEAP_INTERNAL].free, sample->heap[HEAP_INTERNAL].min_free, sample->heap[HEAP_INTERNAL].largest,
+			sample->heap[HEAP_SPIRAM].free, sample->heap[HEAP_SPIRAM].min_free, sample->heap[HEAP_SPIRAM].largest,
+			sample->idle[0] / 10, sample->idle[0] % 10);
+
+	cJSON_AddItemToObject(top, "telemetry", telemetry_get_json());
+	telemetry_reset_window();
 	char * top_a= cJSON_PrintUnformatted(top);
 	if(top_a){
 		messaging_post_message(MESSAGING_INFO, MESSAGING_CLASS_STATS,top_a);
@@ -224,7 +385,7 @@ static void pseudo_idle(void *arg) {
         vTaskDelay(pdMS_TO_TICKS(1000));
         uint32_t now = pdTICKS_TO_MS(xTaskGetTickCount());
 
-        if (monitor_stats) monitor_trace(now);
+        monitor_trace(now);
         if (pseudo_idle_svc) pseudo_idle_svc(now);
     }
 }
@@ -276,11 +437,15 @@ void monitor_svc_init(void) {
 			heap_caps_get_free_size(MALLOC_CAP_DMA),
 			heap_caps_get_minimum_free_size(MALLOC_CAP_DMA));
 
+	if (!profiler_init()) ESP_LOGE(TAG, "Unable to allocate profiler");
+
     // pseudo-idle callback => don't use FreeRTOS idle callbacks so we can block (should not but ...)
 	StaticTask_t* xTaskBuffer = (StaticTask_t*) heap_caps_malloc(sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
 	static EXT_RAM_ATTR StackType_t xStack[PSEUDO_IDLE_STACK_SIZE] __attribute__ ((aligned (4)));
-	xTaskCreateStatic( (TaskFunction_t) pseudo_idle, "pseudo_idle", PSEUDO_IDLE_STACK_SIZE,
-						NULL, ESP_TASK_PRIO_MIN, xStack, xTaskBuffer );
+	sched_profile_t sched;
+	sched_get("pseudo_idle", &sched);
+	xTaskCreateStaticPinnedToCore( (TaskFunction_t) pseudo_idle, "pseudo_idle", PSEUDO_IDLE_STACK_SIZE,
+						NULL, sched.priority, xStack, xTaskBuffer, sched.core );
 }
 
 /****************************************************************************************
@@ -0,0 +1,106 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "esp_log.h"
+#include "esp_task.h"
+#include "platform_config.h"
+#include "scheduler.h"
+
+/*
+ Audio pipeline (decode, output, AirPlay and line-in capture) owns the APP CPU and output
+ always preempts decode so that it can refill DMA as soon as a buffer is free. Network, UI and metrics share
+ the PRO CPU with WiFi and lwIP. Each entry can be changed with NVS "task_profile" set
+ to <name>=<core>:<priority>[:<stack>],... where core is 0, 1 or x (not pinned).
+*/
+
+static const char TAG[] = "scheduler";
+
+static const sched_profile_t profiles[] = {
+	// audio pipeline
+	{ "output_i2s",       1, CONFIG_ESP32_PTHREAD_TASK_PRIO_DEFAULT + 2 },
+	{ "decode",           1, CONFIG_ESP32_PTHREAD_TASK_PRIO_DEFAULT + 1 },
+	{ "RTP_thread",       1, CONFIG_ESP32_PTHREAD_TASK_PRIO_DEFAULT + 1 },
+	{ "ADC",              1, ESP_TASK_PRIO_MIN + 2 },
+	{ "ADC_enc",          1, ESP_TASK_PRIO_MIN + 1 },
+	// network
+	{ "stream",           0, CONFIG_ESP32_PTHREAD_TASK_PRIO_DEFAULT },
+	{ "httpd",            0, ESP_TASK_PRIO_MIN },
+	{ "http_events",      0, ESP_TASK_PRIO_MIN },
+	{ "telnet",           0, ESP_TASK_PRIO_MIN },
+	// UI
+	{ "sb_displayer",     0, ESP_TASK_PRIO_MIN + 1 },
+	{ "common_displayer", 0, ESP_TASK_PRIO_MIN + 1 },
+	{ "led_vu_fx",        0, ESP_TASK_PRIO_MIN + 1 },
+	// metrics
+	{ "pseudo_idle",      0, ESP_TASK_PRIO_MIN },
+};
+
+/****************************************************************************************
+ * Find "<name>=" as a whole item of the NVS string and parse what follows
+ */
+static void sched_overload(const char *config, sched_profile_t *profile) {
+	size_t len = strlen(profile->name);
+
+	for (const char *p = config; (p = strstr(p, profile->name)) != NULL; p += len) {
+		if ((p != config && p[-1] != ',' && !isspace((int) p[-1])) || p[len] != '=') continue;
+
+		char *end;
+		p += len + 1;
+		if (*p == 'x' || *p == 'X') {
+			profile->core = tskNO_AFFINITY;
+			end = (char*) p + 1;
+		} else {
+			long core = strtol(p, &end, 10);
+			if (end == p) break;
+			profile->core = core < 0 ? tskNO_AFFINITY : core;
+		}
+		if (*end++ != ':') break;
+		profile->priority = strtoul(end, &end, 10);
+		if (*end == ':') profile->stack = strtoul(end + 1, NULL, 10);
+
+		ESP_LOGI(TAG, "task %s overloaded with core:%d priority:%u stack:%u", profile->name,
+				 profile->core == tskNO_AFFINITY ? -1 : profile->core, (unsigned) profile->priority, (unsigned) profile->stack);
+		break;
+	}
+}
+
+/****************************************************************************************
+ * Task creation is rare enough to read NVS each time, so that changes apply at next restart
+ * of a task and it can be used before config is initialized
+ */
+bool sched_get(const char *name, sched_profile_t *profile) {
+	bool found = false;
+
+	*profile = (sched_profile_t) { name, tskNO_AFFINITY, ESP_TASK_PRIO_MIN + 1, 0 };
+
+	for (int i = 0; i < sizeof(profiles) / sizeof(*profiles); i++) {
+		if (strcmp(name, profiles[i].name)) continue;
+		*profile = profiles[i];
+		found = true;
+		break;
+	}
+
+	if (!found) ESP_LOGW(TAG, "no profile for task %s", name);
+
+	char *config = config_alloc_get_str("task_profile", NULL, NULL);
+	if (config) {
+		sched_overload(config, profile);
+		free(config);
+	}
+
+	// keep it sane, including on single core chips
+	if (profile->core != tskNO_AFFINITY && profile->core >= portNUM_PROCESSORS) profile->core = portNUM_PROCESSORS - 1;
+	if (profile->priority >= configMAX_PRIORITIES) profile->priority = configMAX_PRIORITIES - 1;
+
+	return found;
+}
@@ -0,0 +1,36 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+	const char *name;
+	BaseType_t core;		// tskNO_AFFINITY when not pinned
+	UBaseType_t priority;
+	uint32_t stack;			// 0 leaves it to the creator, ignored for static stacks
+} sched_profile_t;
+
+/*
+ Returns the profile of a task, from the built-in table overloaded by NVS "task_profile".
+ Unknown tasks get an unpinned low priority profile and false is returned
+*/
+bool sched_get(const char *name, sched_profile_t *profile);
+
+#ifdef __cplusplus
+}
+#endif
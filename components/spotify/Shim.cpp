@@ -88,7 +88,17 @@ cspotPlayer::cspotPlayer(const char* name, httpd_handle_t server, int port, cspo
                         serverHandle(server), serverPort(port),
                         cmdHandler(cmdHandler), dataHandler(dataHandler) {
 
-    cJSON *item, *config = config_alloc_get_cjson("cspot_config");
+    const cJSON *item, *config;
+
+    // without configuration, run with defaults and don't touch what we could not read
+    if (!config_view_lock()) {
+        CSPOT_LOG(error, "can't lock configuration, using defaults");
+        this->name = name;
+        zeroConf = true;
+        return;
+    }
+
+    config = config_get_cjson_view("cspot_config");
     if ((item = cJSON_GetObjectItem(config, "volume")) != NULL) volume = item->valueint;
     if ((item = cJSON_GetObjectItem(config, "bitrate")) != NULL) bitrate = item->valueint;   
     if ((item = cJSON_GetObjectItem(config, "deviceName") ) != NULL) this->name = item->valuestring;
@@ -96,11 +106,14 @@ cspotPlayer::cspotPlayer(const char* name, httpd_handle_t server, int port, cspo
     
     if ((item = cJSON_GetObjectItem(config, "zeroConf")) != NULL) {
         zeroConf = item->valueint;
-        cJSON_Delete(config);
+        config_view_unlock();
     } else {
+        // only take a copy when we have to update it
+        cJSON *update = config ? cJSON_Duplicate(config, true) : cJSON_CreateObject();
+        config_view_unlock();
         zeroConf = true;
-        cJSON_AddNumberToObject(config, "zeroConf", 1);
-        config_set_cjson_str_and_free("cspot_config", config);
+        cJSON_AddNumberToObject(update, "zeroConf", 1);
+        config_set_cjson_str_and_free("cspot_config", update);
     }
     
     // get optional credentials from own NVS
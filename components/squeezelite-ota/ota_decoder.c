@@ -0,0 +1,452 @@
+/*
+ * ota_decoder.c
+ *
+ * Decodes compressed (gzip/zlib) and delta OTA images on the fly, so that they can
+ * be streamed into the OTA partition like a raw image
+ * - compression is detected from the first bytes, raw images start with 0xE9
+ * - inflate uses the ROM tinfl with a 32kB dictionary, nothing is buffered beyond
+ * - delta patches the image of the partition being written in place (see header)
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "esp_log.h"
+#include "esp_spi_flash.h"
+#include "esp_rom_crc.h"
+#include "mbedtls/sha256.h"
+#include "sdkconfig.h"
+#if CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/miniz.h"
+#else
+#include "esp32/rom/miniz.h"
+#endif
+#include "ota_decoder.h"
+
+#define DECODER_IN_SIZE			4096
+#define DECODER_MAX_WINDOW		(1024*1024)
+#define GZIP_FHCRC				0x02
+#define GZIP_FEXTRA				0x04
+#define GZIP_FNAME				0x08
+#define GZIP_FCOMMENT			0x10
+
+static const char TAG[] = "ota_decoder";
+
+struct ota_decoder_s {
+	ota_source_t source;
+	uint8_t format;
+	// raw input
+	uint8_t *in;
+	size_t in_pos, in_len;
+	bool eof;
+	// inflate
+	tinfl_decompressor *inflator;
+	uint8_t *dict;
+	size_t dict_pos, dict_avail;
+	bool inflated;
+	uint32_t crc, size;
+	// bytes read ahead for detection and handed back to plain reader
+	uint8_t head[4];
+	size_t head_pos, head_len;
+	// delta
+	struct {
+		const esp_partition_t *base;
+		uint32_t src_len, dst_len, written;
+		uint8_t op;
+		uint32_t src, left;
+		bool done;
+		uint8_t *ring;
+		uint32_t window;
+		size_t backup_end;
+	} delta;
+};
+
+static inline uint32_t le32(const uint8_t *p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+/****************************************************************************************
+ * Refill input buffer from source (what has not been consumed is kept)
+ */
+static int source_fill(ota_decoder_t *dec) {
+	if (dec->eof) return 0;
+
+	if (dec->in_pos) {
+		memmove(dec->in, dec->in + dec->in_pos, dec->in_len - dec->in_pos);
+		dec->in_len -= dec->in_pos;
+		dec->in_pos = 0;
+	}
+
+	int len = dec->source(dec->in + dec->in_len, DECODER_IN_SIZE - dec->in_len);
+	if (len < 0) return len;
+	if (len == 0) dec->eof = true;
+	dec->in_len += len;
+	return len;
+}
+
+/****************************************************************************************
+ * Read raw bytes from source, short count only at end of stream
+ */
+static int source_read(ota_decoder_t *dec, uint8_t *buf, size_t len) {
+	size_t done = 0;
+
+	while (done < len) {
+		if (dec->in_pos == dec->in_len) {
+			int err = source_fill(dec);
+			if (err < 0) return err;
+			if (err == 0) break;
+		}
+		size_t n = dec->in_len - dec->in_pos;
+		if (n > len - done) n = len - done;
+		memcpy(buf + done, dec->in + dec->in_pos, n);
+		dec->in_pos += n;
+		done += n;
+	}
+
+	return done;
+}
+
+/****************************************************************************************
+ * Skip gzip header, it has been identified already
+ */
+static bool gzip_header(ota_decoder_t *dec) {
+	uint8_t header[10], c;
+
+	if (source_read(dec, header, sizeof(header)) != sizeof(header) || header[2] != 8) return false;
+
+	if (header[3] & GZIP_FEXTRA) {
+		uint8_t xlen[2];
+		if (source_read(dec, xlen, 2) != 2) return false;
+		for (int n = xlen[0] | (xlen[1] << 8); n; n--) if (source_read(dec, &c, 1) != 1) return false;
+	}
+	if (header[3] & GZIP_FNAME) do { if (source_read(dec, &c, 1) != 1) return false; } while (c);
+	if (header[3] & GZIP_FCOMMENT) do { if (source_read(dec, &c, 1) != 1) return false; } while (c);
+	if (header[3] & GZIP_FHCRC) for (int n = 2; n; n--) if (source_read(dec, &c, 1) != 1) return false;
+
+	return true;
+}
+
+/****************************************************************************************
+ * Verify gzip trailer. The inflator might have looked ahead so first bytes can be
+ * still in its bit buffer
+ */
+static bool gzip_trailer(ota_decoder_t *dec) {
+	uint8_t trailer[8];
+	size_t n = 0;
+	uint32_t bits = dec->inflator->m_num_bits;
+	tinfl_bit_buf_t bit_buf = dec->inflator->m_bit_buf >> (bits & 7);
+
+	for (bits &= ~7; bits && n < sizeof(trailer); bits -= 8, bit_buf >>= 8) trailer[n++] = bit_buf;
+	if (source_read(dec, trailer + n, sizeof(trailer) - n) != sizeof(trailer) - n) return false;
+
+	if (le32(trailer) != dec->crc || le32(trailer + 4) != dec->size) {
+		ESP_LOGE(TAG, "gzip trailer mismatch crc:%08x/%08x size:%u/%u", le32(trailer), dec->crc, le32(trailer + 4), dec->size);
+		return false;
+	}
+	return true;
+}
+
+/****************************************************************************************
+ * Read decompressed bytes, short count only at end of stream
+ */
+static int inflate_read(ota_decoder_t *dec, uint8_t *buf, size_t len) {
+	size_t done = 0;
+
+	if (!dec->inflator) return source_read(dec, buf, len);
+
+	while (done < len) {
+		// serve what has been inflated already
+		if (dec->dict_avail) {
+			size_t n = dec->dict_avail < len - done ? dec->dict_avail : len - done;
+			memcpy(buf + done, dec->dict + dec->dict_pos, n);
+			dec->dict_pos = (dec->dict_pos + n) & (TINFL_LZ_DICT_SIZE - 1);
+			dec->dict_avail -= n;
+			done += n;
+			continue;
+		}
+
+		if (dec->inflated) break;
+
+		if (dec->in_pos == dec->in_len) {
+			int err = source_fill(dec);
+			if (err < 0) return err;
+		}
+
+		size_t in_size = dec->in_len - dec->in_pos, out_size = TINFL_LZ_DICT_SIZE - dec->dict_pos;
+		uint32_t flags = (dec->format & OTA_FORMAT_ZLIB) ? TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_COMPUTE_ADLER32 : 0;
+		if (!dec->eof) flags |= TINFL_FLAG_HAS_MORE_INPUT;
+
+		tinfl_status status = tinfl_decompress(dec->inflator, dec->in + dec->in_pos, &in_size, dec->dict,
+											   dec->dict + dec->dict_pos, &out_size, flags);
+		dec->in_pos += in_size;
+		dec->dict_avail = out_size;
+		dec->size += out_size;
+		if (dec->format & OTA_FORMAT_GZIP) dec->crc = esp_rom_crc32_le(dec->crc, dec->dict + dec->dict_pos, out_size);
+
+		if (status == TINFL_STATUS_DONE) {
+			dec->inflated = true;
+			if ((dec->format & OTA_FORMAT_GZIP) && !gzip_trailer(dec)) return -1;
+		} else if (status < 0 || (status == TINFL_STATUS_NEEDS_MORE_INPUT && dec->eof)) {
+			ESP_LOGE(TAG, "inflate failed (%d) at %u", status, dec->size);
+			return -1;
+		}
+	}
+
+	return done;
+}
+
+/****************************************************************************************
+ * Read exactly len bytes (after detection look-ahead)
+ */
+static bool stream_read(ota_decoder_t *dec, uint8_t *buf, size_t len) {
+	size_t n = dec->head_len - dec->head_pos;
+
+	if (n > len) n = len;
+	memcpy(buf, dec->head + dec->head_pos, n);
+	dec->head_pos += n;
+
+	return n == len || inflate_read(dec, buf + n, len - n) == len - n;
+}
+
+/****************************************************************************************
+ * Read from base image, bytes that have been erased already come from history
+ */
+static bool base_read(ota_decoder_t *dec, uint32_t offset, uint8_t *buf, size_t len) {
+	if (offset + len > dec->delta.src_len || offset + len < offset) return false;
+
+	while (len && offset < dec->delta.backup_end) {
+		if (offset + dec->delta.window < dec->delta.backup_end) {
+			ESP_LOGE(TAG, "copy from %u is out of history window (%u)", offset, dec->delta.backup_end - dec->delta.window);
+			return false;
+		}
+		size_t pos = offset % dec->delta.window;
+		size_t n = dec->delta.backup_end - offset;
+		if (n > dec->delta.window - pos) n = dec->delta.window - pos;
+		if (n > len) n = len;
+		memcpy(buf, dec->delta.ring + pos, n);
+		buf += n; offset += n; len -= n;
+	}
+
+	return !len || esp_partition_read(dec->delta.base, offset, buf, len) == ESP_OK;
+}
+
+/****************************************************************************************
+ * Apply delta ops until output is full or END
+ */
+static int delta_read(ota_decoder_t *dec, uint8_t *out, size_t len) {
+	size_t done = 0;
+
+	while (done < len && !dec->delta.done) {
+		if (!dec->delta.left) {
+			uint8_t args[8];
+
+			if (!stream_read(dec, &dec->delta.op, 1)) return -1;
+
+			if (dec->delta.op == OTA_DELTA_END) {
+				if (dec->delta.written != dec->delta.dst_len) {
+					ESP_LOGE(TAG, "delta produced %u bytes instead of %u", dec->delta.written, dec->delta.dst_len);
+					return -1;
+				}
+				dec->delta.done = true;
+				break;
+			} else if (dec->delta.op == OTA_DELTA_COPY) {
+				if (!stream_read(dec, args, 8)) return -1;
+				dec->delta.src = le32(args);
+				dec->delta.left = le32(args + 4);
+			} else if (dec->delta.op == OTA_DELTA_ADD) {
+				if (!stream_read(dec, args, 4)) return -1;
+				dec->delta.left = le32(args);
+			} else {
+				ESP_LOGE(TAG, "unknown delta op %u", dec->delta.op);
+				return -1;
+			}
+
+			if (dec->delta.written + dec->delta.left > dec->delta.dst_len) {
+				ESP_LOGE(TAG, "delta op beyond target length");
+				return -1;
+			}
+		}
+
+		size_t n = dec->delta.left < len - done ? dec->delta.left : len - done;
+
+		if (dec->delta.op == OTA_DELTA_COPY) {
+			if (!base_read(dec, dec->delta.src, out + done, n)) return -1;
+			dec->delta.src += n;
+		} else if (!stream_read(dec, out + done, n)) {
+			return -1;
+		}
+
+		dec->delta.left -= n;
+		dec->delta.written += n;
+		done += n;
+	}
+
+	return done;
+}
+
+/****************************************************************************************
+ * Verify that the base image is the one delta has been made against
+ */
+static bool delta_check_base(ota_decoder_t *dec, const uint8_t *digest) {
+	mbedtls_sha256_context ctx;
+	uint8_t hash[32];
+	bool ok = true;
+
+	mbedtls_sha256_init(&ctx);
+	mbedtls_sha256_starts_ret(&ctx, 0);
+
+	// ring is not used yet, so it's our scratch buffer
+	for (size_t offset = 0; ok && offset < dec->delta.src_len; offset += SPI_FLASH_SEC_SIZE) {
+		size_t n = dec->delta.src_len - offset > SPI_FLASH_SEC_SIZE ? SPI_FLASH_SEC_SIZE : dec->delta.src_len - offset;
+		ok = esp_partition_read(dec->delta.base, offset, dec->delta.ring, n) == ESP_OK &&
+			 mbedtls_sha256_update_ret(&ctx, dec->delta.ring, n) == 0;
+	}
+
+	ok = ok && mbedtls_sha256_finish_ret(&ctx, hash) == 0 && !memcmp(hash, digest, sizeof(hash));
+	mbedtls_sha256_free(&ctx);
+	return ok;
+}
+
+/****************************************************************************************
+ * Parse delta header (magic has been read)
+ */
+static bool delta_open(ota_decoder_t *dec, const esp_partition_t *base) {
+	uint8_t header[OTA_DELTA_HEADER - 4];
+
+	if (!stream_read(dec, header, sizeof(header))) return false;
+
+	dec->delta.base = base;
+	dec->delta.src_len = le32(header + 4);
+	dec->delta.dst_len = le32(header + 8);
+	dec->delta.window = le32(header + 12);
+
+	if (header[0] != OTA_DELTA_VERSION) {
+		ESP_LOGE(TAG, "unsupported delta version %u", header[0]);
+		return false;
+	}
+	if (!base || dec->delta.src_len > base->size || dec->delta.dst_len > base->size) {
+		ESP_LOGE(TAG, "delta does not fit partition (source %u, target %u)", dec->delta.src_len, dec->delta.dst_len);
+		return false;
+	}
+	if (dec->delta.window < SPI_FLASH_SEC_SIZE || dec->delta.window > DECODER_MAX_WINDOW || dec->delta.window % SPI_FLASH_SEC_SIZE) {
+		ESP_LOGE(TAG, "invalid delta window %u", dec->delta.window);
+		return false;
+	}
+
+	dec->delta.ring = malloc(dec->delta.window);
+	if (!dec->delta.ring) {
+		ESP_LOGE(TAG, "can't allocate %u bytes of history", dec->delta.window);
+		return false;
+	}
+
+	if (!delta_check_base(dec, header + 16)) {
+		ESP_LOGE(TAG, "installed firmware is not the delta's base");
+		return false;
+	}
+
+	ESP_LOGI(TAG, "delta from %u to %u bytes, history %u", dec->delta.src_len, dec->delta.dst_len, dec->delta.window);
+	return true;
+}
+
+/****************************************************************************************
+ * Create a decoder, format is detected and delta base checked before returning
+ */
+ota_decoder_t* ota_decoder_create(ota_source_t source, const esp_partition_t *base) {
+	ota_decoder_t *dec = calloc(1, sizeof(ota_decoder_t));
+	if (!dec) return NULL;
+
+	dec->source = source;
+	dec->in = malloc(DECODER_IN_SIZE);
+	if (!dec->in) goto error;
+
+	// we need at most 2 bytes to identify compression
+	while (dec->in_len < 2 && source_fill(dec) > 0);
+	if (dec->in_len < 2) goto error;
+
+	if (dec->in[0] == 0x1f && dec->in[1] == 0x8b) {
+		dec->format = OTA_FORMAT_GZIP;
+		if (!gzip_header(dec)) goto error;
+	} else if ((dec->in[0] & 0x0f) == 8 && ((dec->in[0] << 8) | dec->in[1]) % 31 == 0) {
+		dec->format = OTA_FORMAT_ZLIB;
+	}
+
+	if (dec->format) {
+		dec->inflator = malloc(sizeof(tinfl_decompressor));
+		dec->dict = malloc(TINFL_LZ_DICT_SIZE);
+		if (!dec->inflator || !dec->dict) goto error;
+		tinfl_init(dec->inflator);
+	}
+
+	// delta might be compressed as well
+	int len = inflate_read(dec, dec->head, sizeof(dec->head));
+	if (len < 0) goto error;
+	dec->head_len = len;
+
+	if (len == sizeof(dec->head) && !memcmp(dec->head, OTA_DELTA_MAGIC, 4)) {
+		dec->format |= OTA_FORMAT_DELTA;
+		dec->head_pos = dec->head_len;
+		if (!delta_open(dec, base)) goto error;
+	}
+
+	ESP_LOGI(TAG, "image format %s%s", dec->format & OTA_FORMAT_GZIP ? "gzip " : dec->format & OTA_FORMAT_ZLIB ? "zlib " : "",
+			 dec->format & OTA_FORMAT_DELTA ? "delta" : "binary");
+	return dec;
+
+error:
+	ESP_LOGE(TAG, "invalid image");
+	ota_decoder_delete(dec);
+	return NULL;
+}
+
+/****************************************************************************************
+ * Release decoder
+ */
+void ota_decoder_delete(ota_decoder_t *dec) {
+	if (!dec) return;
+	free(dec->in);
+	free(dec->inflator);
+	free(dec->dict);
+	free(dec->delta.ring);
+	free(dec);
+}
+
+/****************************************************************************************
+ * Get detected format (0 for raw binary)
+ */
+uint8_t ota_decoder_format(ota_decoder_t *dec) {
+	return dec->format;
+}
+
+/****************************************************************************************
+ * Fill out with decoded image, short count only at end. Returns 0 at end and < 0 on
+ * error, including incomplete or corrupted compressed or delta stream
+ */
+int ota_decoder_read(ota_decoder_t *dec, uint8_t *out, size_t len) {
+	if (dec->format & OTA_FORMAT_DELTA) return delta_read(dec, out, len);
+
+	size_t n = dec->head_len - dec->head_pos;
+	if (n > len) n = len;
+	memcpy(out, dec->head + dec->head_pos, n);
+	dec->head_pos += n;
+
+	int done = inflate_read(dec, out + n, len - n);
+	return done < 0 ? done : done + n;
+}
+
+/****************************************************************************************
+ * Save a sector of the base image before it is erased. Sectors must be saved in order
+ */
+esp_err_t ota_decoder_backup(ota_decoder_t *dec, size_t offset) {
+	if (!(dec->format & OTA_FORMAT_DELTA)) return ESP_OK;
+	if (offset != dec->delta.backup_end) return ESP_ERR_INVALID_ARG;
+
+	if (offset < dec->delta.src_len) {
+		esp_err_t err = esp_partition_read(dec->delta.base, offset, dec->delta.ring + offset % dec->delta.window, SPI_FLASH_SEC_SIZE);
+		if (err != ESP_OK) return err;
+	}
+
+	dec->delta.backup_end += SPI_FLASH_SEC_SIZE;
+	return ESP_OK;
+}
@@ -0,0 +1,47 @@
+/*
+ * ota_decoder.h
+ *
+ * Decodes compressed (gzip/zlib) and delta OTA images on the fly
+ *
+ * This software is released under the MIT License.
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_partition.h"
+
+#define OTA_FORMAT_GZIP		0x01
+#define OTA_FORMAT_ZLIB		0x02
+#define OTA_FORMAT_DELTA	0x10
+
+/*
+ Delta image (little endian), optionally gzip/zlib compressed as a whole:
+	header: "SQDL", version (1), flags (0), reserved (2 bytes), source length (4),
+			target length (4), history window (4), source SHA-256 (32)
+	ops:	0x01 COPY source offset (4), length (4)
+			0x02 ADD length (4), data
+			0x00 END
+ Source is the image currently in the partition being written, so patching is done
+ in place. Each sector is saved in a history window before being erased, so COPY can
+ use source offsets down to (target offset + 4096 - window). See ota_image.py
+*/
+#define OTA_DELTA_MAGIC		"SQDL"
+#define OTA_DELTA_VERSION	1
+#define OTA_DELTA_HEADER	(4 + 4 + 4 + 4 + 4 + 32)
+
+enum { OTA_DELTA_END = 0, OTA_DELTA_COPY, OTA_DELTA_ADD };
+
+/* returns bytes read, 0 at end of stream and < 0 on error */
+typedef int (*ota_source_t)(uint8_t *buf, size_t len);
+
+typedef struct ota_decoder_s ota_decoder_t;
+
+ota_decoder_t* 	ota_decoder_create(ota_source_t source, const esp_partition_t *base);
+void 			ota_decoder_delete(ota_decoder_t *decoder);
+uint8_t			ota_decoder_format(ota_decoder_t *decoder);
+int 			ota_decoder_read(ota_decoder_t *decoder, uint8_t *out, size_t len);
+esp_err_t		ota_decoder_backup(ota_decoder_t *decoder, size_t offset);
@@ -0,0 +1,118 @@
+"""
+Build compressed or delta OTA images (see ota_decoder.h)
+
+  ota_image.py gzip squeezelite.bin -o squeezelite.bin.gz
+  ota_image.py delta installed.bin squeezelite.bin -o squeezelite.delta [--window 65536]
+
+Delta is made against the firmware installed in the OTA partition, which is patched
+in place: sectors are erased just before being written, so a COPY can only reach back
+<window> - 4096 bytes behind the target position. Delta is gzip'ed unless --raw.
+"""
+
+import argparse
+import gzip
+import hashlib
+import struct
+import sys
+
+SECTOR = 4096
+BLOCK = 32          # minimum match
+STEP = 4            # source indexing granularity
+MAX_CANDIDATES = 16
+
+OP_END, OP_COPY, OP_ADD = 0, 1, 2
+
+
+def match_length(src, s, dst, d):
+    n = 0
+    limit = min(len(src) - s, len(dst) - d)
+    # compare by chunks first, then by bytes
+    while n + 256 <= limit and src[s + n:s + n + 256] == dst[d + n:d + n + 256]:
+        n += 256
+    while n < limit and src[s + n] == dst[d + n]:
+        n += 1
+    return n
+
+
+def make_delta(src, dst, window):
+    index = {}
+    for i in range(0, len(src) - BLOCK + 1, STEP):
+        offsets = index.setdefault(src[i:i + BLOCK], [])
+        if len(offsets) < MAX_CANDIDATES:
+            offsets.append(i)
+
+    ops = bytearray()
+    pending = bytearray()
+    copied = 0
+    d = 0
+
+    def flush():
+        if pending:
+            ops.extend(struct.pack('<BI', OP_ADD, len(pending)))
+            ops.extend(pending)
+            pending.clear()
+
+    while d < len(dst):
+        best, best_len = 0, 0
+        # sector being written and everything behind history window is gone
+        lowest = d + SECTOR - window
+        for s in index.get(dst[d:d + BLOCK], ()):
+            if s < lowest:
+                continue
+            n = match_length(src, s, dst, d)
+            if n > best_len:
+                best, best_len = s, n
+        if best_len >= BLOCK:
+            flush()
+            ops.extend(struct.pack('<BII', OP_COPY, best, best_len))
+            copied += best_len
+            d += best_len
+        else:
+            pending.append(dst[d])
+            d += 1
+
+    flush()
+    ops.append(OP_END)
+
+    header = b'SQDL' + struct.pack('<BBHIII', 1, 0, 0, len(src), len(dst), window) + hashlib.sha256(src).digest()
+    return header + bytes(ops), copied
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Build compressed or delta OTA images')
+    sub = parser.add_subparsers(dest='command', required=True)
+    p = sub.add_parser('gzip', help='compress firmware image')
+    p.add_argument('image')
+    p.add_argument('-o', '--output', required=True)
+    p = sub.add_parser('delta', help='delta against installed firmware')
+    p.add_argument('source', help='firmware installed on the device')
+    p.add_argument('image', help='new firmware')
+    p.add_argument('-o', '--output', required=True)
+    p.add_argument('--window', type=int, default=64 * 1024, help='history kept by device (multiple of 4096, max 1MB)')
+    p.add_argument('--raw', action='store_true', help='do not compress delta')
+    args = parser.parse_args()
+
+    with open(args.image, 'rb') as f:
+        image = f.read()
+    if image[:1] != b'\xe9':
+        sys.exit(f'{args.image} is not a firmware image')
+
+    if args.command == 'gzip':
+        data = gzip.compress(image, 9)
+    else:
+        if args.window < SECTOR or args.window % SECTOR or args.window > 1024 * 1024:
+            sys.exit('invalid window')
+        with open(args.source, 'rb') as f:
+            source = f.read()
+        data, copied = make_delta(source, image, args.window)
+        print(f'{copied} of {len(image)} bytes copied from source')
+        if not args.raw:
+            data = gzip.compress(data, 9)
+
+    with open(args.output, 'wb') as f:
+        f.write(data)
+    print(f'{args.output}: {len(data)} bytes ({len(data) * 100 // len(image)}% of image)')
+
+
+if __name__ == '__main__':
+    main()
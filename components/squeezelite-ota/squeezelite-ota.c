@@ -40,6 +40,7 @@
 #include "lwip/sockets.h"
 #include "globdefs.h"
 #include "tools.h"
+#include "ota_decoder.h"
 
 #define IF_DISPLAY(x) if(display) { x; }
 
@@ -68,7 +69,7 @@ typedef enum  {
 
 typedef struct  {
 	size_t actual_image_len;
-	float downloaded_image_len;
+	size_t read_image_len;
 	float total_image_len;
 	float remain_image_len;
 	ota_type_t ota_type;
@@ -78,8 +79,15 @@ typedef struct  {
 	size_t buffer_size;
 	uint8_t lastpct;
 	uint8_t newpct;
-	uint8_t newdownloadpct;
 	struct timeval OTA_start;
+	ota_decoder_t *decoder;
+	struct {
+		TaskHandle_t task, writer;
+		size_t target;
+		volatile size_t erased;
+		volatile bool running, abort;
+		esp_err_t err;
+	} eraser;
 	bool bOTAThreadStarted;
     const esp_partition_t *configured;
     const esp_partition_t *running;
@@ -104,12 +112,9 @@ void _printMemStats(){
 			heap_caps_get_minimum_free_size(MALLOC_CAP_DMA));
 }
 uint8_t  ota_get_pct_complete(){
+	// compressed or delta images are not 1:1, so progress is on what has been received
 	return ota_status->total_image_len==0?0:
-			(uint8_t)((float)ota_status->actual_image_len/ota_status->total_image_len*100.0f);
-}
-uint8_t  ota_get_pct_downloaded(){
-	return ota_status->total_image_len==0?0:
-			(uint8_t)(ota_status->downloaded_image_len/ota_status->total_image_len*100.0f);
+			(uint8_t)((float)ota_status->read_image_len/ota_status->total_image_len*100.0f);
 }
 typedef struct  {
 	int x1,y1,x2,y2,width,height;
@@ -226,48 +231,6 @@ static void __attribute__((noreturn)) task_fatal_error(void)
     }
 }
 
-esp_err_t handle_http_on_data(esp_http_client_event_t *evt){
-
-	int http_status= esp_http_client_get_status_code(evt->client);
-	static char * recv_ptr=NULL;
-
-	if(http_status == 200){
-
-
-		if(!ota_status->bOTAStarted)
-		{
-			sendMessaging(MESSAGING_INFO,"Downloading firmware");
-			ota_status->bOTAStarted = true;
-			ota_status->total_image_len=esp_http_client_get_content_length(evt->client);
-			ota_status->downloaded_image_len = 0;
-			ota_status->newdownloadpct = 0;
-		    ota_status->bin_data= malloc_init_external(ota_status->total_image_len);
-		    if(ota_status->bin_data==NULL){
-				sendMessaging(MESSAGING_ERROR,"Error: buffer alloc error");
-				return ESP_FAIL;
-	   	    }
-		    recv_ptr=ota_status->bin_data;
-		}
-
-		// we're downloading the binary data file
-		if (!esp_http_client_is_chunked_response(evt->client)) {
-			memcpy(recv_ptr,evt->data,evt->data_len);
-			ota_status->downloaded_image_len +=evt->data_len;
-			recv_ptr+=evt->data_len;
-		}
-		if(ota_get_pct_downloaded()%5 == 0 && ota_get_pct_downloaded()%5!=ota_status->newdownloadpct) {
-			ota_status->newdownloadpct= ota_get_pct_downloaded();
-			loc_displayer_progressbar(ota_status->newdownloadpct);
-			gettimeofday(&tv, NULL);
-			uint32_t elapsed_ms= (tv.tv_sec-ota_status->OTA_start.tv_sec )*1000+(tv.tv_usec-ota_status->OTA_start.tv_usec)/1000;
-			ESP_LOGI(TAG,"OTA download progress : %f/%f (%d pct), %f KB/s", ota_status->downloaded_image_len, ota_status->total_image_len, ota_status->newdownloadpct, elapsed_ms>0?ota_status->downloaded_image_len*1000/elapsed_ms/1024:0);
-			sendMessaging(MESSAGING_INFO,"Downloading firmware %%%3d.",ota_status->newdownloadpct);
-		}
-
-	}
-
-	return ESP_OK;
-}
 esp_err_t _http_event_handler(esp_http_client_event_t *evt)
 {
 // --------------
@@ -314,7 +277,7 @@ esp_err_t _http_event_handler(esp_http_client_event_t *evt)
 //        }
         break;
     case HTTP_EVENT_ON_DATA:
-    	return handle_http_on_data(evt);
+    	// data is pulled by ota_read_block, nothing to do here
         break;
     case HTTP_EVENT_ON_FINISH:
         ESP_LOGD(TAG, "HTTP_EVENT_ON_FINISH");
@@ -396,12 +359,8 @@ esp_partition_t * _get_ota_partition(esp_partition_subtype_t subtype){
 
 
 
-esp_err_t _erase_last_boot_app_partition(const esp_partition_t *ota_partition)
-{
-	uint16_t num_passes=0;
-	uint16_t remain_size=0;
+static uint32_t _get_erase_block_size(){
 	uint32_t single_pass_size=0;
-	esp_err_t err=ESP_OK;
 
     char * ota_erase_size=config_alloc_get(NVS_TYPE_STR, "ota_erase_blk");
 	if(ota_erase_size!=NULL) {
@@ -419,45 +378,103 @@ esp_err_t _erase_last_boot_app_partition(const esp_partition_t *ota_partition)
 		ESP_LOGW(TAG,"Invalid erase block size of %u. Value should be a multiple of %d and will be adjusted to %u.", single_pass_size, SPI_FLASH_SEC_SIZE,temp_single_pass_size);
 		single_pass_size=temp_single_pass_size;
 	}
-	ESP_LOGD(TAG,"Erasing flash partition of size %u in blocks of %d bytes", ota_partition->size, single_pass_size);
-	num_passes=ota_partition->size/single_pass_size;
-	remain_size=ota_partition->size-(num_passes*single_pass_size);
-	ESP_LOGI(TAG,"Erasing in %d passes with blocks of %d bytes ", num_passes,single_pass_size);
-	for(uint16_t i=0;i<num_passes;i++){
-		ESP_LOGD(TAG,"Erasing flash (%u%%)",i/num_passes);
-		ESP_LOGD(TAG,"Pass %d of %d, with chunks of %d bytes, from %d to %d", i+1, num_passes,single_pass_size,i*single_pass_size,i*single_pass_size+single_pass_size);
-		err=esp_partition_erase_range(ota_partition, i*single_pass_size, single_pass_size);
-		if(err!=ESP_OK) return err;
-		if(i%2) {
-			loc_displayer_progressbar((int)(((float)i/(float)num_passes)*100.0f));
-			sendMessaging(MESSAGING_INFO,"Erasing flash (%u/%u)",i,num_passes);
-		}
-		vTaskDelay(100/ portTICK_PERIOD_MS);  // wait here for a short amount of time.  This will help with reducing WDT errors
+	if(single_pass_size == 0) single_pass_size = SPI_FLASH_SEC_SIZE;
+	return single_pass_size;
+}
+
+/****************************************************************************************
+ * Erases the partition ahead of the writer, which is notified after each block. The
+ * first sector is erased by esp_ota_begin
+ */
+static void _ota_erase_task(void *pvParameter){
+	uint32_t single_pass_size = (uint32_t) pvParameter;
+	const esp_partition_t *ota_partition = ota_status->ota_partition;
+
+	ESP_LOGI(TAG,"Erasing %u bytes ahead of writer in blocks of %u bytes", ota_status->eraser.target, single_pass_size);
+	while(!ota_status->eraser.abort && ota_status->eraser.erased < ota_status->eraser.target){
+		uint32_t size = ota_status->eraser.target - ota_status->eraser.erased;
+		if(size > single_pass_size) size = single_pass_size;
+		ota_status->eraser.err = esp_partition_erase_range(ota_partition, ota_status->eraser.erased, size);
+		if(ota_status->eraser.err != ESP_OK) break;
+		ota_status->eraser.erased += size;
+		xTaskNotifyGive(ota_status->eraser.writer);
+		// let others breath between blocks (reduces WDT errors)
+		vTaskDelay(10/ portTICK_PERIOD_MS);
 	}
-	if(remain_size>0){
-		err=esp_partition_erase_range(ota_partition, ota_partition->size-remain_size, remain_size);
+	ESP_LOGD(TAG,"Erase task done at %u (%s)", ota_status->eraser.erased, esp_err_to_name(ota_status->eraser.err));
+
+	// writer can't be gone as long as we are running
+	xTaskNotifyGive(ota_status->eraser.writer);
+	ota_status->eraser.running = false;
+	vTaskDelete(NULL);
+}
+
+static esp_err_t _ota_erase_start(size_t image_len){
+	uint32_t single_pass_size = _get_erase_block_size();
+
+	// round up to sector size
+	ota_status->eraser.target = (image_len + SPI_FLASH_SEC_SIZE - 1) & ~(SPI_FLASH_SEC_SIZE - 1);
+	if(ota_status->eraser.target > ota_status->ota_partition->size) ota_status->eraser.target = ota_status->ota_partition->size;
+	ota_status->eraser.erased = SPI_FLASH_SEC_SIZE;
+	ota_status->eraser.err = ESP_OK;
+	ota_status->eraser.abort = false;
+	ota_status->eraser.writer = xTaskGetCurrentTaskHandle();
+	ota_status->eraser.running = true;
+
+	if(xTaskCreate(&_ota_erase_task, "ota_erase", 3072, (void *) single_pass_size, uxTaskPriorityGet(NULL), &ota_status->eraser.task) != pdPASS){
+		ota_status->eraser.running = false;
+		return ESP_ERR_NO_MEM;
+	}
+	return ESP_OK;
+}
+
+static void _ota_erase_stop(){
+	ota_status->eraser.abort = true;
+	while(ota_status->eraser.running) ulTaskNotifyTake(pdTRUE, 100 / portTICK_PERIOD_MS);
+}
 
-		if(err!=ESP_OK) return err;
+/****************************************************************************************
+ * Delta images patch the current content of the partition, so sectors are erased only
+ * when the writer reaches them, after decoder has saved them
+ */
+static esp_err_t _ota_erase_backup(size_t offset){
+	while(ota_status->eraser.erased < offset){
+		esp_err_t err = ota_decoder_backup(ota_status->decoder, ota_status->eraser.erased);
+		if(err == ESP_OK) err = esp_partition_erase_range(ota_status->ota_partition, ota_status->eraser.erased, SPI_FLASH_SEC_SIZE);
+		if(err != ESP_OK) return err;
+		ota_status->eraser.erased += SPI_FLASH_SEC_SIZE;
 	}
-	sendMessaging(MESSAGING_INFO,"Erasing flash complete.");
-	loc_displayer_progressbar(100);
-	vTaskDelay(200/ portTICK_PERIOD_MS);
 	return ESP_OK;
 }
 
+/****************************************************************************************
+ * Blocks writer until eraser is past the requested offset
+ */
+static esp_err_t _ota_erase_wait(size_t offset){
+	while(ota_status->eraser.erased < offset && ota_status->eraser.erased < ota_status->eraser.target){
+		if(ota_status->eraser.err != ESP_OK) return ota_status->eraser.err;
+		if(!ota_status->eraser.running) return ESP_FAIL;
+		ulTaskNotifyTake(pdTRUE, 100 / portTICK_PERIOD_MS);
+	}
+	return ota_status->eraser.err;
+}
+
 void ota_task_cleanup(const char * message, ...){
 	ota_status->bOTAThreadStarted=false;
+	_ota_erase_stop();
 	loc_displayer_progressbar(0);
 	if(message!=NULL){
 	    va_list args;
 	    va_start(args, message);
 		sendMessaging(MESSAGING_ERROR,message, args);
 	    va_end(args);
-		
+
 	    if (led_display) led_vu_color_red(LED_VU_BRIGHT);
 	} else {
 	    if (led_display) led_vu_color_green(LED_VU_BRIGHT);
 	}
+	ota_decoder_delete(ota_status->decoder);
+	ota_status->decoder = NULL;
 	FREE_RESET(ota_status->ota_write_data);
 	FREE_RESET(ota_status->bin_data);
 	if(ota_http_client!=NULL) {
@@ -467,67 +484,121 @@ void ota_task_cleanup(const char * message, ...){
 	ota_status->bOTAStarted = false;
 	task_fatal_error();
 }
-esp_err_t ota_buffer_all(){
-		esp_err_t err=ESP_OK;
-	if (ota_status->ota_type == OTA_TYPE_HTTP){
-		IF_DISPLAY(GDS_TextLine(display, 2, GDS_TEXT_LEFT, GDS_TEXT_CLEAR | GDS_TEXT_UPDATE, "Downloading file"));
-		ota_http_client = esp_http_client_init(&http_client_config);
-		if (ota_http_client == NULL) {
-			sendMessaging(MESSAGING_ERROR,"Error: Failed to initialize HTTP connection.");
+
+/****************************************************************************************
+ * Opens HTTP connection and follows redirections. Image is then pulled by blocks, it
+ * is never buffered entirely
+ */
+static esp_err_t ota_stream_open(){
+	esp_err_t err=ESP_OK;
+	int status = 0;
+	int content_length = 0;
+
+	if (ota_status->ota_type != OTA_TYPE_HTTP){
+		gettimeofday(&ota_status->OTA_start, NULL);
+		ota_status->remain_image_len=ota_status->total_image_len;
+		return ESP_OK;
+	}
+
+	IF_DISPLAY(GDS_TextLine(display, 2, GDS_TEXT_LEFT, GDS_TEXT_CLEAR | GDS_TEXT_UPDATE, "Downloading file"));
+	ota_http_client = esp_http_client_init(&http_client_config);
+	if (ota_http_client == NULL) {
+		sendMessaging(MESSAGING_ERROR,"Error: Failed to initialize HTTP connection.");
+		return ESP_FAIL;
+	}
+	_printMemStats();
+
+	for(int redirects = 0; ; redirects++){
+		err = esp_http_client_open(ota_http_client, 0);
+		if (err != ESP_OK) {
+			sendMessaging(MESSAGING_ERROR,"Error: Failed to open HTTP connection. %s",esp_err_to_name(err));
 			return ESP_FAIL;
 		}
-	    _printMemStats();
-	    err =  esp_http_client_perform(ota_http_client);
-		if (err !=  ESP_OK) {
-			sendMessaging(MESSAGING_ERROR,"Error: Failed to execute HTTP download. %s",esp_err_to_name(err));
-			return ESP_FAIL;
+		content_length = esp_http_client_fetch_headers(ota_http_client);
+		status = esp_http_client_get_status_code(ota_http_client);
+		if((status == 301 || status == 302 || status == 303 || status == 307 || status == 308) && redirects < http_client_config.max_redirection_count){
+			ESP_LOGD(TAG,"HTTP status %d, following redirection",status);
+			esp_http_client_set_redirection(ota_http_client);
+			// drain body before re-opening
+			while(esp_http_client_read(ota_http_client, ota_status->ota_write_data, ota_status->buffer_size) > 0);
+			esp_http_client_close(ota_http_client);
+			continue;
 		}
+		break;
+	}
 
-	    if(ota_status->total_image_len<=0){
-	    	sendMessaging(MESSAGING_ERROR,"Error: Invalid image length");
-	    	return ESP_FAIL;
-	    }
-	    sendMessaging(MESSAGING_INFO,"Download success");
+	if(status != 200){
+		sendMessaging(MESSAGING_ERROR,"Error: HTTP download failed with status %d",status);
+		return ESP_FAIL;
 	}
-	else {
-		gettimeofday(&ota_status->OTA_start, NULL);
+	if(content_length <= 0){
+		sendMessaging(MESSAGING_ERROR,"Error: Invalid image length");
+		return ESP_FAIL;
 	}
-	ota_status->remain_image_len=ota_status->total_image_len;
 
-	return err;
+	ota_status->bOTAStarted = true;
+	ota_status->total_image_len = content_length;
+	ota_status->remain_image_len = content_length;
+	ota_status->read_image_len = 0;
+	sendMessaging(MESSAGING_INFO,"Downloading firmware");
+	return ESP_OK;
 }
-int ota_buffer_read(){
+
+/****************************************************************************************
+ * Decoder's source, pulls image as received (from network or upload buffer)
+ */
+static int ota_source_read(uint8_t *buf, size_t len){
 	int data_read=0;
-	if(ota_status->remain_image_len >ota_status->buffer_size){
-		data_read = ota_status->buffer_size;
-	} else {
-		data_read = ota_status->remain_image_len;
+	size_t wanted = ota_status->remain_image_len > len ? len : ota_status->remain_image_len;
+
+	if (ota_status->ota_type == OTA_TYPE_HTTP){
+		while(data_read < wanted){
+			int read = esp_http_client_read(ota_http_client, (char *) buf + data_read, wanted - data_read);
+			if(read < 0) return read;
+			if(read == 0) break;
+			data_read += read;
+		}
+	}
+	else {
+		memcpy(buf, &ota_status->bin_data[ota_status->read_image_len], wanted);
+		data_read = wanted;
 	}
-	memcpy(ota_status->ota_write_data, &ota_status->bin_data[ota_status->actual_image_len], data_read);
 
-	ota_status->actual_image_len += data_read;
+	ota_status->read_image_len += data_read;
 	ota_status->remain_image_len -= data_read;
 	return data_read;
 }
-esp_err_t ota_header_check(){
+
+/****************************************************************************************
+ * Fills ota_write_data with next block of the decoded image, 0 at end
+ */
+static int ota_read_block(){
+	return ota_decoder_read(ota_status->decoder, (uint8_t *) ota_status->ota_write_data, ota_status->buffer_size);
+}
+
+/****************************************************************************************
+ * Verifies image header from the first block received, before anything is erased
+ */
+esp_err_t ota_header_check(const char * header, size_t len){
 	esp_app_desc_t new_app_info;
-    esp_app_desc_t running_app_info;
+    esp_app_desc_t running_app_info = { 0 };
+	const esp_image_header_t * image_header = (const esp_image_header_t *) header;
 
     ota_status->configured = esp_ota_get_boot_partition();
     ota_status->running = esp_ota_get_running_partition();
     ota_status->last_invalid_app= esp_ota_get_last_invalid_partition();
     ota_status->ota_partition = _get_ota_partition(ESP_PARTITION_SUBTYPE_APP_OTA_0);
 
-    ESP_LOGD(TAG, "Running partition [%s] type %d subtype %d (offset 0x%08x)", ota_status->running->label, ota_status->running->type, ota_status->running->subtype, ota_status->running->address);
-    if (ota_status->total_image_len > ota_status->ota_partition->size){
-    	ota_task_cleanup("Error: Image size (%d) too large to fit in partition (%d).",ota_status->ota_partition->size,ota_status->total_image_len );
-        return ESP_FAIL;
-	}
 	if(ota_status->ota_partition == NULL){
 		ESP_LOGE(TAG,"Unable to locate OTA application partition. ");
         ota_task_cleanup("Error: OTA partition not found");
         return ESP_FAIL;
 	}
+    ESP_LOGD(TAG, "Running partition [%s] type %d subtype %d (offset 0x%08x)", ota_status->running->label, ota_status->running->type, ota_status->running->subtype, ota_status->running->address);
+    if (ota_status->total_image_len > ota_status->ota_partition->size){
+    	ota_task_cleanup("Error: Image size (%d) too large to fit in partition (%d).",(int)ota_status->total_image_len,ota_status->ota_partition->size);
+        return ESP_FAIL;
+	}
     if (ota_status->configured != ota_status->running) {
         ESP_LOGW(TAG, "Configured OTA boot partition at offset 0x%08x, but running from offset 0x%08x", ota_status->configured->address, ota_status->running->address);
         ESP_LOGW(TAG, "(This can happen if either the OTA boot data or preferred boot image become corrupted somehow.)");
@@ -535,28 +606,35 @@ esp_err_t ota_header_check(){
     ESP_LOGD(TAG, "Next ota update partition is: [%s] subtype %d at offset 0x%x",
     		ota_status->update_partition->label, ota_status->update_partition->subtype, ota_status->update_partition->address);
 
-    if (ota_status->total_image_len >= IMAGE_HEADER_SIZE) {
-		// check current version with downloading
-		memcpy(&new_app_info, &ota_status->bin_data[sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t)], sizeof(esp_app_desc_t));
-		ESP_LOGI(TAG, "New firmware version: %s", new_app_info.version);
-		if (esp_ota_get_partition_description(ota_status->running, &running_app_info) == ESP_OK) {
-			ESP_LOGD(TAG, "Running recovery version: %s", running_app_info.version);
-		}
-		sendMessaging(MESSAGING_INFO,"New version is : %s",new_app_info.version);
-		esp_app_desc_t invalid_app_info;
-		if (esp_ota_get_partition_description(ota_status->last_invalid_app, &invalid_app_info) == ESP_OK) {
-			ESP_LOGD(TAG, "Last invalid firmware version: %s", invalid_app_info.version);
-		}
-
-		if (memcmp(new_app_info.version, running_app_info.version, sizeof(new_app_info.version)) == 0) {
-			ESP_LOGW(TAG, "Current running version is the same as a new.");
-		}
-		return ESP_OK;
-    }
-    else{
+    if (len < IMAGE_HEADER_SIZE) {
     	ota_task_cleanup("Error: Binary file too small");
-    }
-	 return ESP_FAIL;
+		return ESP_FAIL;
+	}
+
+	memcpy(&new_app_info, &header[sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t)], sizeof(esp_app_desc_t));
+	if (image_header->magic != ESP_IMAGE_HEADER_MAGIC || new_app_info.magic_word != ESP_APP_DESC_MAGIC_WORD) {
+		ota_task_cleanup("Error: Invalid firmware image");
+		return ESP_FAIL;
+	}
+	if (image_header->chip_id != CONFIG_IDF_FIRMWARE_CHIP_ID) {
+		ota_task_cleanup("Error: Firmware is for another chip (id %d)", image_header->chip_id);
+		return ESP_FAIL;
+	}
+
+	ESP_LOGI(TAG, "New firmware version: %s", new_app_info.version);
+	if (esp_ota_get_partition_description(ota_status->running, &running_app_info) == ESP_OK) {
+		ESP_LOGD(TAG, "Running recovery version: %s", running_app_info.version);
+	}
+	sendMessaging(MESSAGING_INFO,"New version is : %s",new_app_info.version);
+	esp_app_desc_t invalid_app_info;
+	if (esp_ota_get_partition_description(ota_status->last_invalid_app, &invalid_app_info) == ESP_OK) {
+		ESP_LOGD(TAG, "Last invalid firmware version: %s", invalid_app_info.version);
+	}
+
+	if (memcmp(new_app_info.version, running_app_info.version, sizeof(new_app_info.version)) == 0) {
+		ESP_LOGW(TAG, "Current running version is the same as a new.");
+	}
+	return ESP_OK;
 }
 
 void ota_task(void *pvParameter)
@@ -582,79 +660,96 @@ void ota_task(void *pvParameter)
 
 	_printMemStats();
 	sendMessaging(MESSAGING_INFO,"Starting OTA...");
-	err=ota_buffer_all();
+	err=ota_stream_open();
 	if(err!=ESP_OK){
 		ota_task_cleanup(NULL);
 		return;
 	}
 
-	if(ota_header_check()!=ESP_OK){
-		ota_task_cleanup(NULL);
+	// format is detected (and delta's base verified) before anything is erased
+	ota_status->decoder = ota_decoder_create(ota_source_read, _get_ota_partition(ESP_PARTITION_SUBTYPE_APP_OTA_0));
+	if(ota_status->decoder == NULL){
+		ota_task_cleanup("Error: Invalid image or not made for installed firmware");
 		return;
 	}
+	bool delta = ota_decoder_format(ota_status->decoder) & OTA_FORMAT_DELTA;
 
-	/* Locate and erase ota application partition */
-	sendMessaging(MESSAGING_INFO,"Formatting OTA partition");
-	ESP_LOGW(TAG,"****************  Expecting WATCHDOG errors below during flash erase. This is OK and not to worry about **************** ");
-	IF_DISPLAY(GDS_TextLine(display, 2, GDS_TEXT_LEFT, GDS_TEXT_CLEAR | GDS_TEXT_UPDATE, "Formatting partition"));
-
-	_printMemStats();
-	err=_erase_last_boot_app_partition(ota_status->ota_partition);
-	if(err!=ESP_OK){
-		ota_task_cleanup("Error: Unable to erase last APP partition. (%s)",esp_err_to_name(err));
+	// first block is used to verify header before touching flash
+	data_read = ota_read_block();
+	if(data_read <= 0){
+		ota_task_cleanup("Error: Data read error");
+		return;
+	}
+	if(ota_header_check(ota_status->ota_write_data, data_read)!=ESP_OK){
+		ota_task_cleanup(NULL);
 		return;
 	}
-	loc_displayer_progressbar(0);
-	_printMemStats();
-
 
-	// Call OTA Begin with a small partition size - this minimizes the time spent in erasing partition,
-	// which was already done above
+	// Call OTA Begin with a small partition size so that only first sector is erased. The
+	// rest is erased by a separate task, ahead of the writer, while we are downloading.
+	// Delta needs the old content, so it is saved and erased sector by sector instead
     esp_ota_handle_t update_handle = 0 ;
     gettimeofday(&ota_status->OTA_start, NULL);
+	if(delta && (err = ota_decoder_backup(ota_status->decoder, 0)) != ESP_OK){
+		ota_task_cleanup("Error: Unable to read APP partition (%s)", esp_err_to_name(err));
+		return;
+	}
 	err = esp_ota_begin(ota_status->ota_partition, 512, &update_handle);
 	if (err != ESP_OK) {
 		ota_task_cleanup("esp_ota_begin failed (%s)", esp_err_to_name(err));
 		return;
 	}
 	ESP_LOGD(TAG, "esp_ota_begin succeeded");
+
+	// decompressed size is unknown, so whole partition is erased
+	if (delta) ota_status->eraser.erased = SPI_FLASH_SEC_SIZE;
+	else err = _ota_erase_start(ota_decoder_format(ota_status->decoder) ? ota_status->ota_partition->size : ota_status->total_image_len);
+	if (err != ESP_OK) {
+		ota_task_cleanup("Error: Unable to start flash erase (%s)", esp_err_to_name(err));
+		return;
+	}
+	_printMemStats();
 	IF_DISPLAY(GDS_TextLine(display, 2, GDS_TEXT_LEFT, GDS_TEXT_CLEAR | GDS_TEXT_UPDATE, "Writing image..."));
-    while (ota_status->remain_image_len>0) {
-
-    	data_read = ota_buffer_read();
-        if (data_read <= 0) {
-            ota_task_cleanup("Error: Data read error");
-            return;
-        } else if (data_read > 0) {
-            err = esp_ota_write( update_handle, (const void *)ota_status->ota_write_data, data_read);
-            if (err != ESP_OK) {
-                ota_task_cleanup("Error: OTA Partition write failure. (%s)",esp_err_to_name(err));
-                return;
-            }
-            ESP_LOGD(TAG, "Written image length %d", ota_status->actual_image_len);
-
-			if(ota_get_pct_complete()%5 == 0) ota_status->newpct = ota_get_pct_complete();
-			if(ota_status->lastpct!=ota_status->newpct ) {
-				loc_displayer_progressbar(ota_status->newpct);
-				gettimeofday(&tv, NULL);
-				uint32_t elapsed_ms= (tv.tv_sec-ota_status->OTA_start.tv_sec )*1000+(tv.tv_usec-ota_status->OTA_start.tv_usec)/1000;
-				ESP_LOGI(TAG,"OTA progress : %d/%.0f (%d pct), %d KB/s", ota_status->actual_image_len, ota_status->total_image_len, ota_status->newpct, elapsed_ms>0?ota_status->actual_image_len*1000/elapsed_ms/1024:0);
-				sendMessaging(MESSAGING_INFO,"Writing binary file %3d %%.",ota_status->newpct);
-				ota_status->lastpct=ota_status->newpct;
-			}
-			taskYIELD();
 
-        } else if (data_read == 0) {
-            ESP_LOGD(TAG, "End of OTA data stream");
-            break;
-        }
+    while (data_read > 0) {
+		if (delta) err = _ota_erase_backup(ota_status->actual_image_len + data_read);
+		else err = _ota_erase_wait(ota_status->actual_image_len + data_read);
+		if (err != ESP_OK) {
+			ota_task_cleanup("Error: Unable to erase APP partition. (%s)",esp_err_to_name(err));
+			return;
+		}
+		err = esp_ota_write( update_handle, (const void *)ota_status->ota_write_data, data_read);
+		if (err != ESP_OK) {
+			ota_task_cleanup("Error: OTA Partition write failure. (%s)",esp_err_to_name(err));
+			return;
+		}
+		ota_status->actual_image_len += data_read;
+		ESP_LOGD(TAG, "Written image length %d", ota_status->actual_image_len);
+
+		if(ota_get_pct_complete()%5 == 0) ota_status->newpct = ota_get_pct_complete();
+		if(ota_status->lastpct!=ota_status->newpct ) {
+			loc_displayer_progressbar(ota_status->newpct);
+			gettimeofday(&tv, NULL);
+			uint32_t elapsed_ms= (tv.tv_sec-ota_status->OTA_start.tv_sec )*1000+(tv.tv_usec-ota_status->OTA_start.tv_usec)/1000;
+			ESP_LOGI(TAG,"OTA progress : %d/%.0f (%d pct), %d written, %d KB/s", ota_status->read_image_len, ota_status->total_image_len, ota_status->newpct, ota_status->actual_image_len, elapsed_ms>0?ota_status->read_image_len*1000/elapsed_ms/1024:0);
+			sendMessaging(MESSAGING_INFO,"Writing binary file %3d %%.",ota_status->newpct);
+			ota_status->lastpct=ota_status->newpct;
+		}
+
+		data_read = ota_read_block();
     }
 
+	// decoder fails if a compressed or delta image is incomplete
     ESP_LOGI(TAG, "Total Write binary data length: %d", ota_status->actual_image_len);
-    if (ota_status->total_image_len != ota_status->actual_image_len) {
+    if (data_read < 0) {
+		ota_task_cleanup("Error: Data read error");
+		return;
+	}
+    if (!ota_decoder_format(ota_status->decoder) && ota_status->total_image_len != ota_status->actual_image_len) {
         ota_task_cleanup("Error: Error in receiving complete file");
         return;
     }
+    _ota_erase_stop();
     _printMemStats();
     loc_displayer_progressbar(100);
     err = esp_ota_end(update_handle);
@@ -22,6 +22,7 @@
 #include "squeezelite.h"
 
 #include "alac_wrapper.h"
+#include "mp4.h"
 
 #if BYTES_PER_FRAME == 4		
 #define ALIGN8(n) 	(n << 8)		
@@ -39,28 +40,13 @@
 #define MIN_READ    BLOCK_SIZE
 #define MIN_SPACE  (MIN_READ * 4)
 
-struct chunk_table {
-	u32_t sample, offset;
-};
-
 struct alac {
 	void *decoder;
-	u8_t *writebuf;
-	// following used for mp4 only
-	u32_t consume;
-	u32_t pos;
-	u32_t sample;
-	u32_t nextchunk;
-	void *stsc;
-	u32_t skip;
-	u64_t samples;
-	u64_t sttssamples;
+	u8_t *writebuf, *readbuf;
+	struct mp4 mp4;
 	bool  empty;
-	struct chunk_table *chunkinfo;
-	u32_t  *block_size, default_block_size, block_index;
 	unsigned sample_rate;
 	unsigned char channels, sample_size;
-	unsigned trak, play;
 };
 
 static struct alac *l;
@@ -94,240 +80,32 @@ extern struct processstate process;
 #define IF_PROCESS(x)
 #endif
 
-// read mp4 header to extract config data
-static int read_mp4_header(void) {
-	size_t bytes = min(_buf_used(streambuf), _buf_cont_read(streambuf));
-	char type[5];
-	u32_t len;
-
-	while (bytes >= 8) {
-		// count trak to find the first playable one
-		u32_t consume;
-
-		len = unpackN((u32_t *)streambuf->readp);
-		memcpy(type, streambuf->readp + 4, 4);
-		type[4] = '\0';
-
-		if (!strcmp(type, "moov")) {
-			l->trak = 0;
-			l->play = 0;
-		}
-		if (!strcmp(type, "trak")) {
-			l->trak++;
-		}
-
-		// extract audio config from within alac
-		if (!strcmp(type, "alac") && bytes > len) {
-			u8_t *ptr = streambuf->readp + 36;
-			unsigned int block_size;
-			l->play = l->trak;						
-			l->decoder = alac_create_decoder(len - 36, ptr, &l->sample_size, &l->sample_rate, &l->channels, &block_size);
-			l->writebuf = malloc(block_size + 256);
-			LOG_INFO("allocated write buffer of %u bytes", block_size);
-			if (!l->writebuf) {
-				LOG_ERROR("allocation failed");
-				return -1;
-			}
-		}
-
-		// extract the total number of samples from stts
-		if (!strcmp(type, "stsz") && bytes > len) {
-			u32_t i;
-			u8_t *ptr = streambuf->readp + 12;
-			l->default_block_size = unpackN((u32_t *) ptr); ptr += 4;
-			if (!l->default_block_size) {
-				u32_t entries = unpackN((u32_t *)ptr); ptr += 4;
-				l->block_size = malloc((entries + 1)* 4);
-				for (i = 0; i < entries; i++) {
-					l->block_size[i] = unpackN((u32_t *)ptr); ptr += 4;
-				}
-				l->block_size[entries] = 0;
-				LOG_DEBUG("total blocksize contained in stsz %u", entries);
-			} else {
-				LOG_DEBUG("fixed blocksize in stsz %u", l->default_block_size);
-            }
-		}
-
-		// extract the total number of samples from stts
-		if (!strcmp(type, "stts") && bytes > len) {
-			u32_t i;
-			u8_t *ptr = streambuf->readp + 12;
-			u32_t entries = unpackN((u32_t *)ptr);
-			ptr += 4;
-			for (i = 0; i < entries; ++i) {
-				u32_t count = unpackN((u32_t *)ptr);
-				u32_t size = unpackN((u32_t *)(ptr + 4));
-				l->sttssamples += count * size;
-				ptr += 8;
-			}
-			LOG_DEBUG("total number of samples contained in stts: " FMT_u64, l->sttssamples);
-		}
+// extract audio config from within alac
+static bool alac_config(void *ctx, u8_t *box, u32_t len) {
+	unsigned int block_size;
 
-		// stash sample to chunk info, assume it comes before stco
-		if (!strcmp(type, "stsc") && bytes > len && !l->chunkinfo) {
-			l->stsc = malloc(len - 12);
-			if (l->stsc == NULL) {
-				LOG_WARN("malloc fail");
-				return -1;
-			}
-			memcpy(l->stsc, streambuf->readp + 12, len - 12);
-		}
+	if (len <= 36) return false;
 
-		// build offsets table from stco and stored stsc
-		if (!strcmp(type, "stco") && bytes > len && l->play == l->trak) {
-			u32_t i;
-			// extract chunk offsets
-			u8_t *ptr = streambuf->readp + 12;
-			u32_t entries = unpackN((u32_t *)ptr);
-			ptr += 4;
-			l->chunkinfo = malloc(sizeof(struct chunk_table) * (entries + 1));
-			if (l->chunkinfo == NULL) {
-				LOG_WARN("malloc fail");
-				return -1;
-			}
-			for (i = 0; i < entries; ++i) {
-				l->chunkinfo[i].offset = unpackN((u32_t *)ptr);
-				l->chunkinfo[i].sample = 0;
-				ptr += 4;
-			}
-			l->chunkinfo[i].sample = 0;
-			l->chunkinfo[i].offset = 0;
-			// fill in first sample id for each chunk from stored stsc
-			if (l->stsc) {
-				u32_t stsc_entries = unpackN((u32_t *)l->stsc);
-				u32_t sample = 0;
-				u32_t last = 0, last_samples = 0;
-				u8_t *ptr = (u8_t *)l->stsc + 4;
-				while (stsc_entries--) {
-					u32_t first = unpackN((u32_t *)ptr);
-					u32_t samples = unpackN((u32_t *)(ptr + 4));
-					if (last) {
-						for (i = last - 1; i < first - 1; ++i) {
-							l->chunkinfo[i].sample = sample;
-							sample += last_samples;
-						}
-					}
-					if (stsc_entries == 0) {
-						for (i = first - 1; i < entries; ++i) {
-							l->chunkinfo[i].sample = sample;
-							sample += samples;
-						}
-					}
-					last = first;
-					last_samples = samples;
-					ptr += 12;
-				}
-				free(l->stsc);
-				l->stsc = NULL;
-			}
-		}
-
-		// found media data, advance to start of first chunk and return
-		if (!strcmp(type, "mdat")) {
-			_buf_inc_readp(streambuf, 8);
-			l->pos += 8;
-			bytes  -= 8;
-			if (l->play) {
-				LOG_DEBUG("type: mdat len: %u pos: %u", len, l->pos);
-				if (l->chunkinfo && l->chunkinfo[0].offset > l->pos) {
-					u32_t skip = l->chunkinfo[0].offset - l->pos;
-					LOG_DEBUG("skipping: %u", skip);
-					if (skip <= bytes) {
-						_buf_inc_readp(streambuf, skip);
-						l->pos += skip;
-					} else {
-						l->consume = skip;
-					}
-				}
-				l->sample = l->nextchunk = 1;
-				l->block_index = 0;
-				return 1;
-			} else {
-				LOG_DEBUG("type: mdat len: %u, no playable track found", len);
-				return -1;
-			}
-		}
-
-		// parse key-value atoms within ilst ---- entries to get encoder padding within iTunSMPB entry for gapless
-		if (!strcmp(type, "----") && bytes > len) {
-			u8_t *ptr = streambuf->readp + 8;
-			u32_t remain = len - 8, size;
-			if (!memcmp(ptr + 4, "mean", 4) && (size = unpackN((u32_t *)ptr)) < remain) {
-				ptr += size; remain -= size;
-			}
-			if (!memcmp(ptr + 4, "name", 4) && (size = unpackN((u32_t *)ptr)) < remain && !memcmp(ptr + 12, "iTunSMPB", 8)) {
-				ptr += size; remain -= size;
-			}
-			if (!memcmp(ptr + 4, "data", 4) && remain > 16 + 48) {
-				// data is stored as hex strings: 0 start end samples
-				u32_t b, c; u64_t d;
-				if (sscanf((const char *)(ptr + 16), "%x %x %x " FMT_x64, &b, &b, &c, &d) == 4) {
-					LOG_DEBUG("iTunSMPB start: %u end: %u samples: " FMT_u64, b, c, d);
-					if (l->sttssamples && l->sttssamples < b + c + d) {
-						LOG_DEBUG("reducing samples as stts count is less");
-						d = l->sttssamples - (b + c);
-					}
-					l->skip = b;
-					l->samples = d;
-				}
-			}
-		}
-
-		// default to consuming entire box
-		consume = len;
-
-		// read into these boxes so reduce consume
-		if (!strcmp(type, "moov") || !strcmp(type, "trak") || !strcmp(type, "mdia") || !strcmp(type, "minf") || !strcmp(type, "stbl") ||
-			!strcmp(type, "udta") || !strcmp(type, "ilst")) {
-			consume = 8;
-		}
-		// special cases which mix mix data in the enclosing box which we want to read into
-		if (!strcmp(type, "stsd")) consume = 16;
-		if (!strcmp(type, "mp4a")) consume = 36;
-		if (!strcmp(type, "meta")) consume = 12;
-
-		// consume rest of box if it has been parsed (all in the buffer) or is not one we want to parse
-		if (bytes >= consume) {
-			LOG_DEBUG("type: %s len: %u consume: %u", type, len, consume);
-			_buf_inc_readp(streambuf, consume);
-			l->pos += consume;
-			bytes -= consume;
-		} else if ( !(!strcmp(type, "esds") || !strcmp(type, "stts") || !strcmp(type, "stsc") ||
-					  !strcmp(type, "stsz") || !strcmp(type, "stco") || !strcmp(type, "----")) ) {
-			LOG_DEBUG("type: %s len: %u consume: %u - partial consume: %u", type, len, consume, bytes);
-			_buf_inc_readp(streambuf, bytes);
-			l->pos += bytes;
-			l->consume = consume - bytes;
-			break;
-		} else if (len > streambuf->size) {
- 			// can't process an atom larger than streambuf!
-			LOG_ERROR("atom %s too large for buffer %u %u", type, len, streambuf->size);
-			return -1;
-		 } else {
-			 // make sure there is 'len' contiguous space
-			_buf_unwrap(streambuf, len); 
-			break;
-		 }
+	l->decoder = alac_create_decoder(len - 36, box + 36, &l->sample_size, &l->sample_rate, &l->channels, &block_size);
+	l->writebuf = malloc(block_size + 256);
+	LOG_INFO("allocated write buffer of %u bytes", block_size);
+	if (!l->writebuf) {
+		LOG_ERROR("allocation failed");
+		return false;
 	}
 
-	return 0;
+	return true;
 }
 
 static decode_state alac_decode(void) {
-	size_t bytes;
-	bool endstream;
+	int size;
 	u8_t *iptr;
-	u32_t frames, block_size;
+	u32_t frames;
 
 	LOCK_S;
 
-		// data not reached yet
-	if (l->consume) {
-		u32_t consume = min(l->consume, _buf_used(streambuf));
-		LOG_DEBUG("consume: %u of %u", consume, l->consume);
-		_buf_inc_readp(streambuf, consume);
-		l->pos += consume;
-		l->consume -= consume;
+	// data not reached yet
+	if (mp4_skip(&l->mp4)) {
 		UNLOCK_S;
 		return DECODE_RUNNING;
 	}
@@ -336,10 +114,16 @@ static decode_state alac_decode(void) {
 		int found = 0;
 
 		// mp4 - read header
-		found = read_mp4_header();
+		found = mp4_header(&l->mp4);
 
 		if (found == 1) {
-			bytes = min(_buf_used(streambuf), _buf_cont_read(streambuf));
+			// samples crossing the end of streambuf are copied here
+			l->readbuf = malloc(l->mp4.max_size);
+			if (!l->readbuf) {
+				LOG_ERROR("can't allocate read buffer of %u bytes", l->mp4.max_size);
+				UNLOCK_S;
+				return DECODE_ERROR;
+			}
 
 			LOG_INFO("setting track_start");
 			LOCK_O;
@@ -351,7 +135,7 @@ static decode_state alac_decode(void) {
 
 			UNLOCK_O;
 		} else if (found == -1) {
-			LOG_WARN("[%p]: error reading stream header");
+			LOG_WARN("error reading stream header");
 			UNLOCK_S;
 			return DECODE_ERROR;
 		} else {
@@ -361,69 +145,34 @@ static decode_state alac_decode(void) {
 		}
 	}
 
-	bytes = _buf_used(streambuf);
-	block_size = l->default_block_size ? l->default_block_size : l->block_size[l->block_index];
+	size = mp4_next(&l->mp4);
 
-	// stream terminated
-	if (stream.state <= DISCONNECT && (bytes == 0 || block_size == 0)) {
+	// stream terminated or last sample decoded
+	if (size == MP4_END) {
 		UNLOCK_S;
 		LOG_DEBUG("end of stream");
 		return DECODE_COMPLETE;
 	}
 
 	// is there enough data for decoding
-	if (bytes < block_size) {
+	if (size == MP4_WAIT) {
 		UNLOCK_S;
 		return DECODE_RUNNING;
-	} else if (block_size != l->default_block_size) l->block_index++;
-
-	bytes = min(bytes, _buf_cont_read(streambuf));
-
-	// need to create a buffer with contiguous data
-	if (bytes < block_size) {
-		iptr = malloc(block_size);
-		memcpy(iptr, streambuf->readp, bytes);
-		memcpy(iptr + bytes, streambuf->buf, block_size - bytes);
-	} else iptr = streambuf->readp;
+	}
 
-	if (!alac_to_pcm(l->decoder, iptr, l->writebuf, 2, &frames)) {
+	if (size == MP4_ERROR || !alac_to_pcm(l->decoder, mp4_data(size, l->readbuf), l->writebuf, 2, &frames)) {
 		LOG_ERROR("decode error");
 		UNLOCK_S;
 		return DECODE_ERROR;
 	}
 
-	// and free it
-	if (bytes < block_size) free(iptr);
-
-	LOG_SDEBUG("block of %u bytes (%u frames)", block_size, frames);
-
-	endstream = false;
-	// mp4 end of chunk - skip to next offset
-	if (l->chunkinfo && l->chunkinfo[l->nextchunk].offset && l->sample++ == l->chunkinfo[l->nextchunk].sample) {
-		 if (l->chunkinfo[l->nextchunk].offset > l->pos) {
-			u32_t skip = l->chunkinfo[l->nextchunk].offset - l->pos;
-			if (_buf_used(streambuf) >= skip) {
-				_buf_inc_readp(streambuf, skip);
-				l->pos += skip;
-			} else {
-				l->consume = skip;
-			}
-			l->nextchunk++;
-		 } else {
-			LOG_ERROR("error: need to skip backwards!");
-			endstream = true;
-		 }
-	// mp4 when not at end of chunk
-	} else if (frames) {
-		_buf_inc_readp(streambuf, block_size);
-		l->pos += block_size;
-	} else {
-		endstream = true;
-	}
+	LOG_SDEBUG("block of %u bytes (%u frames)", size, frames);
+
+	mp4_advance(&l->mp4, size);
 
 	UNLOCK_S;
 
-	if (endstream) {
+	if (!frames) {
 		LOG_WARN("unable to decode further");
 		return DECODE_ERROR;
 	}
@@ -431,26 +180,26 @@ static decode_state alac_decode(void) {
 	// now point at the beginning of decoded samples
 	iptr = l->writebuf;
 
-	if (l->skip) {
+	if (l->mp4.skip) {
 		u32_t skip;
 		if (l->empty) {
 			l->empty = false;
-			l->skip -= frames;
+			l->mp4.skip -= frames;
 			LOG_DEBUG("gapless: first frame empty, skipped %u frames at start", frames);
 		}
-		skip = min(frames, l->skip);
+		skip = min(frames, l->mp4.skip);
 		LOG_DEBUG("gapless: skipping %u frames at start", skip);
 		frames -= skip;
-		l->skip -= skip;
+		l->mp4.skip -= skip;
 		iptr += skip * l->channels * l->sample_size;
 	}
 
-	if (l->samples) {
-		if (l->samples < frames) {
-			LOG_DEBUG("gapless: trimming %u frames from end", frames - l->samples);
-			frames = (u32_t) l->samples;
+	if (l->mp4.samples) {
+		if (l->mp4.samples < frames) {
+			LOG_DEBUG("gapless: trimming %u frames from end", frames - l->mp4.samples);
+			frames = (u32_t) l->mp4.samples;
 		}
-		l->samples -= frames;
+		l->mp4.samples -= frames;
 	}
 
 	LOCK_O_direct;
@@ -520,14 +269,14 @@ static decode_state alac_decode(void) {
 static void alac_close(void) {
 	if (l->decoder) alac_delete_decoder(l->decoder);
 	if (l->writebuf) free(l->writebuf);	
-	if (l->chunkinfo) free(l->chunkinfo);
-	if (l->block_size) free(l->block_size);
-	if (l->stsc) free(l->stsc);
+	if (l->readbuf) free(l->readbuf);
+	mp4_close(&l->mp4);
 	memset(l, 0, sizeof(struct alac));	
 }
 
 static void alac_open(u8_t size, u8_t rate, u8_t chan, u8_t endianness) {
 	alac_close();
+	mp4_init(&l->mp4, "alac", alac_config, l);
 }
 
 struct codec *register_alac(void) {
@@ -23,6 +23,10 @@
 
 #include "squeezelite.h"
 
+#if EMBEDDED
+#include "scheduler.h"
+#endif
+
 log_level loglevel;
 
 extern struct buffer *streambuf;
@@ -36,6 +40,14 @@ struct codec *codecs[MAX_CODECS];
 struct codec *codec;
 static bool running = true;
 
+#if EMBEDDED
+// per call cost of codecs, frames per second of cpu is decode.frames / decode.cpu_us
+static TELEMETRY_HISTOGRAM_DEFINE(telemetry_decode, "decode_us");
+static TELEMETRY_HISTOGRAM_DEFINE(telemetry_decode_bytes, "decode.bytes");
+static TELEMETRY_COUNTER_DEFINE(telemetry_decode_frames, "decode.frames");
+static TELEMETRY_COUNTER_DEFINE(telemetry_decode_cpu, "decode.cpu_us");
+#endif
+
 #define LOCK_S   mutex_lock(streambuf->mutex)
 #define UNLOCK_S mutex_unlock(streambuf->mutex)
 #define LOCK_O   mutex_lock(outputbuf->mutex)
@@ -83,7 +95,25 @@ static void *decode_thread() {
 
 			if (space > min_space && (bytes > codec->min_read_bytes || toend)) {
 				
+#if EMBEDDED
+				// only decoder moves these pointers (a flush in between gives one wrong sample)
+				u8_t *readp = streambuf->readp, *writep = outputbuf->writep;
+				u32_t start = telemetry_now();
 				decode.state = codec->decode();
+				u32_t elapsed = telemetry_now() - start;
+
+				telemetry_observe(&telemetry_decode, elapsed);
+				telemetry_count(&telemetry_decode_cpu, elapsed);
+				telemetry_observe(&telemetry_decode_bytes, (streambuf->size + streambuf->readp - readp) % streambuf->size);
+				IF_DIRECT(
+					telemetry_count(&telemetry_decode_frames, (outputbuf->size + outputbuf->writep - writep) % outputbuf->size / BYTES_PER_FRAME);
+				);
+				IF_PROCESS(
+					telemetry_count(&telemetry_decode_frames, process.in_frames);
+				);
+#else
+				decode.state = codec->decode();
+#endif
 
 				IF_PROCESS(
 					if (process.in_frames) {
@@ -211,7 +241,13 @@ void decode_init(log_level level, const char *include_codecs, const char *exclud
 	pthread_attr_t attr;
 	pthread_attr_init(&attr);
 #ifdef PTHREAD_STACK_MIN
+#if EMBEDDED
+	sched_profile_t sched;
+	sched_get("decode", &sched);
+	pthread_attr_setstacksize(&attr, PTHREAD_STACK_MIN + (sched.stack ? sched.stack : DECODE_THREAD_STACK_SIZE));
+#else
 	pthread_attr_setstacksize(&attr, PTHREAD_STACK_MIN + DECODE_THREAD_STACK_SIZE);
+#endif
 #endif
 	pthread_create_name(&thread, &attr, decode_thread, NULL, "decode");
 	pthread_attr_destroy(&attr);
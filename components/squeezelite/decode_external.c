@@ -353,8 +353,13 @@ static bool raop_sink_cmd_handler(raop_event_t event, va_list args)
  * cspot sink data handler
  */
 #if CONFIG_CSPOT_SINK
+static TELEMETRY_HISTOGRAM_DEFINE(telemetry_cspot_refill, "cspot.refill_us");
+
 static uint32_t cspot_sink_data_handler(const uint8_t *data, uint32_t len) {
-    return sink_data_handler(data, len, 0);
+	uint32_t start = telemetry_now();
+    uint32_t written = sink_data_handler(data, len, 0);
+	telemetry_elapsed(&telemetry_cspot_refill, start);
+	return written;
 }    
 
 /****************************************************************************************
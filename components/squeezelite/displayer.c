@@ -17,6 +17,7 @@
 #include "gds_draw.h"
 #include "gds_image.h"
 #include "led_vu.h"
+#include "scheduler.h"
 
 #pragma pack(push, 1)
 
@@ -158,6 +159,9 @@ static uint32_t *grayMap;
 
 #define DISPLAY_BW	20000
 
+// grfs offset is 16 bits, so LMS can't send more than that plus one packet
+#define SCROLL_MAX	(64*1024 + 4096)
+
 static struct scroller_s {
 	// copy of grfs content
 	u8_t  screen;	
@@ -179,6 +183,7 @@ static struct scroller_s {
 	} back;
 	u8_t *frame;
 	u32_t width;
+	int stride;		// bytes per column
 } scroller;
 
 static struct {
@@ -260,6 +265,7 @@ static void visu_handler(u8_t *data, int len);
 static void ledv_handler(u8_t *data, int len);
 static void ledd_handler(u8_t *data, int len);
 static void displayer_task(void* arg);
+static void scroller_compose(void);
 
 /* scrolling undocumented information
 	grfs	
@@ -346,11 +352,12 @@ bool sb_displayer_init(void) {
 		// prepare the VU raw data in PSRAM
 		memcpy(vu_bitmap, vu_base, sizeof(vu_bitmap));
 		
-		// size scroller (width + current screen)
-		scroller.scroll.max = (displayer.width * displayer.height / 8) * (15 + 1);
+		// size scroller (width + current screen), will grow on demand up to SCROLL_MAX
+		scroller.stride = displayer.height / 8;
+		scroller.scroll.max = (displayer.width * scroller.stride) * (15 + 1);
 		scroller.scroll.frame = malloc(scroller.scroll.max);
-		scroller.back.frame = malloc(displayer.width * displayer.height / 8);
-		scroller.frame = malloc(displayer.width * displayer.height / 8);
+		scroller.back.frame = malloc(displayer.width * scroller.stride);
+		scroller.frame = malloc(displayer.width * scroller.stride);
 		
 		// chain handlers
 		display_bus_chain = display_bus;
@@ -370,7 +377,9 @@ bool sb_displayer_init(void) {
 		
 	// create displayer management task
 	displayer.mutex = xSemaphoreCreateMutex();
-	displayer.task = xTaskCreateStatic( (TaskFunction_t) displayer_task, "sb_displayer", SCROLL_STACK_SIZE, NULL, ESP_TASK_PRIO_MIN + 1, xStack, &xTaskBuffer);
+	sched_profile_t sched;
+	sched_get("sb_displayer", &sched);
+	displayer.task = xTaskCreateStaticPinnedToCore( (TaskFunction_t) displayer_task, "sb_displayer", SCROLL_STACK_SIZE, NULL, sched.priority, xStack, &xTaskBuffer, sched.core);
 	
 	// chain handlers
 	slimp_handler_chain = slimp_handler;
@@ -477,26 +486,38 @@ static void server(in_addr_t ip, u16_t hport, u16_t cport) {
 static bool handler(u8_t *data, int len){
 	bool res = true;
 
-	if (!strncmp((char*) data, "vfdc", 4)) {
+	// graphic packets are used in place, only a scroller or a split artwork needs a copy
+	switch (PKT_OPCODE(data)) {
+	case OPCODE('v','f','d','c'):
 		vfdc_handler(data, len);
-	} else if (!strncmp((char*) data, "grfe", 4)) {
-		grfe_handler(data, len);
-	} else if (!strncmp((char*) data, "grfb", 4)) {
-		grfb_handler(data, len);
-	} else if (!strncmp((char*) data, "grfs", 4)) {
-		grfs_handler(data, len);		
-	} else if (!strncmp((char*) data, "grfg", 4)) {
-		grfg_handler(data, len);
-	} else if (!strncmp((char*) data, "grfa", 4)) {
-		grfa_handler(data, len);		
-	} else if (!strncmp((char*) data, "visu", 4)) {
+		break;
+	case OPCODE('g','r','f','e'):
+		if (len >= sizeof(struct grfe_packet)) grfe_handler(data, len);
+		break;
+	case OPCODE('g','r','f','b'):
+		if (len >= sizeof(struct grfb_packet)) grfb_handler(data, len);
+		break;
+	case OPCODE('g','r','f','s'):
+		if (len >= sizeof(struct grfs_packet)) grfs_handler(data, len);
+		break;
+	case OPCODE('g','r','f','g'):
+		if (len >= sizeof(struct grfg_packet)) grfg_handler(data, len);
+		break;
+	case OPCODE('g','r','f','a'):
+		if (len >= sizeof(struct grfa_packet)) grfa_handler(data, len);
+		break;
+	case OPCODE('v','i','s','u'):
 		visu_handler(data, len);
-	} else if (!strncmp((char*) data, "ledv", 4)) {
+		break;
+	case OPCODE('l','e','d','v'):
 		ledv_handler(data, len);
-	} else if (!strncmp((char*) data, "ledd", 4)) {
-		ledd_handler(data, len);		
-	} else {
+		break;
+	case OPCODE('l','e','d','d'):
+		ledd_handler(data, len);
+		break;
+	default:
 		res = false;
+		break;
 	}
 
 	// chain protocol handlers (bitwise or is fine)
@@ -706,7 +727,7 @@ static void grfe_handler( u8_t *data, int len) {
 	// are we in control
 	if (displayer.owned) {
 		// draw new frame, it might be less than full screen (small visu)
-		int width = ((len - sizeof(struct grfe_packet)) * 8) / displayer.height;
+		int width = min(((len - sizeof(struct grfe_packet)) * 8) / displayer.height, displayer.width);
 
 		// did we have something that might have written on the bottom of a displayer's height + display
 		if (displayer.dirty || (artwork.enable && width == displayer.width && artwork.y < displayer.height)) {
@@ -800,14 +821,27 @@ static void grfs_handler(u8_t *data, int len) {
 		xSemaphoreGive(displayer.mutex);
 	}	
 
+	// grow scroll buffer if needed (PSRAM when available), take lock as scroller task uses it
+	if (offset + size > scroller.scroll.max && offset + size <= SCROLL_MAX && !scroller.overflow) {
+		u32_t grow = min(max(scroller.scroll.max * 2, offset + size), SCROLL_MAX);
+		xSemaphoreTake(displayer.mutex, portMAX_DELAY);
+		u8_t *frame = realloc(scroller.scroll.frame, grow);
+		if (frame) {
+			scroller.scroll.frame = frame;
+			scroller.scroll.max = grow;
+			LOG_INFO("scroller grown to %u", grow);
+		}
+		xSemaphoreGive(displayer.mutex);
+	}
+
 	// copy scroll frame data (no semaphore needed)
-	if (scroller.scroll.size + size < scroller.scroll.max && !scroller.overflow) {
+	if (offset + size <= scroller.scroll.max && !scroller.overflow) {
 		memcpy(scroller.scroll.frame + offset, data + sizeof(struct grfs_packet), size);
 		scroller.scroll.size = offset + size;
 		LOG_INFO("scroller current size %u (w:%u)", scroller.scroll.size, scroller.scroll.width);
 	} else {
-		LOG_INFO("scroller too large %u/%u (w:%u)", scroller.scroll.size + size, scroller.scroll.max, scroller.scroll.width);
-		scroller.scroll.width = scroller.scroll.size / (displayer.height / 8) - scroller.back.width;
+		LOG_INFO("scroller too large %u/%u (w:%u)", offset + size, scroller.scroll.max, scroller.scroll.width);
+		scroller.scroll.width = scroller.scroll.size / scroller.stride - scroller.back.width;
 		scroller.overflow = true;
 	}	
 }
@@ -829,12 +863,11 @@ static void grfg_handler(u8_t *data, int len) {
 		
 	// size of scrollable area (less than background)
 	scroller.width = htons(pkt->width);
-	scroller.back.width = ((len - sizeof(struct grfg_packet)) * 8) / displayer.height;
-	memcpy(scroller.back.frame, data + sizeof(struct grfg_packet), len - sizeof(struct grfg_packet));
+	scroller.back.width = min((len - sizeof(struct grfg_packet)) / scroller.stride, displayer.width);
+	memcpy(scroller.back.frame, data + sizeof(struct grfg_packet), scroller.back.width * scroller.stride);
 		
 	// update display asynchronously (frames are organized by columns)
-	memcpy(scroller.frame, scroller.back.frame, scroller.back.width * displayer.height / 8);
-	for (int i = 0; i < scroller.width * displayer.height / 8; i++) scroller.frame[i] |= scroller.scroll.frame[scroller.scrolled * displayer.height / 8 + i];
+	scroller_compose();
 	
 	// can only write if we really own display
 	if (displayer.owned) {
@@ -855,6 +888,16 @@ static void grfg_handler(u8_t *data, int len) {
 }
 
 
+/****************************************************************************************
+ * Draw a complete artwork
+ */
+static void artwork_draw(u8_t *data) {
+	GDS_ClearWindow(display, artwork.x, artwork.y, -1, -1, GDS_COLOR_BLACK);
+	xSemaphoreTake(displayer.mutex, portMAX_DELAY);			
+	GDS_DrawJPEG(display, data, artwork.x, artwork.y, artwork.y < displayer.height ? (GDS_IMAGE_RIGHT | GDS_IMAGE_TOP) : GDS_IMAGE_CENTER);
+	xSemaphoreGive(displayer.mutex);		
+}
+
 /****************************************************************************************
  * Artwork
  */
@@ -882,7 +925,7 @@ static void grfa_handler(u8_t *data, int len) {
 		return;
 	}
 	
-	// new grfa artwork, allocate memory
+	// new grfa artwork
 	if (!offset) {	
 		// same trick to clean current/previous window
 		if (artwork.size) {
@@ -895,17 +938,29 @@ static void grfa_handler(u8_t *data, int len) {
 		artwork.y = htons(pkt->y);
 		artwork.full = artwork.enable && artwork.x == 0 && artwork.y == 0;
 		if (artwork.data) free(artwork.data);
+		artwork.data = NULL;
+
+		// artwork in a single packet is drawn from there
+		if (size == length) {
+			artwork_draw(data + sizeof(struct grfa_packet));
+			artwork.size = length;
+			LOG_DEBUG("gfra l:%u x:%hu, y:%hu (in place)", length, artwork.x, artwork.y);
+			return;
+		}
+
 		artwork.data = malloc(length);		
 	}	
 	
-	// copy artwork data
+	// copy artwork data, ignoring chunks that don't belong to it
+	if (!artwork.data || offset < 0 || size < 0 || offset + size > length || offset != artwork.size) {
+		LOG_WARN("unexpected artwork chunk o:%d s:%d l:%d", offset, size, length);
+		return;
+	}
+
 	memcpy(artwork.data + offset, data + sizeof(struct grfa_packet), size);
 	artwork.size += size;
 	if (artwork.size == length) {
-		GDS_ClearWindow(display, artwork.x, artwork.y, -1, -1, GDS_COLOR_BLACK);
-		xSemaphoreTake(displayer.mutex, portMAX_DELAY);			
-		GDS_DrawJPEG(display, artwork.data, artwork.x, artwork.y, artwork.y < displayer.height ? (GDS_IMAGE_RIGHT | GDS_IMAGE_TOP) : GDS_IMAGE_CENTER);
-		xSemaphoreGive(displayer.mutex);		
+		artwork_draw(artwork.data);
 		free(artwork.data);
 		artwork.data = NULL;
 	} 
@@ -1085,28 +1140,13 @@ static void displayer_update(void) {
 		visu_draw();
 	}	
 	
-	// actualize led_vu
+	// actualize led_vu (effects engine does the rendering & interpolation)
 	if (led_display && led_visu.mode) {
-		// run built in visualizer effects
-		if (led_visu.mode == VISU_VUMETER) {
-			vu_scale(led_visu.bars, led_visu.gain, meters.levels);
-			led_vu_display(led_visu.bars[0].current, led_visu.bars[1].current, led_visu.max, led_visu.style);
-		} else if (led_visu.mode == VISU_SPECTRUM) { 
-			spectrum_scale(led_visu.n, led_visu.bars, led_visu.gain, meters.samples);
-			uint8_t* p = (uint8_t*) led_data;
-			for (int i = 0; i < led_visu.n; i++) {
-				*p = led_visu.bars[i].current;
-				p++;
-			}
-			led_vu_spectrum(led_data, led_visu.max, led_visu.n, led_visu.style);
-		} else if (led_visu.mode == VISU_WAVEFORM) {
-			spectrum_scale(led_visu.n, led_visu.bars, led_visu.gain, meters.samples);
-			led_vu_spin_dial(
-				led_visu.bars[led_visu.n-2].current,
-				led_visu.bars[(led_visu.n/2)+1].current * 50 / led_visu.max,
-				led_visu.bars[1].current * 4 / led_visu.max,
-				led_visu.style);
-		} 
+		int n = led_visu.mode == VISU_VUMETER ? 2 : led_visu.n;
+		if (led_visu.mode == VISU_VUMETER) vu_scale(led_visu.bars, led_visu.gain, meters.levels);
+		else spectrum_scale(led_visu.n, led_visu.bars, led_visu.gain, meters.samples);
+		for (int i = 0; i < n; i++) led_data[i] = min(led_visu.bars[i].current, 255);
+		led_vu_fx_feed(led_visu.mode, led_data, n, led_visu.max, led_visu.style);
 	}
 }
 
@@ -1295,6 +1335,7 @@ static void ledv_handler( u8_t *data, int len) {
 		
 		LOG_INFO("LED Visualizer mode %u with bars:%u max:%u style:%d gain:%u", led_visu.mode, led_visu.n, led_visu.max, led_visu.style, led_visu.gain);
 	} else {
+		led_vu_fx_stop();
 		led_vu_clear();
 	
 		LOG_INFO("Stopping led visualizer");
@@ -1326,6 +1367,27 @@ static void ledd_handler( u8_t *data, int len) {
 	xSemaphoreGive(displayer.mutex);
 }	
 
+/****************************************************************************************
+ * Compose scroll window over background
+ * Frames are column-major, so a window is a contiguous slice of the scroll frame and 
+ * can be OR'd 32 bits at a time when both sides are aligned (always true with 32 pixels 
+ * height as stride is then 4 bytes)
+ */
+static void scroller_compose(void) {
+	u8_t *src = scroller.scroll.frame + scroller.scrolled * scroller.stride;
+	u8_t *dst = scroller.frame;
+	int len = scroller.width * scroller.stride;
+
+	memcpy(scroller.frame, scroller.back.frame, scroller.back.width * scroller.stride);
+	
+	if (!(((uintptr_t) src | (uintptr_t) dst) & 0x03)) {
+		for (int i = len >> 2; --i >= 0; src += 4, dst += 4) *(u32_t*) dst |= *(u32_t*) src;
+		len &= 0x03;
+	}
+	
+	while (--len >= 0) *dst++ |= *src++;
+}
+
 /****************************************************************************************
  * Scroll task
  *  - with the addition of the visualizer, it's a bit a 2-headed beast not easy to 
@@ -1356,8 +1418,7 @@ static void displayer_task(void *args) {
 			
 			// do we have more to scroll (scroll.width is the last column from which we have a full zone)
 			if (scroller.by > 0 ? (scroller.scrolled <= scroller.scroll.width) : (scroller.scrolled >= 0)) {
-				memcpy(scroller.frame, scroller.back.frame, scroller.back.width * displayer.height / 8);
-				for (int i = 0; i < scroller.width * displayer.height / 8; i++) scroller.frame[i] |= scroller.scroll.frame[scroller.scrolled * displayer.height / 8 + i];
+				scroller_compose();
 				scroller.scrolled += scroller.by;
 				if (displayer.owned) GDS_DrawBitmapCBR(display, scroller.frame, scroller.width, displayer.height, GDS_COLOR_WHITE);	
 				
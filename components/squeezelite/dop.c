@@ -0,0 +1,220 @@
+/*
+ *  Squeezelite - lightweight headless squeezebox emulator
+ *
+ *  (c) Adrian Smith 2012-2015, triode1@btinternet.com
+ *  (c) Philippe, philippe_44@outlook.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "squeezelite.h"
+
+#if !DSD
+
+#include <math.h>
+
+#if EMBEDDED
+#include "esp_heap_caps.h"
+#endif
+
+/*
+ DoP to PCM conversion used when there is no DSD output path, otherwise DoP would be
+ played as full scale noise. Each DoP frame carries 16 DSD bits per channel, so a 16:1
+ decimation gives PCM at the DoP frame rate (176.4kHz for DSD64) and output does not
+ have to change rate. The FIR is linear phase: its taps are grouped by 8 in tables
+ indexed by DSD bytes and the second half of the filter uses the same tables with
+ bit-reversed bytes. That's 16 lookups per sample, no multiply. Tables are 8kB and are
+ read randomly, so they are kept in internal RAM. Outputs have no DSD path (native or
+ DoP passthrough), so DoP is always played as PCM.
+*/
+
+#define DOP_TAPS		128
+#define DOP_BYTES		(DOP_TAPS / 8)
+#define DOP_CUTOFF		(30000.0 / 2822400.0)
+#define DOP_MARKER(s)	(((s) >> 16) & 0xff)
+#define DSD_SILENCE		0x69
+#define BENCH_RATE		176400	// DoP frame rate of DSD64
+
+extern log_level loglevel;
+
+static struct {
+	s32_t (*table)[256];
+	u8_t history[2][DOP_BYTES * 2];
+	unsigned pos;
+} dop;
+
+static u8_t reverse[256];
+
+#if EMBEDDED
+static TELEMETRY_COUNTER_DEFINE(telemetry_dop_frames, "dop.frames");
+static TELEMETRY_COUNTER_DEFINE(telemetry_dop_cpu, "dop.cpu_us");
+#define NOW_US() telemetry_now()
+#else
+#define NOW_US() (gettime_ms() * 1000)
+#endif
+
+/****************************************************************************************
+ * DoP markers alternate between 0x05 and 0xfa and are the same for both channels
+ */
+bool dop_check(const s32_t *lptr, const s32_t *rptr, frames_t frames) {
+	u8_t marker = DOP_MARKER(*lptr);
+
+	if (frames < 8 || (marker != 0x05 && marker != 0xfa)) return false;
+
+	for (frames_t i = 0; i < min(frames, 32); i++, marker = ~marker) {
+		if (DOP_MARKER(lptr[i]) != marker || DOP_MARKER(rptr[i]) != marker) return false;
+	}
+
+	return true;
+}
+
+/****************************************************************************************
+ * Build filter tables once
+ */
+static bool build_tables(void) {
+	if (!dop.table) {
+		double taps[DOP_TAPS], sum = 0;
+
+#if EMBEDDED
+		dop.table = heap_caps_malloc(DOP_BYTES / 2 * sizeof(*dop.table), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#else
+		dop.table = malloc(DOP_BYTES / 2 * sizeof(*dop.table));
+#endif
+		if (!dop.table) {
+			LOG_ERROR("can't allocate DoP filter");
+			return false;
+		}
+
+		// windowed sinc (Blackman) normalized to unity gain
+		for (int t = 0; t < DOP_TAPS; t++) {
+			double x = t - (DOP_TAPS - 1) / 2.0;
+			double w = 0.42 - 0.5 * cos(2 * M_PI * t / (DOP_TAPS - 1)) + 0.08 * cos(4 * M_PI * t / (DOP_TAPS - 1));
+			taps[t] = 2 * DOP_CUTOFF * w * (x ? sin(2 * M_PI * DOP_CUTOFF * x) / (2 * M_PI * DOP_CUTOFF * x) : 1);
+			sum += taps[t];
+		}
+
+		// most significant bit is the oldest, a bit set is +1 and cleared is -1
+		for (int g = 0; g < DOP_BYTES / 2; g++) {
+			for (int byte = 0; byte < 256; byte++) {
+				double acc = 0;
+				for (int b = 0; b < 8; b++) acc += taps[g * 8 + 7 - b] * ((byte >> b) & 1 ? 1 : -1);
+				dop.table[g][byte] = lround(acc / sum * (1 << 30));
+			}
+		}
+
+		for (int byte = 0; byte < 256; byte++) {
+			u8_t r = 0;
+			for (int b = 0; b < 8; b++) if (byte & (1 << b)) r |= 0x80 >> b;
+			reverse[byte] = r;
+		}
+
+		LOG_INFO("DoP to PCM filter: %u taps", DOP_TAPS);
+	}
+
+	return true;
+}
+
+/****************************************************************************************
+ * Reset history for a new stream
+ */
+bool dop_open(void) {
+	if (!build_tables()) return false;
+
+	memset(dop.history, DSD_SILENCE, sizeof(dop.history));
+	dop.pos = 0;
+
+	return true;
+}
+
+/****************************************************************************************
+ * history is mirrored so that the DOP_BYTES window starting after the newest byte is
+ * always contiguous
+ */
+static inline s32_t decimate(u8_t *history, unsigned pos, u8_t older, u8_t newer) {
+	s32_t sum = 0;
+
+	history[pos] = history[pos + DOP_BYTES] = older;
+	history[pos + 1] = history[pos + 1 + DOP_BYTES] = newer;
+	history += pos + 2;
+
+	for (int g = 0; g < DOP_BYTES / 2; g++) {
+		sum += dop.table[g][history[g]] + dop.table[g][reverse[history[DOP_BYTES - 1 - g]]];
+	}
+
+	// unity DSD is full scale, so 0dB SACD (50% modulation) is -6dBFS and peaks above clip
+#if BYTES_PER_FRAME == 4
+	sum >>= 15;
+	return sum > 32767 ? 32767 : (sum < -32768 ? -32768 : sum);
+#else
+	return sum >= (1 << 30) ? INT32_MAX : (sum < -(1 << 30) ? INT32_MIN : sum * 2);
+#endif
+}
+
+/****************************************************************************************
+ * Samples are right-aligned 24 bits DoP: marker, older DSD byte, newer DSD byte
+ */
+void dop_to_pcm(ISAMPLE_T *optr, const s32_t *lptr, const s32_t *rptr, frames_t count) {
+#if EMBEDDED
+	u32_t start = telemetry_now();
+	telemetry_count(&telemetry_dop_frames, count);
+#endif
+
+	for (frames_t i = 0; i < count; i++) {
+		*optr++ = decimate(dop.history[0], dop.pos, lptr[i] >> 8, lptr[i]);
+		*optr++ = decimate(dop.history[1], dop.pos, rptr[i] >> 8, rptr[i]);
+		dop.pos = (dop.pos + 2) % DOP_BYTES;
+	}
+
+#if EMBEDDED
+	telemetry_count(&telemetry_dop_cpu, telemetry_now() - start);
+#endif
+}
+
+/****************************************************************************************
+ * Cost of converting DSD64, with its own history so that a playing stream is not disturbed.
+ * Whole seconds are converted until enough time is spent to be measured, returns report length
+ */
+size_t dop_bench(char *report, size_t size) {
+	u8_t history[2][DOP_BYTES * 2];
+	u32_t elapsed = 0, seconds = 0;
+	unsigned pos = 0;
+	volatile ISAMPLE_T sink;
+
+	if (!build_tables()) return snprintf(report, size, "DoP to PCM: no memory\n");
+
+	memset(history, DSD_SILENCE, sizeof(history));
+
+	while (seconds < 20 && elapsed < 200 * 1000) {
+		u32_t start = NOW_US();
+
+		for (u32_t i = 0; i < BENCH_RATE; i++) {
+			// any pattern that is not silence, content does not change the cost
+			u8_t older = i * 0x9d, newer = i * 0x3b;
+			sink = decimate(history[0], pos, older, newer);
+			sink = decimate(history[1], pos, newer, older);
+			pos = (pos + 2) % DOP_BYTES;
+		}
+
+		elapsed += NOW_US() - start;
+		seconds++;
+	}
+
+	(void) sink;
+	elapsed /= seconds;
+	return snprintf(report, size, "DoP to PCM: %u us per second of DSD64 (%u frames), %u.%u%% of cpu\n",
+					elapsed, BENCH_RATE, elapsed / 10000, elapsed / 1000 % 10);
+}
+
+#endif
@@ -21,6 +21,7 @@
 #include "messaging.h"
 #include "gpio_exp.h"
 #include "accessors.h"
+#include "scheduler.h"
 
 #ifndef CONFIG_POWER_GPIO_LEVEL
 #define CONFIG_POWER_GPIO_LEVEL 1
@@ -74,6 +75,11 @@ void *audio_calloc(size_t nmemb, size_t size) {
 int	pthread_create_name(pthread_t *thread, _CONST pthread_attr_t  *attr, 
 				   void *(*start_routine)( void * ), void *arg, char *name) {
 	esp_pthread_cfg_t cfg = esp_pthread_get_default_config(); 
+	sched_profile_t sched;
+	if (sched_get(name, &sched)) {
+		cfg.prio = sched.priority;
+		cfg.pin_to_core = sched.core;
+	}
 	cfg.thread_name = name; 
 	cfg.inherit_cfg = true; 
 	esp_pthread_set_cfg(&cfg); 
@@ -153,3 +159,24 @@ void set_name(char *name, char * cmd_set) {
 	free(q);
 	free(cmd);
 }
+
+/*
+ Cost of the audio processing that can't be measured on a PC, to be freed by caller. It
+ runs in the console task, so results are optimistic while something else is playing
+*/
+char *squeezelite_alloc_bench(void) {
+	size_t size = 1024, len = 0;
+	char *report = malloc(size);
+
+	if (!report) return NULL;
+	*report = '\0';
+
+#if !DSD
+	len += dop_bench(report + len, size - len);
+#endif
+#if RESAMPLE16
+	if (len < size) len += resample_bench(report + len, size - len);
+#endif
+
+	return report;
+}
@@ -2,6 +2,7 @@
 #define EMBEDDED_H
 #include <ctype.h>
 #include <inttypes.h>
+#include "telemetry.h"
 
 /* 	must provide 
 		- mutex_create_p
@@ -30,6 +31,7 @@ typedef unsigned long long u64_t;
 #define _CONST
 #endif
 
+// cores and priorities are set in services/scheduler.c
 #define STREAM_THREAD_STACK_SIZE  4 * 1024
 #define DECODE_THREAD_STACK_SIZE 14 * 1024
 #define OUTPUT_THREAD_STACK_SIZE  4 * 1024
@@ -82,21 +82,21 @@ static void calculate_loudness(void) {
  */
 void equalizer_init(void) {
     // handle equalizer
-	char *config = config_alloc_get(NVS_TYPE_STR, "equalizer");
-	char *p = strtok(config, ", !");
-
-	for (int i = 0; p && i < EQ_BANDS; i++) {
-		equalizer.gain[i] = atoi(p);
-		p = strtok(NULL, ", :");
+	if (!config_view_lock()) return;
+	const char *p = config_get_str_view("equalizer");
+
+	for (int i = 0; p && *p && i < EQ_BANDS; i++) {
+		char *end;
+		p += strspn(p, ", !:");
+		equalizer.gain[i] = strtol(p, &end, 10);
+		if (end == p) break;
+		p = end;
 	}
 
-	free(config);
-
     // handle loudness
-    config = config_alloc_get(NVS_TYPE_STR, "loudness");
-    equalizer.loudness = atof(config) / 10.0;
-
-	free(config);
+    p = config_get_str_view("loudness");
+    equalizer.loudness = p ? atof(p) / 10.0 : 0;
+	config_view_unlock();
 }
 
 /****************************************************************************************
@@ -34,9 +34,16 @@
 #define ALIGN32(n)	(n)
 #endif
 
+typedef void (*write_fn)(ISAMPLE_T *optr, const FLAC__int32 *lptr, const FLAC__int32 *rptr, frames_t count);
+
 struct flac {
 	FLAC__StreamDecoder *decoder;
 	u8_t container;
+	write_fn write;
+	unsigned bits_per_sample, channels;
+#if !DSD
+	bool dop;
+#endif
 #if !LINKALL
 	// FLAC symbols to be dynamically loaded
 	const char **FLAC__StreamDecoderErrorStatusString;
@@ -89,13 +96,9 @@ extern struct processstate process;
 #define LOCK_O   mutex_lock(outputbuf->mutex)
 #define UNLOCK_O mutex_unlock(outputbuf->mutex)
 #if PROCESS
-#define LOCK_O_direct   if (decode.direct) mutex_lock(outputbuf->mutex)
-#define UNLOCK_O_direct if (decode.direct) mutex_unlock(outputbuf->mutex)
 #define IF_DIRECT(x)    if (decode.direct) { x }
 #define IF_PROCESS(x)   if (!decode.direct) { x }
 #else
-#define LOCK_O_direct   mutex_lock(outputbuf->mutex)
-#define UNLOCK_O_direct mutex_unlock(outputbuf->mutex)
 #define IF_DIRECT(x)    { x }
 #define IF_PROCESS(x)
 #endif
@@ -108,6 +111,63 @@ extern struct processstate process;
 #define FLAC_A(h, a)     (h)->FLAC__ ## a
 #endif
 
+/* 
+ Conversion kernels from FLAC's int32 planes to outputbuf, selected once per stream so 
+ that the inner loops have no test. With 16 bits output, a frame is written at once 
+*/
+#if BYTES_PER_FRAME == 4
+#if SL_LITTLE_ENDIAN
+#define PACK(l, r)	((u16_t) (l) | (u32_t) (r) << 16)
+#else
+#define PACK(l, r)	((u16_t) (r) | (u32_t) (l) << 16)
+#endif
+#define WRITE_KERNELS(bits)																						\
+static void write_##bits##_stereo(ISAMPLE_T *optr, const FLAC__int32 *lptr, const FLAC__int32 *rptr, frames_t count) {	\
+	u32_t *wptr = (u32_t*) optr;																				\
+	while (count--) {																							\
+		*wptr++ = PACK(ALIGN##bits(*lptr), ALIGN##bits(*rptr));													\
+		lptr++; rptr++;																							\
+	}																											\
+}																												\
+static void write_##bits##_mono(ISAMPLE_T *optr, const FLAC__int32 *lptr, const FLAC__int32 *rptr, frames_t count) {	\
+	u32_t *wptr = (u32_t*) optr;																				\
+	while (count--) {																							\
+		u16_t sample = ALIGN##bits(*lptr++);																	\
+		*wptr++ = PACK(sample, sample);																			\
+	}																											\
+}
+#else
+#define WRITE_KERNELS(bits)																						\
+static void write_##bits##_stereo(ISAMPLE_T *optr, const FLAC__int32 *lptr, const FLAC__int32 *rptr, frames_t count) {	\
+	while (count--) {																							\
+		*optr++ = ALIGN##bits(*lptr++);																			\
+		*optr++ = ALIGN##bits(*rptr++);																			\
+	}																											\
+}																												\
+static void write_##bits##_mono(ISAMPLE_T *optr, const FLAC__int32 *lptr, const FLAC__int32 *rptr, frames_t count) {	\
+	while (count--) {																							\
+		ISAMPLE_T sample = ALIGN##bits(*lptr++);																\
+		*optr++ = sample;																						\
+		*optr++ = sample;																						\
+	}																											\
+}
+#endif
+
+WRITE_KERNELS(8)
+WRITE_KERNELS(16)
+WRITE_KERNELS(24)
+WRITE_KERNELS(32)
+
+static write_fn write_kernel(unsigned bits_per_sample, unsigned channels) {
+	static const write_fn kernels[4][2] = {
+		{ write_8_mono, write_8_stereo }, { write_16_mono, write_16_stereo }, 
+		{ write_24_mono, write_24_stereo }, { write_32_mono, write_32_stereo },
+	};
+
+	if (bits_per_sample % 8 || bits_per_sample < 8 || bits_per_sample > 32) return NULL;
+	return kernels[bits_per_sample / 8 - 1][channels > 1];
+}
+
 static FLAC__StreamDecoderReadStatus read_cb(const FLAC__StreamDecoder *decoder, FLAC__byte buffer[], size_t *want, void *client_data) {
 	size_t bytes;
 	bool end;
@@ -135,12 +195,14 @@ static FLAC__StreamDecoderWriteStatus write_cb(const FLAC__StreamDecoder *decode
 
 	FLAC__int32 *lptr = (FLAC__int32 *)buffer[0];
 	FLAC__int32 *rptr = (FLAC__int32 *)buffer[channels > 1 ? 1 : 0];
+	write_fn write;
 	
 	if (decode.new_stream) {
 		LOCK_O;
 		LOG_INFO("setting track_start");
 		output.track_start = outputbuf->writep;
 		decode.new_stream = false;
+		f->write = NULL;
 
 #if DSD
 #if SL_LITTLE_ENDIAN
@@ -162,6 +224,9 @@ static FLAC__StreamDecoderWriteStatus write_cb(const FLAC__StreamDecoder *decode
 			if (output.fade_mode) _checkfade(true);
 		}
 #else
+		// no DSD output, so DoP is converted to PCM at the same rate
+		f->dop = bits_per_sample == 24 && channels == 2 && dop_check(lptr, rptr, frames) && dop_open();
+		if (f->dop) LOG_INFO("file contains DOP, converting to PCM");
 		output.next_sample_rate = decode_newstream(frame->header.sample_rate, output.supported_rates);
 		if (output.fade_mode) _checkfade(true);
 #endif
@@ -169,16 +234,32 @@ static FLAC__StreamDecoderWriteStatus write_cb(const FLAC__StreamDecoder *decode
 		UNLOCK_O;
 	}
 
-	LOCK_O_direct;
+	// only first frame or a change of format needs a new kernel
+	if (bits_per_sample != f->bits_per_sample || channels != f->channels || !f->write) {
+		f->bits_per_sample = bits_per_sample;
+		f->channels = channels;
+		f->write = write_kernel(bits_per_sample, channels);
+#if !DSD
+		if (f->dop) f->write = bits_per_sample == 24 && channels == 2 ? dop_to_pcm : NULL;
+#endif
+		if (!f->write) {
+			LOG_ERROR("unsupported bits per sample: %u", bits_per_sample);
+			return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
+		}
+	}
+
+	write = f->write;
 
+	// we are the only writer and flush requires decode lock, so outputbuf is only locked to move pointers
 	while (frames > 0) {
 		frames_t f;
-		frames_t count;
 		ISAMPLE_T *optr;
 
 		IF_DIRECT( 
+			LOCK_O;
 			optr = (ISAMPLE_T *)outputbuf->writep; 
 			f = min(_buf_space(outputbuf), _buf_cont_write(outputbuf)) / BYTES_PER_FRAME; 
+			UNLOCK_O;
 		);
 		IF_PROCESS(
 			optr = (ISAMPLE_T *)process.inbuf;
@@ -187,36 +268,15 @@ static FLAC__StreamDecoderWriteStatus write_cb(const FLAC__StreamDecoder *decode
 
 		f = min(f, frames);
 
-		count = f;
-				
-		if (bits_per_sample == 8) {
-			while (count--) {
-				*optr++ = ALIGN8(*lptr++);
-				*optr++ = ALIGN8(*rptr++);
-			}
-		} else if (bits_per_sample == 16) {
-			while (count--) {
-				*optr++ = ALIGN16(*lptr++);
-				*optr++ = ALIGN16(*rptr++);
-			}
-		} else if (bits_per_sample == 24) {
-			while (count--) {
-				*optr++ = ALIGN24(*lptr++);
-				*optr++ = ALIGN24(*rptr++);
-			}
-		} else if (bits_per_sample == 32) {
-			while (count--) {
-				*optr++ = ALIGN32(*lptr++);
-				*optr++ = ALIGN32(*rptr++);
-			}
-		} else {
-			LOG_ERROR("unsupported bits per sample: %u", bits_per_sample);
-		}
-				
+		write(optr, lptr, rptr, f);
+		lptr += f;
+		rptr += f;
 		frames -= f;
 
 		IF_DIRECT(
+			LOCK_O;
 			_buf_inc_writep(outputbuf, f * BYTES_PER_FRAME);
+			UNLOCK_O;
 		);
 		IF_PROCESS(
 			process.in_frames = f;
@@ -224,8 +284,6 @@ static FLAC__StreamDecoderWriteStatus write_cb(const FLAC__StreamDecoder *decode
 		);
 	}
 
-	UNLOCK_O_direct;
-
 	return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
 }
 
@@ -324,6 +382,7 @@ struct codec *register_flac(void) {
 	}
 
 	f->decoder = NULL;
+	f->write = NULL;
 
 	if (!load_flac()) {
 		return NULL;
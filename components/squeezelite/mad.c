@@ -29,7 +29,6 @@
 
 struct mad {
 	u8_t *readbuf;
-	unsigned readbuf_len;
 	struct mad_stream stream;
 	struct mad_frame frame;
 	struct mad_synth synth;
@@ -39,6 +38,7 @@ struct mad {
 	u32_t consume;
 	u32_t skip;
 	u64_t samples;
+	bool trim;		// samples is what is left to play, drop anything after
 	u32_t padding;
 #if !LINKALL
 	// mad symbols to be dynamically loaded
@@ -98,13 +98,12 @@ static inline ISAMPLE_T scale(mad_fixed_t sample) {
 #if BYTES_PER_FRAME == 4	
 	return (ISAMPLE_T)((sample >> (MAD_F_FRACBITS + 1 - 24)) >> 8);
 #else	
-	return (ISAMPLE_T)((sample >> (MAD_F_FRACBITS + 1 - 24)) << 8);
+	return (ISAMPLE_T)((u32_t) (sample >> (MAD_F_FRACBITS + 1 - 24)) << 8);
 #endif	
 }
 
 // check for id3.2 tag at start of file - http://id3.org/id3v2.4.0-structure, return length
-static unsigned _check_id3_tag(size_t bytes) {
-	u8_t *ptr = streambuf->readp;
+static unsigned _check_id3_tag(u8_t *ptr, size_t bytes) {
 	u32_t size = 0;
 
 	if (bytes > 10 && *ptr == 'I' && *(ptr+1) == 'D' && *(ptr+2) == '3') {
@@ -118,64 +117,120 @@ static unsigned _check_id3_tag(size_t bytes) {
 	return size;
 }
 
-// check for lame gapless params, don't advance streambuf
-static void _check_lame_header(size_t bytes) {
-	u8_t *ptr = streambuf->readp;
+// parse mpeg audio frame header, return frame length or 0 if invalid/free format
+static unsigned _frame_header(u8_t *ptr, unsigned *samples, unsigned *side) {
+	static const u16_t bitrates[2][3][15] = {
+		{ { 0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448 },
+		  { 0, 32, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384 },
+		  { 0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320 } },
+		{ { 0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256 },
+		  { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 },
+		  { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 } },
+	};
+	static const u32_t rates[3] = { 44100, 48000, 32000 };
+	unsigned version = (ptr[1] >> 3) & 0x03, layer = 4 - ((ptr[1] >> 1) & 0x03);
+	unsigned index = ptr[2] >> 4, rate = (ptr[2] >> 2) & 0x03, padding = (ptr[2] >> 1) & 0x01;
+	bool mpeg1 = version == 3, mono = (ptr[3] >> 6) == 3;
+	u32_t bitrate, samplerate;
+
+	if (ptr[0] != 0xff || (ptr[1] & 0xe0) != 0xe0 || version == 1 || layer == 4 || index == 0 || index == 15 || rate == 3) {
+		return 0;
+	}
 
-	if (*ptr == 0xff && (*(ptr+1) & 0xf0) == 0xf0 && bytes > 180) {
+	bitrate = bitrates[!mpeg1][layer - 1][index] * 1000;
+	samplerate = rates[rate] >> (mpeg1 ? 0 : (version == 2 ? 1 : 2));
 
-		u32_t frame_count = 0, enc_delay = 0, enc_padding = 0;
-		u8_t flags;
+	// layer 3 side info size sets where Xing/Info tag lives
+	*side = 4 + ((ptr[1] & 0x01) ? 0 : 2) + (mpeg1 ? (mono ? 17 : 32) : (mono ? 9 : 17));
 
-		// 2 channels
-		if (!memcmp(ptr + 36, "Xing", 4) || !memcmp(ptr + 36, "Info", 4)) {
-			ptr += 36 + 7;
-		// mono	
-		} else if (!memcmp(ptr + 21, "Xing", 4) || !memcmp(ptr + 21, "Info", 4)) {
-			ptr += 21 + 7;
-		}
+	if (layer == 1) {
+		*samples = 384;
+		return (12 * bitrate / samplerate + padding) * 4;
+	}
 
-		flags = *ptr;
+	*samples = (layer == 3 && !mpeg1) ? 576 : 1152;
+	return *samples / 8 * bitrate / samplerate + padding;
+}
 
-		if (flags & 0x01) {
-			frame_count = unpackN((u32_t *)(ptr + 1));
-			ptr += 4;
-		}
-		if (flags & 0x02) ptr += 4;
-		if (flags & 0x04) ptr += 100;
-		if (flags & 0x08) ptr += 4;
+// check for xing/lame header, consume this empty frame and set gapless params from it
+static void _check_lame_header(u8_t *ptr, size_t bytes) {
+	u8_t *frame = ptr;
+	unsigned len, samples, side;
+	u32_t frame_count = 0, enc_delay, enc_padding;
+	u8_t flags;
 
-		if (!!memcmp(ptr+1, "LAME", 4)) {
-			return;
-		}
+	if (bytes < 4 || (len = _frame_header(ptr, &samples, &side)) == 0 || len > bytes || side + 8 > len) {
+		return;
+	}
 
-		ptr += 22;
+	ptr += side;
+	if (memcmp(ptr, "Xing", 4) && memcmp(ptr, "Info", 4)) {
+		return;
+	}
 
-		enc_delay   = (*ptr << 4 | *(ptr + 1) >> 4) + MAD_DELAY;
-		enc_padding = (*(ptr + 1) & 0xF) << 8 | *(ptr + 2);
-		enc_padding = enc_padding > MAD_DELAY ? enc_padding - MAD_DELAY : 0;
+	// the frame only holds the tag, no need to decode it
+	m->consume = len;
 
-		// add one frame to initial skip for this (empty) frame
-		m->skip    = enc_delay + 1152;
-		m->samples = frame_count * 1152 - enc_delay - enc_padding;
-		m->padding = enc_padding;
-		
-		LOG_INFO("gapless: skip: %u samples: " FMT_u64 " delay: %u padding: %u", m->skip, m->samples, enc_delay, enc_padding);
+	flags = ptr[7];
+	ptr += 8;
+
+	if (flags & 0x01) {
+		frame_count = unpackN((u32_t *)ptr);
+		ptr += 4;
+	}
+	if (flags & 0x02) ptr += 4;
+	if (flags & 0x04) ptr += 100;
+	if (flags & 0x08) ptr += 4;
+
+	if (ptr + 24 > frame + len || memcmp(ptr, "LAME", 4)) {
+		return;
 	}
+
+	ptr += 21;
+
+	enc_delay   = (*ptr << 4 | *(ptr + 1) >> 4) + MAD_DELAY;
+	enc_padding = (*(ptr + 1) & 0xF) << 8 | *(ptr + 2);
+	enc_padding = enc_padding > MAD_DELAY ? enc_padding - MAD_DELAY : 0;
+
+	m->skip    = enc_delay;
+	m->trim    = (u64_t) frame_count * samples > enc_delay + enc_padding;
+	m->samples = m->trim ? (u64_t) frame_count * samples - enc_delay - enc_padding : 0;
+	m->padding = enc_padding;
+
+	LOG_INFO("gapless: skip: %u samples: " FMT_u64 " delay: %u padding: %u", m->skip, m->samples, enc_delay, enc_padding);
 }
 
 static decode_state mad_decode(void) {
-	size_t bytes;
+	size_t bytes, used, len;
+	u8_t *input;
+	decode_state ret;
 	bool eos = false;
 
 	LOCK_S;
 	bytes = min(_buf_used(streambuf), _buf_cont_read(streambuf));
 	
 	if (m->checktags) {
+		u8_t *tags = streambuf->readp;
+		size_t avail = bytes;
+
+		// tags are parsed in place unless they straddle the wrap, then from a linear copy
+		if (m->checktags < 3 && bytes < READBUF_SIZE && _buf_used(streambuf) > bytes) {
+			avail = min(_buf_used(streambuf), READBUF_SIZE);
+			memcpy(m->readbuf, streambuf->readp, bytes);
+			memcpy(m->readbuf + bytes, streambuf->buf, avail - bytes);
+			tags = m->readbuf;
+		}
+
 		if (m->checktags == 1) {
-			m->consume = _check_id3_tag(bytes);
+			m->consume = _check_id3_tag(tags, avail);
 			m->checktags = 2;
 		}
+		if (m->checktags == 2 && !m->consume) {
+			if (!stream.meta_interval) {
+				_check_lame_header(tags, avail);
+			}
+			m->checktags = 3;
+		}
 		if (m->consume) {
 			u32_t consume = min(m->consume, bytes);
 			LOG_DEBUG("consume: %u of %u", consume, m->consume);
@@ -184,34 +239,38 @@ static decode_state mad_decode(void) {
 			UNLOCK_S;
 			return DECODE_RUNNING;
 		}
-		if (m->checktags == 2) {
-			if (!stream.meta_interval) {
-				_check_lame_header(bytes);
-			}
-			m->checktags = 0;
-		}
-	}
-
-	if (m->stream.next_frame && m->readbuf_len) {
-		m->readbuf_len -= m->stream.next_frame - m->readbuf;
-		memmove(m->readbuf, m->stream.next_frame, m->readbuf_len);
+		m->checktags = 0;
 	}
 
-	bytes = min(bytes, READBUF_SIZE - m->readbuf_len);
-	memcpy(m->readbuf + m->readbuf_len, streambuf->readp, bytes);
-	m->readbuf_len += bytes;
-	_buf_inc_readp(streambuf, bytes);
-
-	if (stream.state <= DISCONNECT && _buf_used(streambuf) == 0) {
-		eos = true;
-		LOG_DEBUG("end of stream");
-		memset(m->readbuf + m->readbuf_len, 0, MAD_BUFFER_GUARD);
-		m->readbuf_len += MAD_BUFFER_GUARD;
+	/*
+	 Frames are decoded straight from streambuf, which is safe without holding the lock as 
+	 the stream thread only writes to free space and streambuf is only flushed once decoder 
+	 is stopped. Data is copied to readbuf only when frames straddle the wrap or at the end
+	 of the stream where mad needs guard bytes. Nothing is kept between calls as readp only
+	 moves by what mad has consumed.
+	*/
+	used = _buf_used(streambuf);
+
+	if (bytes >= READBUF_SIZE) {
+		input = streambuf->readp;
+		len = READBUF_SIZE;
+	} else {
+		input = m->readbuf;
+		len = min(used, READBUF_SIZE);
+		memcpy(m->readbuf, streambuf->readp, bytes);
+		if (len > bytes) memcpy(m->readbuf + bytes, streambuf->buf, len - bytes);
+
+		if (stream.state <= DISCONNECT && used == len) {
+			eos = true;
+			LOG_DEBUG("end of stream");
+			memset(m->readbuf + len, 0, MAD_BUFFER_GUARD);
+			len += MAD_BUFFER_GUARD;
+		}
 	}
 
 	UNLOCK_S;
 
-	MAD(m, stream_buffer, &m->stream, m->readbuf, m->readbuf_len);
+	MAD(m, stream_buffer, &m->stream, input, len);
 
 	while (true) {
 		size_t frames;
@@ -220,7 +279,6 @@ static decode_state mad_decode(void) {
 		unsigned max_frames;
 
 		if (MAD(m, frame_decode, &m->frame, &m->stream) == -1) {
-			decode_state ret;
 			if (!eos && m->stream.error == MAD_ERROR_BUFLEN) {
 				ret = DECODE_RUNNING;
 			} else if (eos && (m->stream.error == MAD_ERROR_BUFLEN || m->stream.error == MAD_ERROR_LOSTSYNC
@@ -237,7 +295,7 @@ static decode_state mad_decode(void) {
 				ret = DECODE_RUNNING;
 			}
 			m->last_error = m->stream.error;
-			return ret;
+			break;
 		};
 
 		MAD(m, synth_frame, &m->synth, &m->frame);
@@ -280,7 +338,8 @@ static decode_state mad_decode(void) {
 			iptrr += skip;
 		}
 
-		if (m->samples) {
+		// padding can span more than one frame (e.g. 576 samples in mpeg2)
+		if (m->trim) {
 			if (m->samples < frames) {
 				LOG_DEBUG("gapless: trimming %u frames from end", frames - m->samples);
 				frames = (size_t)m->samples;
@@ -334,7 +393,12 @@ static decode_state mad_decode(void) {
 		UNLOCK_O_direct;
 	}
 
-	return eos ? DECODE_COMPLETE : DECODE_RUNNING;
+	// guard bytes may have been consumed at the end of the stream
+	LOCK_S;
+	_buf_inc_readp(streambuf, min((size_t) (m->stream.next_frame - input), used));
+	UNLOCK_S;
+
+	return ret;
 }
 
 static void mad_open(u8_t size, u8_t rate, u8_t chan, u8_t endianness) {
@@ -345,7 +409,7 @@ static void mad_open(u8_t size, u8_t rate, u8_t chan, u8_t endianness) {
 	m->consume = 0;
 	m->skip = MAD_DELAY;
 	m->samples = 0;
-	m->readbuf_len = 0;
+	m->trim = false;
 	m->last_error = MAD_ERROR_NONE;
 	MAD(m, stream_init, &m->stream);
 	MAD(m, frame_init, &m->frame);
@@ -408,7 +472,6 @@ struct codec *register_mad(void) {
 	}
 
 	m->readbuf = NULL;
-	m->readbuf_len = 0;
 
 	if (!load_mad()) {
 		return NULL;
@@ -118,8 +118,9 @@ static void usage(const char *argv0) {
 		   "  \t\t\t phase_response = 0-100 (0 = minimum / 50 = linear / 100 = maximum)\n"
 #endif
 #if RESAMPLE16
-		   "  -R -u [params]\tResample, params = (b|l|m)[:i],\n" 
-		   "   \t\t\t b = basic linear interpolation, l = 13 taps, m = 21 taps, i = interpolate filter coefficients\n"
+		   "  -R -u [params]\tResample, params = (b|l|m|p|a)[:i[:budget]],\n" 
+		   "   \t\t\t b = basic linear interpolation, l = 13 taps, m = 21 taps, p = 32 taps polyphase (44.1 <-> 48kHz and small ratios), a = best profile within budget, i = interpolate filter coefficients (b, l, m)\n"
+		   "   \t\t\t budget = cpu share in percent for auto mode (default 25)\n"
 #endif
 #if DSD
 #if ALSA
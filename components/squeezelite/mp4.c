@@ -0,0 +1,543 @@
+/*
+ *  Squeezelite - lightweight headless squeezebox emulator
+ *
+ *  (c) Adrian Smith 2012-2015, triode1@btinternet.com
+ *  (c) Philippe, philippe_44@outlook.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ Streaming mp4 demuxer shared by alac and aac. Boxes are parsed straight from
+ streambuf, sample tables are read entry by entry so they don't need to fit in
+ streambuf. Samples are then located using stsz, stsc and stco, whatever sits
+ in between chunks is skipped. When moov comes after mdat, the stream is
+ re-opened after mdat and then at first sample, using http range requests.
+ All functions must be called with streambuf locked.
+*/
+
+#include "squeezelite.h"
+#include "mp4.h"
+
+#define FOURCC(a,b,c,d) ((u32_t) (a) << 24 | (u32_t) (b) << 16 | (u32_t) (c) << 8 | (u32_t) (d))
+
+enum { 	MOOV = FOURCC('m','o','o','v'), TRAK = FOURCC('t','r','a','k'), MDIA = FOURCC('m','d','i','a'),
+		MINF = FOURCC('m','i','n','f'), STBL = FOURCC('s','t','b','l'), UDTA = FOURCC('u','d','t','a'),
+		ILST = FOURCC('i','l','s','t'), META = FOURCC('m','e','t','a'), STSD = FOURCC('s','t','s','d'),
+		MP4A = FOURCC('m','p','4','a'), STTS = FOURCC('s','t','t','s'), STSC = FOURCC('s','t','s','c'),
+		STSZ = FOURCC('s','t','s','z'), STCO = FOURCC('s','t','c','o'), CO64 = FOURCC('c','o','6','4'),
+		MDAT = FOURCC('m','d','a','t'), ITUN = FOURCC('-','-','-','-') };
+
+// iTunes key-value atoms are small, don't wait for anything bigger
+#define MAX_ITUN_LEN	1024
+// more than 100 hours of aac
+#define MAX_ENTRIES		(1 << 24)
+
+extern log_level loglevel;
+
+extern struct buffer *streambuf;
+extern struct streamstate stream;
+
+static inline void advance(struct mp4 *m, size_t by) {
+	_buf_inc_readp(streambuf, by);
+	m->pos += by;
+}
+
+static inline u32_t sample_size(struct mp4 *m, u32_t sample) {
+	if (!m->sizes) return m->fixed;
+	return m->wide ? ((u32_t*) m->sizes)[sample] : ((u16_t*) m->sizes)[sample];
+}
+
+static bool set_size(struct mp4 *m, u32_t index, u32_t size) {
+	if (!m->wide && size > 0xffff) {
+		// widen in place from the end, so 32 bits entries never overwrite 16 bits ones still to be read
+		u32_t *sizes = realloc(m->sizes, m->count * sizeof(u32_t));
+		if (!sizes) return false;
+		for (u32_t i = index; i-- > 0;) sizes[i] = ((u16_t*) sizes)[i];
+		m->sizes = sizes;
+		m->wide = true;
+		LOG_DEBUG("using 32 bits sample sizes from %u", index);
+	}
+
+	if (m->wide) ((u32_t*) m->sizes)[index] = size;
+	else ((u16_t*) m->sizes)[index] = size;
+
+	if (size > m->max_size) m->max_size = size;
+	return true;
+}
+
+// find chunk of a sample and its offset
+static bool locate(struct mp4 *m, u32_t sample) {
+	struct mp4_run *run;
+	u32_t chunk, first;
+
+	if (!m->runs || sample >= m->count) return false;
+
+	for (m->r = 0; m->r + 1 < m->runs && m->run[m->r + 1].sample <= sample; m->r++);
+
+	run = m->run + m->r;
+	chunk = run->chunk + (sample - run->sample) / run->count;
+	first = run->sample + (chunk - run->chunk) * run->count;
+
+	if (chunk >= m->chunks) return false;
+
+	m->sample = sample;
+	m->chunk = chunk;
+	m->left = run->count - (sample - first);
+	for (m->next = m->offsets[chunk]; first < sample; first++) m->next += sample_size(m, first);
+
+	return true;
+}
+
+// box header has been read, parse counts and allocate table, returns bytes consumed after box header
+static int table_open(struct mp4 *m, u32_t type, u8_t *ptr, u64_t len) {
+	u32_t count, header = 8;
+
+	m->table.size = type == STSC ? 12 : (type == STTS || type == CO64) ? 8 : 4;
+	if (type == STSZ) header = 12;
+
+	// counts are read from what follows the box header, they must be inside the box
+	if (len < header) {
+		LOG_ERROR("table box of " FMT_u64 " bytes is too small", len);
+		return -1;
+	}
+
+	if (type == STSZ) {
+		m->fixed = unpackN((u32_t*) (ptr + 4));
+		m->count = unpackN((u32_t*) (ptr + 8));
+		count = m->fixed ? 0 : m->count;
+	} else {
+		count = unpackN((u32_t*) (ptr + 4));
+	}
+
+	if ((u64_t) count * m->table.size > len - header || count > MAX_ENTRIES) {
+		LOG_ERROR("table of %u entries does not fit in box of " FMT_u64 " bytes", count, len);
+		return -1;
+	}
+
+	switch (type) {
+	case STSZ:
+		free(m->sizes);
+		m->sizes = NULL;
+		m->wide = false;
+		m->max_size = m->fixed;
+		if (count && (m->sizes = malloc(count * sizeof(u16_t))) == NULL) count = UINT32_MAX;
+		LOG_DEBUG("stsz %u samples, size %u", m->count, m->fixed);
+		break;
+	case STSC:
+		free(m->run);
+		if ((m->run = malloc(count * sizeof(struct mp4_run) + 1)) == NULL) count = UINT32_MAX;
+		else m->runs = count;
+		break;
+	case STCO:
+	case CO64:
+		free(m->offsets);
+		if ((m->offsets = malloc(count * sizeof(u32_t) + 1)) == NULL) count = UINT32_MAX;
+		else m->chunks = count;
+		break;
+	}
+
+	if (count == UINT32_MAX) {
+		LOG_ERROR("can't allocate sample table");
+		return -1;
+	}
+
+	m->table.type = type;
+	m->table.left = count;
+	m->table.index = 0;
+	m->table.rest = len - header - (u64_t) count * m->table.size;
+
+	return header;
+}
+
+static bool table_read(struct mp4 *m, u8_t *ptr, u32_t n) {
+	for (; n--; ptr += m->table.size, m->table.index++, m->table.left--) {
+		u32_t i = m->table.index;
+		switch (m->table.type) {
+		case STTS:
+			m->sttssamples += (u64_t) unpackN((u32_t*) ptr) * unpackN((u32_t*) (ptr + 4));
+			break;
+		case STSC:
+			m->run[i].chunk = unpackN((u32_t*) ptr) - 1;
+			m->run[i].count = unpackN((u32_t*) (ptr + 4));
+			break;
+		case STSZ:
+			if (!set_size(m, i, unpackN((u32_t*) ptr))) return false;
+			break;
+		case STCO:
+			m->offsets[i] = unpackN((u32_t*) ptr);
+			break;
+		case CO64:
+			if (unpackN((u32_t*) ptr)) {
+				LOG_ERROR("chunk offset above 4GB");
+				return false;
+			}
+			m->offsets[i] = unpackN((u32_t*) (ptr + 4));
+			break;
+		}
+	}
+
+	if (m->table.left) return true;
+
+	if (m->table.type == STTS) {
+		LOG_DEBUG("total number of samples contained in stts: " FMT_u64, m->sttssamples);
+	} else if (m->table.type == STSC) {
+		// first sample of each run
+		u32_t sample = 0;
+		for (u32_t i = 0; i < m->runs; i++) {
+			if (!m->run[i].count || (i && m->run[i].chunk <= m->run[i - 1].chunk)) {
+				LOG_ERROR("invalid stsc entry %u", i);
+				return false;
+			}
+			if (i) sample += (m->run[i].chunk - m->run[i - 1].chunk) * m->run[i - 1].count;
+			m->run[i].sample = sample;
+		}
+	}
+
+	return true;
+}
+
+// parse key-value atoms within ilst ---- entries to get encoder padding within iTunSMPB entry for gapless
+static void itun_read(struct mp4 *m, u8_t *ptr, u32_t len) {
+	u32_t remain = len - 8, size;
+
+	if (len < 8 + 20) return;
+	ptr += 8;
+
+	if (!memcmp(ptr + 4, "mean", 4) && (size = unpackN((u32_t *)ptr)) < remain) {
+		ptr += size; remain -= size;
+	}
+	if (!memcmp(ptr + 4, "name", 4) && (size = unpackN((u32_t *)ptr)) < remain && !memcmp(ptr + 12, "iTunSMPB", 8)) {
+		ptr += size; remain -= size;
+	}
+	if (!memcmp(ptr + 4, "data", 4) && remain > 16 + 48) {
+		// data is stored as hex strings: 0 start end samples
+		u32_t b, c; u64_t d;
+		if (sscanf((const char *)(ptr + 16), "%x %x %x " FMT_x64, &b, &b, &c, &d) == 4) {
+			LOG_DEBUG("iTunSMPB start: %u end: %u samples: " FMT_u64, b, c, d);
+			if (m->sttssamples && m->sttssamples < b + c + d) {
+				LOG_DEBUG("reducing samples as stts count is less");
+				d = m->sttssamples - (b + c);
+			}
+			m->skip = b;
+			m->samples = d;
+		}
+	}
+}
+
+void mp4_init(struct mp4 *m, const char *codec, mp4_config_t config, void *ctx) {
+	mp4_close(m);
+	m->codec = FOURCC(codec[0], codec[1], codec[2], codec[3]);
+	m->config = config;
+	m->ctx = ctx;
+}
+
+void mp4_close(struct mp4 *m) {
+	free(m->sizes);
+	free(m->offsets);
+	free(m->run);
+	memset(m, 0, sizeof(struct mp4));
+}
+
+// read mp4 header up to first sample: 1 when found, 0 when more data is needed and -1 on error
+int mp4_header(struct mp4 *m) {
+	size_t bytes = min(_buf_used(streambuf), _buf_cont_read(streambuf));
+
+	while (1) {
+		u8_t *ptr = streambuf->readp;
+		u64_t len, consume, need = 0;
+		u32_t type, header = 8;
+
+		// moov was after mdat, come back to first sample
+		if (m->mdat && m->moov_end && m->pos >= m->moov_end) {
+			if (!m->play || !m->count || !m->chunks || !mp4_seek(m, 0)) {
+				LOG_ERROR("no playable track or can't re-open stream at media data");
+				return -1;
+			}
+			return 1;
+		}
+
+		// rest of a box we don't want
+		if (m->consume) {
+			consume = min(m->consume, bytes);
+			advance(m, consume);
+			bytes -= consume;
+			m->consume -= consume;
+			if (m->consume) break;
+			bytes = min(_buf_used(streambuf), _buf_cont_read(streambuf));
+			continue;
+		}
+
+		// sample tables are read by batch of entries
+		if (m->table.left) {
+			u32_t n = min(m->table.left, bytes / m->table.size);
+			if (!n) {
+				// entry is split at the end of streambuf
+				if (_buf_used(streambuf) < m->table.size) break;
+				_buf_unwrap(streambuf, m->table.size);
+				bytes = min(_buf_used(streambuf), _buf_cont_read(streambuf));
+				continue;
+			}
+			if (!table_read(m, ptr, n)) return -1;
+			advance(m, n * m->table.size);
+			bytes -= n * m->table.size;
+			if (!m->table.left) m->consume = m->table.rest;
+			continue;
+		}
+
+		if (bytes < 8) {
+			if (_buf_used(streambuf) >= 8) {
+				_buf_unwrap(streambuf, 16);
+				bytes = min(_buf_used(streambuf), _buf_cont_read(streambuf));
+				if (bytes >= 8) continue;
+			}
+			break;
+		}
+
+		len = unpackN((u32_t *) ptr);
+		type = unpackN((u32_t *) (ptr + 4));
+
+		// 64 bits size or box up to the end of file
+		if (len == 1) {
+			if (bytes < 16) {
+				_buf_unwrap(streambuf, 16);
+				break;
+			}
+			len = (u64_t) unpackN((u32_t *) (ptr + 8)) << 32 | unpackN((u32_t *) (ptr + 12));
+			header = 16;
+		} else if (len == 0 && type != MDAT) {
+			LOG_ERROR("box %.4s extends to end of stream", ptr + 4);
+			return -1;
+		}
+
+		if (len && len < header) {
+			LOG_ERROR("invalid box %.4s of " FMT_u64 " bytes", ptr + 4, len);
+			return -1;
+		}
+
+		// boxes that we parse must be contiguous, only the header of sample tables
+		if (type == m->codec && m->trak && !m->play) need = len;
+		else if (type == ITUN && len <= MAX_ITUN_LEN) need = len;
+		else if ((type == STTS || type == STSC || type == STSZ || type == STCO || type == CO64) && m->play == m->trak && m->play) {
+			need = header + (type == STSZ ? 12 : 8);
+		}
+
+		if (need > bytes) {
+			if (need > streambuf->size) {
+				LOG_ERROR("box %.4s too large for buffer " FMT_u64 " %u", ptr + 4, need, streambuf->size);
+				return -1;
+			}
+			// make sure there is 'need' contiguous space
+			_buf_unwrap(streambuf, need);
+			break;
+		}
+
+		// default to consuming entire box
+		consume = len;
+
+		switch (type) {
+		case MOOV:
+			m->trak = m->play = 0;
+			m->moov_end = m->pos + len;
+			consume = header;
+			break;
+		case TRAK:
+			m->trak++;
+			consume = header;
+			break;
+		// read into these boxes
+		case MDIA:
+		case MINF:
+		case STBL:
+		case UDTA:
+		case ILST:
+			consume = header;
+			break;
+		// special cases which mix data in the enclosing box which we want to read into
+		case STSD:
+			consume = header + 8;
+			break;
+		case MP4A:
+			consume = header + 28;
+			break;
+		case META:
+			consume = header + 4;
+			break;
+		case ITUN:
+			if (need) itun_read(m, ptr, len);
+			break;
+		case STTS:
+		case STSC:
+		case STSZ:
+		case STCO:
+		case CO64:
+			if (need) {
+				int n = table_open(m, type, ptr + header, len - header);
+				if (n < 0) return -1;
+				consume = header + n + (m->table.left ? 0 : m->table.rest);
+			}
+			break;
+		case MDAT:
+			if (m->play && m->count && m->chunks) {
+				// moov is before mdat, start from first sample
+				advance(m, header);
+				LOG_DEBUG("type: mdat len: " FMT_u64 " pos: " FMT_u64, len, m->pos);
+				return mp4_seek(m, 0) ? 1 : -1;
+			} else if (m->moov_end) {
+				LOG_ERROR("type: mdat len: " FMT_u64 ", no playable track found", len);
+				return -1;
+			} else if (!len) {
+				LOG_ERROR("type: mdat up to end of stream, no moov found");
+				return -1;
+			}
+			// moov is after mdat, jump over media data unless it's already here
+			LOG_INFO("mdat before moov at " FMT_u64 ", skipping " FMT_u64 " bytes", m->pos, len);
+			m->mdat = m->pos;
+			if (len > _buf_used(streambuf)) {
+				if (!_stream_range(m->pos + len)) {
+					LOG_ERROR("stream can't be re-opened after mdat");
+					return -1;
+				}
+				m->pos += len;
+				return 0;
+			}
+			break;
+		default:
+			if (type == m->codec && need) {
+				if (!m->config(m->ctx, ptr, len)) return -1;
+				LOG_DEBUG("playable track: %u", m->trak);
+				m->play = m->trak;
+			}
+			break;
+		}
+
+		LOG_DEBUG("type: %.4s len: " FMT_u64 " consume: " FMT_u64, ptr + 4, len, consume);
+
+		// what can't be consumed now will be at next round
+		m->consume = consume;
+		consume = min(consume, (u64_t) bytes);
+		advance(m, consume);
+		m->consume -= consume;
+		bytes -= consume;
+	}
+
+	// stream ended before we found what to play
+	if (stream.state <= DISCONNECT && _buf_used(streambuf) < 8) {
+		LOG_WARN("end of stream while reading header");
+		return -1;
+	}
+
+	return 0;
+}
+
+// skip what has been requested, returns true while there is something to skip
+bool mp4_skip(struct mp4 *m) {
+	size_t used = _buf_used(streambuf);
+	u64_t consume = min(m->consume, (u64_t) used);
+
+	if (!m->consume) return false;
+
+	if (!used && stream.state <= DISCONNECT) {
+		m->consume = 0;
+		return false;
+	}
+
+	LOG_DEBUG("consume: " FMT_u64 " of " FMT_u64, consume, m->consume);
+	advance(m, consume);
+	m->consume -= consume;
+
+	return true;
+}
+
+// position to a sample, stream is re-opened if it is behind or too far ahead
+bool mp4_seek(struct mp4 *m, u32_t sample) {
+	if (!locate(m, sample)) {
+		LOG_ERROR("can't locate sample %u", sample);
+		return false;
+	}
+
+	// gapless start only applies to first sample
+	if (sample) m->skip = 0;
+
+	m->consume = 0;
+	if (m->next >= m->pos && m->next - m->pos <= _buf_used(streambuf) + streambuf->size) return true;
+
+	LOG_INFO("seeking to sample %u at " FMT_u64 " from " FMT_u64, sample, m->next, m->pos);
+	if (!_stream_range(m->next)) return false;
+	m->pos = m->next;
+
+	return true;
+}
+
+// skip up to next sample and return its size once it is fully in streambuf
+int mp4_next(struct mp4 *m) {
+	u32_t size = 0;
+
+	// empty samples have nothing to decode
+	while (m->sample < m->count && m->chunk < m->chunks && !(size = sample_size(m, m->sample))) mp4_advance(m, 0);
+
+	if (m->sample >= m->count || m->chunk >= m->chunks) return MP4_END;
+
+	if (m->next < m->pos) {
+		LOG_ERROR("sample %u at " FMT_u64 " is behind position " FMT_u64, m->sample, m->next, m->pos);
+		return MP4_ERROR;
+	}
+
+	// whatever sits in between chunks is skipped at once
+	if (m->next > m->pos) {
+		m->consume = m->next - m->pos;
+		mp4_skip(m);
+		m->consume = 0;
+		if (m->next > m->pos) return (stream.state <= DISCONNECT && !_buf_used(streambuf)) ? MP4_END : MP4_WAIT;
+	}
+
+	if (size > streambuf->size) {
+		LOG_ERROR("sample %u of %u bytes does not fit in buffer", m->sample, size);
+		return MP4_ERROR;
+	}
+
+	if (_buf_used(streambuf) < size) return stream.state <= DISCONNECT ? MP4_END : MP4_WAIT;
+
+	return size;
+}
+
+// contiguous sample data, copied in scratch when it wraps in streambuf
+u8_t *mp4_data(u32_t size, u8_t *scratch) {
+	size_t cont = _buf_cont_read(streambuf);
+
+	if (cont >= size) return streambuf->readp;
+
+	memcpy(scratch, streambuf->readp, cont);
+	memcpy(scratch + cont, streambuf->buf, size - cont);
+
+	return scratch;
+}
+
+// sample has been decoded
+void mp4_advance(struct mp4 *m, u32_t size) {
+	advance(m, size);
+	m->sample++;
+
+	if (--m->left) {
+		m->next += size;
+		return;
+	}
+
+	// first sample of next chunk
+	if (++m->chunk >= m->chunks) return;
+	if (m->r + 1 < m->runs && m->run[m->r + 1].chunk <= m->chunk) m->r++;
+	m->left = m->run[m->r].count;
+	m->next = m->offsets[m->chunk];
+}
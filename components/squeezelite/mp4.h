@@ -0,0 +1,71 @@
+/*
+ *  Squeezelite - lightweight headless squeezebox emulator
+ *
+ *  (c) Adrian Smith 2012-2015, triode1@btinternet.com
+ *  (c) Philippe, philippe_44@outlook.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+// mp4_next() return codes, anything > 0 is the size of the sample
+#define MP4_WAIT	0
+#define MP4_END		-1
+#define MP4_ERROR	-2
+
+// called with the complete sample description box of the codec, returns false on error
+typedef bool (*mp4_config_t)(void *ctx, u8_t *box, u32_t len);
+
+// chunks from 'chunk' up to next run have 'count' samples, first one being 'sample'
+struct mp4_run {
+	u32_t chunk, count, sample;
+};
+
+struct mp4 {
+	u32_t codec;
+	mp4_config_t config;
+	void *ctx;
+	// parser state, pos is the stream offset of streambuf->readp
+	u64_t pos, consume;
+	u64_t mdat, moov_end;
+	unsigned trak, play;
+	struct {
+		u32_t type, left, index, size;
+		u64_t rest;
+	} table;
+	// gapless
+	u32_t skip;
+	u64_t samples, sttssamples;
+	// sample table, sizes are 16 bits unless one does not fit
+	u32_t count, fixed, max_size;
+	void *sizes;
+	bool wide;
+	u32_t chunks, *offsets;
+	u32_t runs;
+	struct mp4_run *run;
+	// position of next sample
+	u32_t sample, chunk, left, r;
+	u64_t next;
+};
+
+void  mp4_init(struct mp4 *m, const char *codec, mp4_config_t config, void *ctx);
+void  mp4_close(struct mp4 *m);
+int   mp4_header(struct mp4 *m);
+bool  mp4_skip(struct mp4 *m);
+bool  mp4_seek(struct mp4 *m, u32_t sample);
+int   mp4_next(struct mp4 *m);
+u8_t *mp4_data(u32_t size, u8_t *scratch);
+void  mp4_advance(struct mp4 *m, u32_t size);
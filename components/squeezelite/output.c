@@ -31,6 +31,9 @@ static struct buffer buf;
 
 struct buffer *outputbuf = &buf;
 
+// signalled (outputbuf locked) whenever frames are consumed or flushed
+static pthread_cond_t space;
+
 u8_t *silencebuf;
 #if DSD
 u8_t *silencebuf_dsd;
@@ -38,6 +41,13 @@ u8_t *silencebuf_dsd;
 
 bool user_rates = false;
 
+#if EMBEDDED
+extern struct buffer *streambuf;
+static TELEMETRY_GAUGE_DEFINE(telemetry_outputbuf, "outputbuf");
+static TELEMETRY_GAUGE_DEFINE(telemetry_streambuf, "streambuf");
+static TELEMETRY_COUNTER_DEFINE(telemetry_underruns, "output.underruns");
+#endif
+
 #define LOCK   mutex_lock(outputbuf->mutex)
 #define UNLOCK mutex_unlock(outputbuf->mutex)
 
@@ -59,6 +69,12 @@ frames_t _output_frames(frames_t avail) {
 	frames = _buf_used(outputbuf) / BYTES_PER_FRAME;
 	silence = false;
 
+#if EMBEDDED
+	// streambuf is not locked but this is just a gauge
+	telemetry_gauge(&telemetry_outputbuf, frames * BYTES_PER_FRAME, outputbuf->size);
+	telemetry_gauge(&telemetry_streambuf, _buf_used(streambuf), streambuf->size);
+#endif
+
 	// start when threshold met
 	if (output.state == OUTPUT_BUFFER && (frames * BYTES_PER_FRAME) > output.threshold * output.next_sample_rate / 10 && frames > output.start_frames) {
 		output.state = OUTPUT_RUNNING;
@@ -110,6 +126,9 @@ frames_t _output_frames(frames_t avail) {
 	
 	// play silence if buffering or no frames
 	if (output.state <= OUTPUT_BUFFER || frames == 0) {
+#if EMBEDDED
+		if (output.state == OUTPUT_RUNNING) telemetry_count(&telemetry_underruns, 1);
+#endif
 		silence = true;
 		frames = min(avail, MAX_SILENCE_FRAMES);
 	}
@@ -282,9 +301,29 @@ frames_t _output_frames(frames_t avail) {
 			
 	LOG_SDEBUG("wrote %u frames", frames);
 
+	pthread_cond_signal(&space);
+
 	return frames;
 }
 
+/*
+ Block until output consumes or flushes frames, at most ms (outputbuf locked). Wake-up
+ may be spurious so caller must check for space again
+*/
+void _output_wait(u32_t ms) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_sec += ms / 1000;
+	ts.tv_nsec += (ms % 1000) * 1000000;
+	if (ts.tv_nsec >= 1000000000) {
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000;
+	}
+
+	pthread_cond_timedwait(&space, &outputbuf->mutex, &ts);
+}
+
 void _checkfade(bool start) {
 	frames_t bytes;
 
@@ -357,6 +396,7 @@ void output_init_common(log_level level, const char *device, unsigned output_buf
 	LOG_DEBUG("outputbuf size: %u", output_buf_size);
 
 	buf_init(outputbuf, output_buf_size);
+	pthread_cond_init(&space, NULL);
 	if (!outputbuf->buf) {
 		LOG_ERROR("unable to malloc output buffer");
 		exit(2);
@@ -436,6 +476,7 @@ void output_init_common(log_level level, const char *device, unsigned output_buf
 
 void output_close_common(void) {
 	buf_destroy(outputbuf);
+	pthread_cond_destroy(&space);
 	free(silencebuf);
 	IF_DSD(
 		free(silencebuf_dsd);
@@ -455,5 +496,6 @@ void output_flush(void) {
 		output.delay_active = false;
 	}
 	output.frames_played = 0;
+	pthread_cond_signal(&space);
 	UNLOCK;
 }
@@ -13,7 +13,6 @@
 #include "driver/gpio.h"
 #include "squeezelite.h"
 #include "equalizer.h"
-#include "perf_trace.h"
 #include "platform_config.h"
 #include "services.h"
 #include "led.h"
@@ -46,23 +45,9 @@ static uint32_t bt_idle_since;
 static int _write_frames(frames_t out_frames, bool silence, s32_t gainL, s32_t gainR, u8_t flags,
 								s32_t cross_gain_in, s32_t cross_gain_out, ISAMPLE_T **cross_ptr);
 								
-#define DECLARE_ALL_MIN_MAX \
-	DECLARE_MIN_MAX(req);\
-	DECLARE_MIN_MAX(rec);\
-	DECLARE_MIN_MAX(bt);\
-	DECLARE_MIN_MAX(under);\
-	DECLARE_MIN_MAX(stream_buf);\
-	DECLARE_MIN_MAX_DURATION(lock_out_time)								
-	
-#define RESET_ALL_MIN_MAX \
-	RESET_MIN_MAX(bt);	\
-	RESET_MIN_MAX(req);  \
-	RESET_MIN_MAX(rec);  \
-	RESET_MIN_MAX(under);  \
-	RESET_MIN_MAX(stream_buf); \
-	RESET_MIN_MAX_DURATION(lock_out_time)
-	
-DECLARE_ALL_MIN_MAX;	
+static TELEMETRY_GAUGE_DEFINE(telemetry_requested, "bt.requested");
+static TELEMETRY_COUNTER_DEFINE(telemetry_missing, "bt.missing");
+static TELEMETRY_HISTOGRAM_DEFINE(telemetry_write, "bt.write_us");
 
 /****************************************************************************************
  * Get inactivity callback
@@ -151,7 +136,8 @@ static int _write_frames(frames_t out_frames, bool silence, s32_t gainL, s32_t g
  * Data callback for BT stack
  */    
 int32_t output_bt_data(uint8_t *data, int32_t len) {
-	int32_t iframes = len / BYTES_PER_FRAME, start_timer = 0;
+	int32_t iframes = len / BYTES_PER_FRAME;
+	uint32_t start_timer;
 
 	if (iframes <= 0 || data == NULL || !running) {
 		return 0;
@@ -162,11 +148,10 @@ int32_t output_bt_data(uint8_t *data, int32_t len) {
 
 	// This is how the BTC layer calculates the number of bytes to
 	// for us to send. (BTC_SBC_DEC_PCM_DATA_LEN * sizeof(OI_INT16) - availPcmBytes
-	SET_MIN_MAX(len,req);
-	TIME_MEASUREMENT_START(start_timer);
+	telemetry_gauge(&telemetry_requested, len, 0);
+	start_timer = telemetry_now();
 	
 	LOCK;	
-	SET_MIN_MAX_SIZED(_buf_used(outputbuf),bt,outputbuf->size);
 	output.device_frames = 0; 
 	output.updated = gettime_ms();
 	output.frames_played_dmp = output.frames_played;
@@ -176,9 +161,8 @@ int32_t output_bt_data(uint8_t *data, int32_t len) {
 	
 	equalizer_process(data, oframes * BYTES_PER_FRAME);
 
-	SET_MIN_MAX(TIME_MEASUREMENT_GET(start_timer),lock_out_time);
-	SET_MIN_MAX((len-oframes*BYTES_PER_FRAME), rec);
-	TIME_MEASUREMENT_START(start_timer);
+	telemetry_elapsed(&telemetry_write, start_timer);
+	if (len > oframes * BYTES_PER_FRAME) telemetry_count(&telemetry_missing, len - oframes * BYTES_PER_FRAME);
 
 	return oframes * BYTES_PER_FRAME;
 }
@@ -191,31 +175,12 @@ void output_bt_tick(void) {
 	
 	if (!running) return;
 	
-	LOCK_S;
-    SET_MIN_MAX_SIZED(_buf_used(streambuf), stream_buf, streambuf->size);
-    UNLOCK_S;
-	
 	if (stats && lastTime <= gettime_ms() )
 	{
+		char *json = telemetry_alloc_json();
 		lastTime = gettime_ms() + STATS_REPORT_DELAY_MS;
-		LOG_INFO("Statistics over %u secs. " , STATS_REPORT_DELAY_MS/1000);
-		LOG_INFO("              +==========+==========+================+=====+================+");
-		LOG_INFO("              |      max |      min |        average | avg |          count |");
-		LOG_INFO("              |  (bytes) |  (bytes) |        (bytes) | pct |                |");
-		LOG_INFO("              +==========+==========+================+=====+================+");
-		LOG_INFO(LINE_MIN_MAX_FORMAT,LINE_MIN_MAX("stream avl",stream_buf));
-		LOG_INFO(LINE_MIN_MAX_FORMAT,LINE_MIN_MAX("output avl",bt));
-		LOG_INFO(LINE_MIN_MAX_FORMAT,LINE_MIN_MAX("requested",req));
-		LOG_INFO(LINE_MIN_MAX_FORMAT,LINE_MIN_MAX("received",rec));
-		LOG_INFO(LINE_MIN_MAX_FORMAT,LINE_MIN_MAX("underrun",under));
-		LOG_INFO( "              +==========+==========+================+=====+================+");
-		LOG_INFO("\n");
-		LOG_INFO("              ==========+==========+===========+===========+  ");
-		LOG_INFO("              max (us)  | min (us) |   avg(us) |  count    |  ");
-		LOG_INFO("              ==========+==========+===========+===========+  ");
-		LOG_INFO(LINE_MIN_MAX_DURATION_FORMAT,LINE_MIN_MAX_DURATION("Out Buf Lock",lock_out_time));
-		LOG_INFO("              ==========+==========+===========+===========+");
-		RESET_ALL_MIN_MAX;
+		LOG_INFO("Statistics over %u secs: %s", STATS_REPORT_DELAY_MS/1000, json ? json : "");
+		free(json);
 	}	
 }	
 
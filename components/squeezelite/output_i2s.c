@@ -36,7 +36,6 @@ sure that using rate_delay would fix that
 #include "driver/i2s.h"
 #include "driver/i2c.h"
 #include "driver/gpio.h"
-#include "perf_trace.h"
 #include <signal.h>
 #include "adac.h"
 #include "time.h"
@@ -48,6 +47,7 @@ sure that using rate_delay would fix that
 #include "accessors.h"
 #include "equalizer.h"
 #include "globdefs.h"
+#include "scheduler.h"
 
 #define LOCK   mutex_lock(outputbuf->mutex)
 #define UNLOCK mutex_unlock(outputbuf->mutex)
@@ -72,20 +72,6 @@ sure that using rate_delay would fix that
 #define DMA_BUF_FRAMES_SPDIF	450
 #define DMA_BUF_COUNT_SPDIF     7
 
-#define DECLARE_ALL_MIN_MAX 	\
-	DECLARE_MIN_MAX(o); 		\
-	DECLARE_MIN_MAX(s); 		\
-	DECLARE_MIN_MAX(rec); 		\
-	DECLARE_MIN_MAX(i2s_time); 	\
-	DECLARE_MIN_MAX(buffering);
-
-#define RESET_ALL_MIN_MAX 		\
-	RESET_MIN_MAX(o); 			\
-	RESET_MIN_MAX(s); 			\
-	RESET_MIN_MAX(rec);	\
-	RESET_MIN_MAX(i2s_time);	\
-	RESET_MIN_MAX(buffering);
-	
 #define STATS_PERIOD_MS 5000
 static void (*pseudo_idle_chain)(uint32_t now);
 
@@ -125,7 +111,10 @@ static struct {
 } amp_control = { CONFIG_AMP_GPIO, CONFIG_AMP_GPIO_LEVEL },
   mute_control = { CONFIG_MUTE_GPIO, CONFIG_MUTE_GPIO_LEVEL };
 
-DECLARE_ALL_MIN_MAX;
+static TELEMETRY_HISTOGRAM_DEFINE(telemetry_buffering, "i2s.buffering_us");
+static TELEMETRY_HISTOGRAM_DEFINE(telemetry_write, "i2s.write_us");
+static TELEMETRY_GAUGE_DEFINE(telemetry_frames, "i2s.frames");
+static TELEMETRY_HISTOGRAM_DEFINE(telemetry_late, "i2s.late_us");
 
 static int _i2s_write_frames(frames_t out_frames, bool silence, s32_t gainL, s32_t gainR, u8_t flags,
 								s32_t cross_gain_in, s32_t cross_gain_out, ISAMPLE_T **cross_ptr);
@@ -143,7 +132,7 @@ static void (*jack_handler_chain)(bool inserted);
 static bool handler(u8_t *data, int len){
 	bool res = true;
 	
-	if (!strncmp((char*) data, "audo", 4)) {
+	if (PKT_OPCODE(data) == OPCODE('a','u','d','o') && len >= sizeof(struct audo_packet)) {
 		struct audo_packet *pkt = (struct audo_packet*) data;
 		// 0 = headphone (internal speakers off)/jack mutes amp/default set, 1 = sub out/set 2,
 		// 2 = always on (internal speakers on)/no mute, 3 = always off
@@ -454,8 +443,10 @@ void output_init_i2s(log_level level, char *device, unsigned output_buf_size, ch
 	{
 		static DRAM_ATTR StaticTask_t xTaskBuffer __attribute__ ((aligned (4)));
 		static EXT_RAM_ATTR StackType_t xStack[OUTPUT_THREAD_STACK_SIZE] __attribute__ ((aligned (4)));
+		sched_profile_t sched;
+		sched_get("output_i2s", &sched);
 		output_i2s_task = xTaskCreateStaticPinnedToCore( (TaskFunction_t) output_thread_i2s, "output_i2s", OUTPUT_THREAD_STACK_SIZE, 
-											  NULL, CONFIG_ESP32_PTHREAD_TASK_PRIO_DEFAULT + 1, xStack, &xTaskBuffer, 0 );
+											  NULL, sched.priority, xStack, &xTaskBuffer, sched.core );
 	}
 }
 
@@ -517,7 +508,7 @@ static int _i2s_write_frames(frames_t out_frames, bool silence, s32_t gainL, s32
 static void output_thread_i2s(void *arg) {
 	size_t bytes;
 	frames_t iframes = FRAME_BLOCK;
-	uint32_t timer_start = 0;
+	uint32_t timer_start = 0, written = 0;
 	int discard = 0;
 	uint32_t fullness = gettime_ms();
 	bool synced;
@@ -525,7 +516,7 @@ static void output_thread_i2s(void *arg) {
         
 	while (running) {
 			
-		TIME_MEASUREMENT_START(timer_start);
+		timer_start = telemetry_now();
 
 		LOCK;
 		
@@ -552,6 +543,7 @@ static void output_thread_i2s(void *arg) {
 		
 		if (output.state == OUTPUT_OFF) {
 			UNLOCK;
+			written = 0;
 			if (isI2SStarted) {
 				isI2SStarted = false;
 				i2s_stop(CONFIG_DAC_I2S_NUM);
@@ -573,10 +565,8 @@ static void output_thread_i2s(void *arg) {
 		// oframes must be a global updated by the write callback
 		output.frames_in_process = oframes;
               						
-		SET_MIN_MAX_SIZED(oframes,rec,iframes);
-		SET_MIN_MAX_SIZED(_buf_used(outputbuf),o,outputbuf->size);
-		SET_MIN_MAX_SIZED(_buf_used(streambuf),s,streambuf->size);
-		SET_MIN_MAX( TIME_MEASUREMENT_GET(timer_start),buffering);
+		telemetry_gauge(&telemetry_frames, oframes, iframes);
+		telemetry_elapsed(&telemetry_buffering, timer_start);
 		
 		/* must skip first whatever is in the pipe (but not when resuming). 
 		This test is incorrect when we pause a track that has just started, 
@@ -587,6 +577,7 @@ static void output_thread_i2s(void *arg) {
 		} else if (discard) {
             discard -= min(oframes, discard);
             iframes = discard ? min(FRAME_BLOCK, discard) : FRAME_BLOCK;
+			written = 0;
 			UNLOCK;
 			continue;
 		}
@@ -594,7 +585,7 @@ static void output_thread_i2s(void *arg) {
 		UNLOCK;
 				
 		// now send all the data
-		TIME_MEASUREMENT_START(timer_start);
+		timer_start = telemetry_now();
 		
 		if (!isI2SStarted ) {
 			isI2SStarted = true;
@@ -651,7 +642,17 @@ static void output_thread_i2s(void *arg) {
 			LOG_WARN("I2S DMA Overflow! available bytes: %d, I2S wrote %d bytes", oframes * BYTES_PER_FRAME, bytes);
 		}
 		
-		SET_MIN_MAX( TIME_MEASUREMENT_GET(timer_start),i2s_time);
+		telemetry_elapsed(&telemetry_write, timer_start);
+
+		/* Latency probe: once DMA is full, writes return at the pace it drains, so time since 
+		 previous write beyond the duration of what we just queued is how late we woke up. When
+		 that reaches DMA depth, it underruns. Use NVS "task_profile" to tune */
+		uint32_t now = telemetry_now();
+		if (written && output.current_sample_rate) {
+			uint32_t duration = (u64_t) bytes / BYTES_PER_FRAME * 1000000 / output.current_sample_rate;
+			if (now - written > duration) telemetry_observe(&telemetry_late, now - written - duration);
+		}
+		written = now;
 		
 	}
 
@@ -674,24 +675,10 @@ static void i2s_stats(uint32_t now) {
     if (output.state <= OUTPUT_STOPPED || now < last + STATS_PERIOD_MS) return;  
     last = now;
 
-	LOG_INFO( "Output State: %d, current sample rate: %d, bytes per frame: %d", output.state, output.current_sample_rate, BYTES_PER_FRAME);
-	LOG_INFO( LINE_MIN_MAX_FORMAT_HEAD1);
-	LOG_INFO( LINE_MIN_MAX_FORMAT_HEAD2);
-	LOG_INFO( LINE_MIN_MAX_FORMAT_HEAD3);
-	LOG_INFO( LINE_MIN_MAX_FORMAT_HEAD4);
-	LOG_INFO(LINE_MIN_MAX_FORMAT_STREAM, LINE_MIN_MAX_STREAM("stream",s));
-	LOG_INFO(LINE_MIN_MAX_FORMAT,LINE_MIN_MAX("output",o));
-	LOG_INFO(LINE_MIN_MAX_FORMAT_FOOTER);
-	LOG_INFO(LINE_MIN_MAX_FORMAT,LINE_MIN_MAX("received",rec));
-	LOG_INFO(LINE_MIN_MAX_FORMAT_FOOTER);
-	LOG_INFO("");
-	LOG_INFO("              ----------+----------+-----------+-----------+  ");
-	LOG_INFO("              max (us)  | min (us) |   avg(us) |  count    |  ");
-	LOG_INFO("              ----------+----------+-----------+-----------+  ");
-	LOG_INFO(LINE_MIN_MAX_DURATION_FORMAT,LINE_MIN_MAX_DURATION("Buffering(us)",buffering));
-	LOG_INFO(LINE_MIN_MAX_DURATION_FORMAT,LINE_MIN_MAX_DURATION("i2s tfr(us)",i2s_time));
-	LOG_INFO("              ----------+----------+-----------+-----------+");
-	RESET_ALL_MIN_MAX;
+	char *json = telemetry_alloc_json();
+	LOG_INFO("Output State: %d, current sample rate: %d, bytes per frame: %d, telemetry: %s", 
+			 output.state, output.current_sample_rate, BYTES_PER_FRAME, json ? json : "");
+	free(json);
 }
 
 /****************************************************************************************
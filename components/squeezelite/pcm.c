@@ -73,9 +73,38 @@ static bool  bigendian;
 static bool  limit;
 static u32_t audio_left;
 static u32_t bytes_per_frame;
+#if !DSD
+static bool  dop;
+
+// split 24 bits stereo frames for DoP conversion
+static void _unpack_dop(s32_t *lptr, s32_t *rptr, u8_t *iptr, frames_t frames) {
+	while (frames--) {
+		if (bigendian) {
+			*lptr++ = *(iptr) << 16 | *(iptr+1) << 8 | *(iptr+2);
+			*rptr++ = *(iptr+3) << 16 | *(iptr+4) << 8 | *(iptr+5);
+		} else {
+			*lptr++ = *(iptr+2) << 16 | *(iptr+1) << 8 | *(iptr);
+			*rptr++ = *(iptr+5) << 16 | *(iptr+4) << 8 | *(iptr+3);
+		}
+		iptr += 6;
+	}
+}
+#endif
 
 typedef enum { UNKNOWN = 0, WAVE, AIFF } header_format;
 
+// header values come from the stream, decode only handles 1 or 2 channels of 1 to 4 bytes
+static void _set_format(u32_t _channels, u32_t rate, u32_t size, bool _bigendian) {
+	if (_channels < 1 || _channels > 2 || size < 1 || size > 4 || !rate) {
+		LOG_WARN("invalid format size: %u rate: %u chan: %u, keeping server's", size, rate, _channels);
+		return;
+	}
+	channels    = _channels;
+	sample_rate = rate;
+	sample_size = size;
+	bigendian   = _bigendian;
+}
+
 static void _check_header(void) {
 	u8_t *ptr = streambuf->readp;
 	unsigned bytes = min(_buf_used(streambuf), _buf_cont_read(streambuf));
@@ -104,9 +133,9 @@ static void _check_header(void) {
 			id[4] = '\0';
 			
 			if (format == WAVE) {
-				len = *(ptr+4) | *(ptr+5) << 8 | *(ptr+6) << 16| *(ptr+7) << 24;
+				len = *(ptr+4) | *(ptr+5) << 8 | *(ptr+6) << 16| (u32_t) *(ptr+7) << 24;
 			} else {
-				len = *(ptr+4) << 24 | *(ptr+5) << 16 | *(ptr+6) << 8 | *(ptr+7);
+				len = (u32_t) *(ptr+4) << 24 | *(ptr+5) << 16 | *(ptr+6) << 8 | *(ptr+7);
 			}
 				
 			LOG_INFO("header: %s len: %d", id, len);
@@ -127,7 +156,12 @@ static void _check_header(void) {
 			}
 
 			if (format == AIFF && !memcmp(ptr, "SSND", 4) && bytes >= 16) {
-				unsigned offset = *(ptr+8) << 24 | *(ptr+9) << 16 | *(ptr+10) << 8 | *(ptr+11);
+				unsigned offset = (u32_t) *(ptr+8) << 24 | *(ptr+9) << 16 | *(ptr+10) << 8 | *(ptr+11);
+				// can't skip beyond what we have
+				if (offset > bytes - 16) {
+					LOG_WARN("run out of data");
+					return;
+				}
 				// following 4 bytes is blocksize - ignored
 				ptr += 8 + 8;
 				_buf_inc_readp(streambuf, ptr + offset - streambuf->readp);
@@ -135,7 +169,7 @@ static void _check_header(void) {
 				// Reading from an upsampled stream, length could be wrong.
 				// Only use length in header for files.
 				if (stream.state == STREAMING_FILE) {
-					audio_left = len - 8 - offset;
+					audio_left = len > 8 + offset ? len - 8 - offset : 0;
 					LOG_INFO("aif audio size: %u", audio_left);
 					limit = true;
 				}
@@ -144,29 +178,28 @@ static void _check_header(void) {
 
 			if (format == WAVE && !memcmp(ptr, "fmt ", 4) && bytes >= 24) {
 				// override the server parsed values with our own
-				channels    = *(ptr+10) | *(ptr+11) << 8;
-				sample_rate = *(ptr+12) | *(ptr+13) << 8 | *(ptr+14) << 16 | *(ptr+15) << 24;
-				sample_size = (*(ptr+22) | *(ptr+23) << 8) / 8;
-				bigendian   = 0;
+				_set_format(*(ptr+10) | *(ptr+11) << 8, 
+							*(ptr+12) | *(ptr+13) << 8 | *(ptr+14) << 16 | (u32_t) *(ptr+15) << 24,
+							(*(ptr+22) | *(ptr+23) << 8) / 8, 0);
 				LOG_INFO("pcm size: %u rate: %u chan: %u bigendian: %u", sample_size, sample_rate, channels, bigendian);
 			}
 
 			if (format == AIFF && !memcmp(ptr, "COMM", 4) && bytes >= 26) {
 				int exponent;
-				// override the server parsed values with our own
-				channels    = *(ptr+8) << 8 | *(ptr+9);
-				sample_size = (*(ptr+14) << 8 | *(ptr+15)) / 8;
-				bigendian   = 1;
+				u32_t rate;
 				// sample rate is encoded as IEEE 80 bit extended format
 				// make some assumptions to simplify processing - only use first 32 bits of mantissa
 				exponent = ((*(ptr+16) & 0x7f) << 8 | *(ptr+17)) - 16383 - 31;
-				sample_rate  = *(ptr+18) << 24 | *(ptr+19) << 16 | *(ptr+20) << 8 | *(ptr+21);
-				while (exponent < 0) { sample_rate >>= 1; ++exponent; }
-				while (exponent > 0) { sample_rate <<= 1; --exponent; }
+				rate = (u32_t) *(ptr+18) << 24 | *(ptr+19) << 16 | *(ptr+20) << 8 | *(ptr+21);
+				if (exponent < -31 || exponent > 0) rate = 0;
+				else rate >>= -exponent;
+				// override the server parsed values with our own
+				_set_format(*(ptr+8) << 8 | *(ptr+9), rate, (*(ptr+14) << 8 | *(ptr+15)) / 8, 1);
 				LOG_INFO("pcm size: %u rate: %u chan: %u bigendian: %u", sample_size, sample_rate, channels, bigendian);
 			}
 
-			if (bytes >= len + 8) {
+			// len + 8 can wrap
+			if (len <= bytes - 8) {
 				ptr   += len + 8;
 				bytes -= (len + 8);
 			} else {
@@ -204,7 +237,9 @@ static decode_state pcm_decode(void) {
 		out = process.max_in_frames;
 	);
 
-	if ((stream.state <= DISCONNECT && bytes < bytes_per_frame) || (limit && audio_left == 0)) {
+	// a frame can straddle the end of streambuf and a data chunk that is not made of whole
+	// frames ends with a partial one that can't be played
+	if ((stream.state <= DISCONNECT && _buf_used(streambuf) < bytes_per_frame) || (limit && audio_left < channels * sample_size)) {
 		UNLOCK_O_direct;
 		UNLOCK_S;
 		return DECODE_COMPLETE;
@@ -233,6 +268,15 @@ static decode_state pcm_decode(void) {
 			if (output.fade_mode) _checkfade(true);
 		}
 #else
+		dop = false;
+		if (sample_size == 3 && channels == 2) {
+			s32_t lptr[32], rptr[32];
+			frames_t n = min(bytes / 6, 32);
+			_unpack_dop(lptr, rptr, streambuf->readp, n);
+			// no DSD output, so DoP is converted to PCM at the same rate
+			dop = dop_check(lptr, rptr, n) && dop_open();
+			if (dop) LOG_INFO("file contains DOP, converting to PCM");
+		}
 		output.next_sample_rate = decode_newstream(sample_rate, output.supported_rates);
 		if (output.fade_mode) _checkfade(true);
 #endif
@@ -272,10 +316,22 @@ static decode_state pcm_decode(void) {
 	
 	count = frames * channels;
 
+#if !DSD
+	if (dop) {
+		s32_t lptr[64], rptr[64];
+		for (frames_t n; count; count -= n * 2) {
+			n = min(count / 2, 64);
+			_unpack_dop(lptr, rptr, iptr, n);
+			dop_to_pcm((ISAMPLE_T *) optr, lptr, rptr, n);
+			iptr += n * 6;
+			optr += n * 2;
+		}
+	} else
+#endif
 	if (channels == 2) {
 		if (sample_size == 1) {
 			while (count--) {
-				*optr++ = *iptr++ << (24-SHIFT);
+				*optr++ = (u32_t) *iptr++ << (24-SHIFT);
 			}
 		} else if (sample_size == 2) {
 			if (bigendian) {
@@ -284,7 +340,7 @@ static decode_state pcm_decode(void) {
 				memcpy(optr, iptr, count * BYTES_PER_FRAME / 2);
 #else				
 				while (count--) {
-					*optr++ = *(iptr) << (24-SHIFT) | *(iptr+1) << (16-SHIFT);
+					*optr++ = (u32_t) *(iptr) << (24-SHIFT) | *(iptr+1) << (16-SHIFT);
 					iptr += 2;
 				}
 #endif				
@@ -294,7 +350,7 @@ static decode_state pcm_decode(void) {
 				memcpy(optr, iptr, count * BYTES_PER_FRAME / 2);
 #else
 				while (count--) {
-					*optr++ = *(iptr) << (16-SHIFT) | *(iptr+1) << (24-SHIFT);
+					*optr++ = *(iptr) << (16-SHIFT) | (u32_t) *(iptr+1) << (24-SHIFT);
 					iptr += 2;
 				}
 #endif	
@@ -305,7 +361,7 @@ static decode_state pcm_decode(void) {
 #if BYTES_PER_FRAME == 4				
 					*optr++ = *(iptr) << 8 | *(iptr+1);
 #else					
-					*optr++ = *(iptr) << 24 | *(iptr+1) << 16 | *(iptr+2) << 8;
+					*optr++ = (u32_t) *(iptr) << 24 | *(iptr+1) << 16 | *(iptr+2) << 8;
 #endif	
 					iptr += 3;
 				}
@@ -314,7 +370,7 @@ static decode_state pcm_decode(void) {
 #if BYTES_PER_FRAME == 4									
 					*optr++ = *(iptr+1) | *(iptr+2) << 8;
 #else
-					*optr++ = *(iptr) << 8 | *(iptr+1) << 16 | *(iptr+2) << 24;
+					*optr++ = *(iptr) << 8 | *(iptr+1) << 16 | (u32_t) *(iptr+2) << 24;
 #endif	
 					iptr += 3;
 				}
@@ -325,7 +381,7 @@ static decode_state pcm_decode(void) {
 #if BYTES_PER_FRAME == 4														
 					*optr++ = *(iptr) << 8 | *(iptr+1);
 #else
-					*optr++ = *(iptr) << 24 | *(iptr+1) << 16 | *(iptr+2) << 8 | *(iptr+3);
+					*optr++ = (u32_t) *(iptr) << 24 | *(iptr+1) << 16 | *(iptr+2) << 8 | *(iptr+3);
 #endif	
 					iptr += 4;
 				}
@@ -334,7 +390,7 @@ static decode_state pcm_decode(void) {
 #if BYTES_PER_FRAME == 4																			
 					*optr++ = *(iptr+2) | *(iptr+3) << 8;
 #else
-					*optr++ = *(iptr) | *(iptr+1) << 8 | *(iptr+2) << 16 | *(iptr+3) << 24;
+					*optr++ = *(iptr) | *(iptr+1) << 8 | *(iptr+2) << 16 | (u32_t) *(iptr+3) << 24;
 #endif	
 					iptr += 4;
 				}
@@ -343,21 +399,21 @@ static decode_state pcm_decode(void) {
 	} else if (channels == 1) {
 		if (sample_size == 1) {
 			while (count--) {
-				*optr = *iptr++ << (24-SHIFT);
+				*optr = (u32_t) *iptr++ << (24-SHIFT);
 				*(optr+1) = *optr;
 				optr += 2;
 			}
 		} else if (sample_size == 2) {
 			if (bigendian) {
 				while (count--) {
-					*optr = *(iptr) << (24-SHIFT) | *(iptr+1) << (16-SHIFT);
+					*optr = (u32_t) *(iptr) << (24-SHIFT) | *(iptr+1) << (16-SHIFT);
 					*(optr+1) = *optr;
 					iptr += 2;
 					optr += 2;
 				}
 			} else {
 				while (count--) {
-					*optr = *(iptr) << (16-SHIFT) | *(iptr+1) << (24-SHIFT);
+					*optr = *(iptr) << (16-SHIFT) | (u32_t) *(iptr+1) << (24-SHIFT);
 					*(optr+1) = *optr;
 					iptr += 2;
 					optr += 2;
@@ -367,9 +423,9 @@ static decode_state pcm_decode(void) {
 			if (bigendian) {
 				while (count--) {
 #if BYTES_PER_FRAME == 4				
-					*optr++ = *(iptr) << 8 | *(iptr+1);
+					*optr = *(iptr) << 8 | *(iptr+1);
 #else					
-					*optr = *(iptr) << 24 | *(iptr+1) << 16 | *(iptr+2) << 8;
+					*optr = (u32_t) *(iptr) << 24 | *(iptr+1) << 16 | *(iptr+2) << 8;
 #endif				
 					*(optr+1) = *optr;
 					iptr += 3;
@@ -378,9 +434,9 @@ static decode_state pcm_decode(void) {
 			} else {
 				while (count--) {
 #if BYTES_PER_FRAME == 4														
-					*optr++ = *(iptr+1) | *(iptr+2) << 8;
+					*optr = *(iptr+1) | *(iptr+2) << 8;
 #else					
-					*optr = *(iptr) << 8 | *(iptr+1) << 16 | *(iptr+2) << 24;
+					*optr = *(iptr) << 8 | *(iptr+1) << 16 | (u32_t) *(iptr+2) << 24;
 #endif				
 					*(optr+1) = *optr;
 					iptr += 3;
@@ -391,9 +447,9 @@ static decode_state pcm_decode(void) {
 			if (bigendian) {
 				while (count--) {
 #if BYTES_PER_FRAME == 4														
-					*optr++ = *(iptr) << 8 | *(iptr+1);
+					*optr = *(iptr) << 8 | *(iptr+1);
 #else					
-					*optr++ = *(iptr) << 24 | *(iptr+1) << 16 | *(iptr+2) << 8 | *(iptr+3);
+					*optr = (u32_t) *(iptr) << 24 | *(iptr+1) << 16 | *(iptr+2) << 8 | *(iptr+3);
 #endif				
 					*(optr+1) = *optr;
 					iptr += 4;
@@ -402,9 +458,9 @@ static decode_state pcm_decode(void) {
 			} else {
 				while (count--) {
 #if BYTES_PER_FRAME == 4																			
-					*optr++ = *(iptr+2) | *(iptr+3) << 8;
+					*optr = *(iptr+2) | *(iptr+3) << 8;
 #else					
-					*optr++ = *(iptr) | *(iptr+1) << 8 | *(iptr+2) << 16 | *(iptr+3) << 24;
+					*optr = *(iptr) | *(iptr+1) << 8 | *(iptr+2) << 16 | (u32_t) *(iptr+3) << 24;
 #endif				
 					*(optr+1) = *optr;
 					iptr += 4;
@@ -439,9 +495,12 @@ static decode_state pcm_decode(void) {
 
 static void pcm_open(u8_t size, u8_t rate, u8_t chan, u8_t endianness) {
 	sample_size = size - '0' + 1;
-	sample_rate = sample_rates[rate - '0'];
+	sample_rate = (u8_t) (rate - '0') < sizeof(sample_rates) / sizeof(sample_rates[0]) ? sample_rates[rate - '0'] : 44100;
 	channels    = chan - '0';
 	bigendian   = (endianness == '0');
+
+	if (sample_size < 1 || sample_size > 4) sample_size = 2;
+	if (channels < 1 || channels > 2) channels = 2;
 	limit       = false;
 
 	LOG_INFO("pcm size: %u rate: %u chan: %u bigendian: %u", sample_size, sample_rate, channels, bigendian);
@@ -52,7 +52,7 @@ extern struct codec *codec;
 static void _write_samples(void) {
 	frames_t frames = process.out_frames;
 	ISAMPLE_T *iptr   = (ISAMPLE_T *) process.outbuf;
-	unsigned cnt  = 10;
+	u32_t start = gettime_ms(), waited = 0;
 
 	LOCK_O;
 
@@ -72,12 +72,12 @@ static void _write_samples(void) {
 			_buf_inc_writep(outputbuf, f * BYTES_PER_FRAME);
 			iptr += f * BYTES_PER_FRAME / sizeof(*iptr);
 
-		} else if (cnt--) {
+		} else if (waited < 100) {
 
-			// there should normally be space in the output buffer, but may need to wait during drain phase
-			UNLOCK_O;
-			usleep(10000);
-			LOCK_O;
+			// there should normally be space in the output buffer, but may need to wait during drain phase,
+			// so block until output has consumed some frames
+			_output_wait(100 - waited);
+			waited = gettime_ms() - start;
 
 		} else {
 
@@ -26,32 +26,366 @@
 #if RESAMPLE16
 
 #include <resample16.h>
+#include <math.h>
+
+#if EMBEDDED
+#include "esp_heap_caps.h"
+#endif
 
 extern log_level loglevel;
 
+#define RESAMPLE16_BUDGET 25	// default cpu share (%) in auto mode
+#define BENCH_FRAMES	11025	// 250ms of 44.1kHz
+#define BENCH_CHUNK		1024
+#define BENCH_SKIP		2400	// output frames to let the filter settle (multiple of 48)
+#define POLY_TAPS		32		// per phase
+#define POLY_PHASES		160		// 44.1 -> 48kHz is 160/147
+#define POLY_CUTOFF		0.95f	// vs. lowest Nyquist
+#define POLY_BETA		7.0f	// Kaiser window, ~70dB stopband
+
+/*
+ Profiles are the library's filters, with or without interpolated coefficients, then
+ a polyphase filter (see below), by increasing quality. The polyphase one can only be
+ used when rates have a small ratio, like 44.1 <-> 48kHz. In auto mode, each stream
+ uses the best one whose cost fits in the cpu budget. Costs are measured while playing,
+ starting from the cheapest profile and trying the next one up on the following stream,
+ or all at once by the "bench" console command. Profile is only changed at the next stream, as swapping the filter in the
+ middle of a track would drop its history.
+*/
+static const struct {
+	const char *name;
+	resample16_filter_e filter;
+	bool interp;
+	bool poly;
+} profiles[] = {
+	{ "basic", RESAMPLE16_BASIC, false, false },
+	{ "low",   RESAMPLE16_LOW,   false, false },
+	{ "low+i", RESAMPLE16_LOW,   true,  false },
+	{ "med",   RESAMPLE16_MED,   false, false },
+	{ "med+i", RESAMPLE16_MED,   true,  false },
+	{ "poly",  RESAMPLE16_MED,   false, true },
+};
+
+#define PROFILES (sizeof(profiles) / sizeof(*profiles))
+
+/*
+ Polyphase resampling by up/down: a Kaiser-windowed sinc is sampled once per phase
+ (output position between two input samples) in Q14, so each output sample is
+ POLY_TAPS multiply-accumulates of 16 bits values without computing or interpolating
+ coefficients like the library does. History is mirrored so that the window starting
+ after the oldest sample is always contiguous
+*/
+struct poly {
+	unsigned up, down;
+	unsigned phase, pos;
+	s16_t *coefs;				// up rows of POLY_TAPS, oldest sample first
+	HWORD history[2][POLY_TAPS * 2];
+};
+
+// resampler of a profile, from the library or polyphase
+struct resampler {
+	struct resample16_s *lib;
+	struct poly *poly;
+};
+
 struct resample16 {
-	struct resample16_s *resampler;
+	struct resampler resampler;
 	bool max_rate;
 	bool exception;
-	bool interp;
+	bool interp, poly;
 	resample16_filter_e filter;
+	bool automatic;
+	unsigned budget;
+	unsigned rate, profile, manual;
+	u32_t elapsed, frames;
+	u32_t cost[PROFILES];		// us per 1000 output frames, 0 when unknown
 };
 
 static struct resample16 r;
 
+#if EMBEDDED
+static TELEMETRY_COUNTER_DEFINE(telemetry_resample_cpu, "resample.cpu_us");
+#define NOW_US() telemetry_now()
+#else
+static u32_t now_us(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+#define NOW_US() now_us()
+#endif
+
+static unsigned cpu(u32_t cost, unsigned rate) {
+	return (u64_t) cost * rate / (10 * 1000 * 1000);
+}
+
+static bool fits(unsigned profile) {
+	return !r.cost[profile] || (u64_t) r.cost[profile] * r.rate <= (u64_t) r.budget * 10 * 1000 * 1000;
+}
+
+static void update_cost(void) {
+	if (r.frames >= r.rate) {
+		u32_t cost = (u64_t) r.elapsed * 1000 / r.frames;
+		r.cost[r.profile] = r.cost[r.profile] ? (r.cost[r.profile] + cost) / 2 : cost;
+		LOG_INFO("profile %s used %u%% of cpu", profiles[r.profile].name, cpu(cost, r.rate));
+	}
+	r.elapsed = r.frames = 0;
+}
+
+static unsigned gcd(unsigned a, unsigned b) {
+	while (b) {
+		unsigned t = a % b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+static bool poly_supported(unsigned in_rate, unsigned out_rate) {
+	return out_rate / gcd(in_rate, out_rate) <= POLY_PHASES;
+}
+
+// modified Bessel function of order 0, series converges quickly for the window's range
+static float bessel_i0(float x) {
+	float sum = 1, term = 1;
+	for (int k = 1; k < 32 && term > sum * 1e-8f; k++) {
+		term *= (x / (2 * k)) * (x / (2 * k));
+		sum += term;
+	}
+	return sum;
+}
+
+static struct poly *poly_create(unsigned in_rate, unsigned out_rate) {
+	unsigned g = gcd(in_rate, out_rate);
+	struct poly *p;
+	float cutoff;
+
+	if (!poly_supported(in_rate, out_rate) || (p = calloc(1, sizeof(struct poly))) == NULL) return NULL;
+
+	p->up = out_rate / g;
+	p->down = in_rate / g;
+#if EMBEDDED
+	p->coefs = heap_caps_malloc(p->up * POLY_TAPS * sizeof(s16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	if (!p->coefs) p->coefs = malloc(p->up * POLY_TAPS * sizeof(s16_t));
+#else
+	p->coefs = malloc(p->up * POLY_TAPS * sizeof(s16_t));
+#endif
+	if (!p->coefs) {
+		free(p);
+		return NULL;
+	}
+
+	// cutoff is relative to input Nyquist, so it is lowered when downsampling
+	cutoff = POLY_CUTOFF * (p->up < p->down ? (float) p->up / p->down : 1);
+
+	/*
+	 Output of a phase is phase/up after the second newest input sample and it lags by
+	 POLY_TAPS/2 - 1 samples, so tap k (oldest first) is at t from the filter's center.
+	 Each phase is normalized for unity DC gain
+	*/
+	for (unsigned phase = 0; phase < p->up; phase++) {
+		float taps[POLY_TAPS], sum = 0;
+		s16_t *coefs = p->coefs + phase * POLY_TAPS;
+
+		for (int k = 0; k < POLY_TAPS; k++) {
+			float t = POLY_TAPS / 2 - 1 - k + (float) phase / p->up;
+			float x = t / (POLY_TAPS / 2);
+			float w = x > -1 && x < 1 ? bessel_i0(POLY_BETA * sqrtf(1 - x * x)) / bessel_i0(POLY_BETA) : 0;
+			taps[k] = w * (t ? sinf(M_PI * cutoff * t) / (M_PI * t) : cutoff);
+			sum += taps[k];
+		}
+
+		for (int k = 0; k < POLY_TAPS; k++) coefs[k] = lroundf(taps[k] / sum * (1 << 14));
+	}
+
+	LOG_INFO("polyphase %u/%u, %u taps", p->up, p->down, POLY_TAPS);
+	return p;
+}
+
+static inline HWORD clip16(s32_t sample) {
+	return sample > 32767 ? 32767 : (sample < -32768 ? -32768 : sample);
+}
+
+static int poly_resample(struct poly *p, HWORD *in, int frames, HWORD *out) {
+	HWORD *optr = out;
+
+	for (int i = 0; i < frames; i++, in += 2) {
+		p->history[0][p->pos] = p->history[0][p->pos + POLY_TAPS] = in[0];
+		p->history[1][p->pos] = p->history[1][p->pos + POLY_TAPS] = in[1];
+		p->pos = (p->pos + 1) % POLY_TAPS;
+
+		for (; p->phase < p->up; p->phase += p->down) {
+			const s16_t *coefs = p->coefs + p->phase * POLY_TAPS;
+			const HWORD *left = p->history[0] + p->pos, *right = p->history[1] + p->pos;
+			s32_t l = 1 << 13, r = 1 << 13;
+
+			for (int k = 0; k < POLY_TAPS; k++) {
+				l += coefs[k] * left[k];
+				r += coefs[k] * right[k];
+			}
+
+			*optr++ = clip16(l >> 14);
+			*optr++ = clip16(r >> 14);
+		}
+
+		p->phase -= p->up;
+	}
+
+	return (optr - out) / 2;
+}
+
+static void poly_delete(struct poly *p) {
+	free(p->coefs);
+	free(p);
+}
+
+static bool resampler_create(struct resampler *resampler, unsigned profile, unsigned in_rate, unsigned out_rate) {
+	if (profiles[profile].poly) {
+		resampler->poly = poly_create(in_rate, out_rate);
+	} else {
+		resampler->lib = resample16_create((float) out_rate / in_rate, profiles[profile].filter, NULL, profiles[profile].interp);
+	}
+	return resampler->lib || resampler->poly;
+}
+
+static int resampler_run(struct resampler *resampler, HWORD *in, int frames, HWORD *out) {
+	if (resampler->poly) return poly_resample(resampler->poly, in, frames, out);
+	return resample16(resampler->lib, in, frames, out);
+}
+
+static void resampler_delete(struct resampler *resampler) {
+	if (resampler->lib) resample16_delete(resampler->lib);
+	if (resampler->poly) poly_delete(resampler->poly);
+	resampler->lib = NULL;
+	resampler->poly = NULL;
+}
+
+/*
+ Cost and THD+N of each profile, from the "bench" console command as it takes a while.
+ Input is a 1kHz tone at 44.1kHz and output at 48kHz has exactly 48 samples per period,
+ so the fit of a sine and cosine on whole periods is a plain projection. Measured costs
+ are used by auto mode until playback refines them. Returns report length
+*/
+size_t resample_bench(char *report, size_t size) {
+	HWORD *in = malloc(BENCH_CHUNK * 2 * sizeof(HWORD));
+	HWORD *out = malloc((BENCH_CHUNK * 48000 / 44100 + 64) * 2 * sizeof(HWORD));
+	size_t len;
+
+	if (!in || !out) {
+		free(in);
+		free(out);
+		return snprintf(report, size, "resampler: no memory\n");
+	}
+
+	len = snprintf(report, size, "profile | us/1000 frames | cpu@48k | THD+N\n");
+
+	for (unsigned p = 0; p < PROFILES && len < size; p++) {
+		struct resampler resampler = { NULL, NULL };
+		// oscillators must not drift in amplitude, so they are in double
+		double is = 0, ic = 1, dis = sin(2 * M_PI * 1000 / 44100), dic = cos(2 * M_PI * 1000 / 44100);
+		double os = 0, oc = 1, dos = sin(2 * M_PI * 1000 / 48000), doc = cos(2 * M_PI * 1000 / 48000);
+		double sum_s = 0, sum_c = 0, energy = 0;
+		u32_t elapsed = 0, done = 0, n = 0;
+		// analyse whole periods only, leaving some margin for the filter's delay
+		u32_t periods = ((BENCH_FRAMES + BENCH_CHUNK - 1) / BENCH_CHUNK * BENCH_CHUNK * 48000ULL / 44100 - BENCH_SKIP) / 48 * 48 - 48;
+
+		if (!resampler_create(&resampler, p, 44100, 48000)) continue;
+
+		for (int frames = 0; frames < BENCH_FRAMES; frames += BENCH_CHUNK) {
+			for (int i = 0; i < BENCH_CHUNK; i++) {
+				double t = is * dic + ic * dis;
+				ic = ic * dic - is * dis;
+				is = t;
+				in[2*i] = in[2*i + 1] = lround(16384 * is);
+			}
+
+			u32_t start = NOW_US();
+			int odone = resampler_run(&resampler, in, BENCH_CHUNK, out);
+			elapsed += NOW_US() - start;
+			if (odone < 0) break;
+
+			// left channel against a reference of unknown phase
+			for (int i = 0; i < odone; i++, done++) {
+				if (done >= BENCH_SKIP && n < periods) {
+					sum_s += out[2*i] * os;
+					sum_c += out[2*i] * oc;
+					energy += (double) out[2*i] * out[2*i];
+					n++;
+				}
+				double t = os * doc + oc * dos;
+				oc = oc * doc - os * dos;
+				os = t;
+			}
+		}
+
+		resampler_delete(&resampler);
+
+		if (n != periods) continue;
+
+		double tone = 2 * (sum_s * sum_s + sum_c * sum_c) / n;
+		double noise = energy - tone;
+		r.cost[p] = (u64_t) elapsed * 1000 / done;
+		len += snprintf(report + len, size - len, "%-7s | %14u | %6u%% | %.1f dB\n", profiles[p].name, r.cost[p],
+						cpu(r.cost[p], 48000), noise > 0 ? 10 * log10(noise / tone) : -120.0);
+	}
+
+	free(in);
+	free(out);
+
+	return min(len, size);
+}
+
+static void create(unsigned in_rate, unsigned out_rate) {
+	unsigned profile = r.manual;
+
+	// best profile known to fit, or the next one up so that its cost gets measured
+	if (r.automatic) {
+		for (unsigned p = profile = 0; p < PROFILES; p++) {
+			if (profiles[p].poly && !poly_supported(in_rate, out_rate)) continue;
+			if (!fits(p)) break;
+			profile = p;
+			if (!r.cost[p]) break;
+		}
+	}
+
+	// polyphase falls back to the library's best filter for other ratios or when out of memory
+	if (profiles[profile].poly && !resampler_create(&r.resampler, profile, in_rate, out_rate)) {
+		LOG_INFO("can't use profile %s from %u to %u", profiles[profile].name, in_rate, out_rate);
+		while (profiles[profile].poly || profiles[profile].interp) profile--;
+	}
+
+	LOG_INFO("using profile %s", profiles[profile].name);
+	r.elapsed = r.frames = 0;
+	r.profile = profile;
+	if (!profiles[profile].poly) resampler_create(&r.resampler, profile, in_rate, out_rate);
+}
+
 void resample_samples(struct processstate *process) {
 	ssize_t odone;
+	u32_t start = NOW_US(), elapsed;
 	
-	odone = resample16(r.resampler, (HWORD*) process->inbuf, process->in_frames, (HWORD*) process->outbuf);
+	odone = resampler_run(&r.resampler, (HWORD*) process->inbuf, process->in_frames, (HWORD*) process->outbuf);
 
 	if (odone < 0) {
 		LOG_INFO("resample16 error");
 		return;
 	}
-	
+
+	elapsed = NOW_US() - start;
+#if EMBEDDED
+	telemetry_count(&telemetry_resample_cpu, elapsed);
+#endif
+
 	process->out_frames = odone;
 	process->total_in  += process->in_frames;
 	process->total_out += odone;
+
+	if (!r.automatic) return;
+
+	// refine cost every second, it will be used for next stream
+	r.elapsed += elapsed;
+	r.frames += odone;
+	if (r.frames >= r.rate) update_cost();
 }
 
 bool resample_drain(struct processstate *process) {
@@ -59,8 +393,7 @@ bool resample_drain(struct processstate *process) {
 	
 	LOG_INFO("resample track complete");
 
-	resample16_delete(r.resampler);
-	r.resampler = NULL;
+	resampler_delete(&r.resampler);
 
 	return true;
 }
@@ -108,15 +441,13 @@ bool resample_newstream(struct processstate *process, unsigned raw_sample_rate,
 	process->in_sample_rate = raw_sample_rate;
 	process->out_sample_rate = outrate;
 
-	if (r.resampler) {
-		resample16_delete(r.resampler);
-		r.resampler = NULL;
-	}
+	resampler_delete(&r.resampler);
 
 	if (raw_sample_rate != outrate) {
 
 		LOG_INFO("resampling from %u -> %u", raw_sample_rate, outrate);
-		r.resampler = resample16_create((float) outrate / raw_sample_rate, r.filter, NULL, false);
+		r.rate = outrate;
+		create(raw_sample_rate, outrate);
 
 		return true;
 
@@ -128,35 +459,52 @@ bool resample_newstream(struct processstate *process, unsigned raw_sample_rate,
 }
 
 void resample_flush(void) {
-	if (r.resampler) {
-		resample16_delete(r.resampler);
-		r.resampler = NULL;
-	}
+	resampler_delete(&r.resampler);
 }
 
 bool resample_init(char *opt) {
-	char *filter = NULL, *interp = NULL;
+	char *filter = NULL, *interp = NULL, *budget = NULL;
 	
-	r.resampler = NULL;
+	r.resampler.lib = NULL;
+	r.resampler.poly = NULL;
 	r.max_rate = false;
 	r.exception = false;
+	r.budget = RESAMPLE16_BUDGET;
 
 	if (opt) {
 		filter = next_param(opt, ':');
 		interp = next_param(NULL, ':');
+		budget = next_param(NULL, ':');
 	}
 
 	if (filter) {
-		if (*filter == 'm') r.filter = RESAMPLE16_MED;
+		if (*filter == 'p') r.poly = true;
+		if (*filter == 'm' || *filter == 'p') r.filter = RESAMPLE16_MED;
 		else if (*filter == 'l') r.filter = RESAMPLE16_LOW;
+		else if (*filter == 'a') r.automatic = true;
 		else r.filter = RESAMPLE16_BASIC;
 	}
 
 	if (interp && *interp == 'i') {
 		r.interp = true;	
 	}
+
+	if (budget && atoi(budget) > 0) {
+		r.budget = min(atoi(budget), 100);
+	}
 	
-	LOG_INFO("Resampling with filter %d %s", r.filter, r.interp ? "(interpolated)" : "");
+	// manual profile is a filter with interpolation when it has it
+	for (unsigned p = 0; p < PROFILES; p++) {
+		if (profiles[p].filter != r.filter || profiles[p].poly != r.poly) continue;
+		r.manual = p;
+		if (profiles[p].interp == r.interp) break;
+	}
+
+	if (r.automatic) {
+		LOG_INFO("Resampling with best profile within %u%% of cpu", r.budget);
+	} else {
+		LOG_INFO("Resampling with profile %s", profiles[r.manual].name);
+	}
 
 	return true;
 }
@@ -482,11 +482,12 @@ static void process_setd(u8_t *pkt, int len) {
 				sendSETDName(player_name);
 			}
 		} else if (len > 5) {
-			strncpy(player_name, setd->data, PLAYER_NAME_LEN);
-			player_name[PLAYER_NAME_LEN] = '\0';
-			LOG_INFO("set name: %s", setd->data);
+			// name is not always terminated within the packet
+			strncpy(player_name, setd->data, min(len - 5, PLAYER_NAME_LEN));
+			player_name[min(len - 5, PLAYER_NAME_LEN)] = '\0';
+			LOG_INFO("set name: %s", player_name);
 			// confirm change to server
-			sendSETDName(setd->data);
+			sendSETDName(player_name);
 #if EMBEDDED
 			set_name(player_name, "autoexec1");
 			set_name(player_name, "autoexec1_2");
@@ -539,33 +540,48 @@ static void process_serv(u8_t *pkt, int len) {
 	}		
 }
 
+/* 
+ Handlers are called with the packet in place, their packed struct is a view on the
+ receive buffer and what follows it (headers, names...) is passed by reference
+*/
 struct handler {
-	char opcode[5];
+	u32_t opcode;
+	char name[5];
 	void (*handler)(u8_t *, int);
+	int size;	// minimum packet length
 };
 
 static struct handler handlers[] = {
-	{ "strm", process_strm },
-	{ "cont", process_cont },
-	{ "codc", process_codc },
-	{ "aude", process_aude },
-	{ "audg", process_audg },
-	{ "setd", process_setd },
-	{ "serv", process_serv },
-	{ "dsco", process_dsco },
-	{ "",     NULL  },
+	{ OPCODE('s','t','r','m'), "strm", process_strm, sizeof(struct strm_packet) },
+	{ OPCODE('c','o','n','t'), "cont", process_cont, sizeof(struct cont_packet) },
+	{ OPCODE('c','o','d','c'), "codc", process_codc, sizeof(struct codc_packet) },
+	{ OPCODE('a','u','d','e'), "aude", process_aude, sizeof(struct aude_packet) },
+	{ OPCODE('a','u','d','g'), "audg", process_audg, sizeof(struct audg_packet) },
+	{ OPCODE('s','e','t','d'), "setd", process_setd, sizeof(struct setd_packet) },
+	{ OPCODE('s','e','r','v'), "serv", process_serv, sizeof(struct serv_packet) },
+	{ OPCODE('d','s','c','o'), "dsco", process_dsco, 4 },
+	{ 0,                       "",     NULL  },
 };
 
 static void process(u8_t *pack, int len) {
 	struct handler *h = handlers;
-	while (h->handler && strncmp((char *)pack, h->opcode, 4)) { h++; }
+	u32_t opcode;
+
+	if (len < 4) {
+		LOG_WARN("packet too short: %d", len);
+		return;
+	}
+
+	opcode = PKT_OPCODE(pack);
+	while (h->handler && h->opcode != opcode) { h++; }
 
-	if (h->handler) {
-		LOG_DEBUG("%s", h->opcode);
+	if (h->handler && len < h->size) {
+		LOG_WARN("%s too short: %d < %d", h->name, len, h->size);
+	} else if (h->handler) {
+		LOG_DEBUG("%s", h->name);
 		h->handler(pack, len);
 	} else if (!slimp_handler || !(*slimp_handler)(pack, len)) {
-		pack[4] = '\0';
-		LOG_WARN("unhandled %s", (char *)pack);
+		LOG_WARN("unhandled %.4s", (char *)pack);
 	}
 }
 
@@ -661,7 +677,7 @@ static void slimproto_run() {
 			bool _stream_disconnect = false;
 			bool _start_output = false;
 			decode_state _decode_state;
-			disconnect_code disconnect_code;
+			disconnect_code disconnect_code = DISCONNECT_OK;
 			static char EXT_BSS header[MAX_HEADER];
 			size_t header_len = 0;
 #if IR
@@ -21,6 +21,10 @@
 
 // packet formats for slimproto
 
+// opcodes are read as big endian integers so that dispatching does not compare strings
+#define OPCODE(a, b, c, d)	((u32_t) (a) << 24 | (u32_t) (b) << 16 | (u32_t) (c) << 8 | (u32_t) (d))
+#define PKT_OPCODE(pkt)		unpackN((u32_t*) (pkt))
+
 #ifndef SUN
 #pragma pack(push, 1)
 #else
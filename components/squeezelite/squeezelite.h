@@ -587,6 +587,7 @@ void stream_close(void);
 void stream_file(const char *header, size_t header_len, unsigned threshold);
 void stream_sock(u32_t ip, u16_t port, const char *header, size_t header_len, unsigned threshold, bool cont_wait);
 bool stream_disconnect(void);
+bool _stream_range(u64_t offset);
 
 // decode.c
 typedef enum { DECODE_STOPPED = 0, DECODE_READY, DECODE_RUNNING, DECODE_COMPLETE, DECODE_ERROR } decode_state;
@@ -643,6 +644,9 @@ bool resample_drain(struct processstate *process);
 bool resample_newstream(struct processstate *process, unsigned raw_sample_rate, unsigned supported_rates[]);
 void resample_flush(void);
 bool resample_init(char *opt);
+#if RESAMPLE16
+size_t resample_bench(char *report, size_t size);
+#endif
 #endif
 
 // output.c output_alsa.c output_pa.c output_pack.c
@@ -729,6 +733,7 @@ void output_close_common(void);
 void output_flush(void);
 // _* called with mutex locked
 frames_t _output_frames(frames_t avail);
+void _output_wait(u32_t ms);
 void _checkfade(bool);
 
 // output_alsa.c
@@ -787,6 +792,11 @@ void update_dop(u32_t *ptr, frames_t frames, bool invert);
 void dsd_silence_frames(u32_t *ptr, frames_t frames);
 void dsd_invert(u32_t *ptr, frames_t frames);
 void dsd_init(dsd_format format, unsigned delay);
+#else
+bool dop_check(const s32_t *lptr, const s32_t *rptr, frames_t frames);
+bool dop_open(void);
+void dop_to_pcm(ISAMPLE_T *optr, const s32_t *lptr, const s32_t *rptr, frames_t count);
+size_t dop_bench(char *report, size_t size);
 #endif
 
 // codecs
@@ -37,6 +37,10 @@
 #if SUN
 #include <signal.h>
 #endif
+
+#if EMBEDDED
+#include "scheduler.h"
+#endif
 static log_level loglevel;
 
 static struct buffer buf;
@@ -61,6 +65,27 @@ static sockfd fd;
 
 struct streamstate stream;
 
+/*
+Original request is kept so that a decoder can re-open the stream at a given offset,
+for example mp4 files with their index (moov) after media data (mdat). The stream 
+thread does the re-connection, decoder just waits for data to come back. 
+When server accepts ranges, a connection lost in the middle of a non-icy body is also
+resumed at the position reached, without flushing what's been received so far
+*/
+#define RESUME_RETRIES	3
+
+static struct {
+	u32_t ip;
+	u16_t port;
+	char *header;
+	size_t header_len;
+	u64_t offset;
+	bool pending, expect;
+	u64_t position, length;	// stream offset of next byte, length (0 if unknown)
+	bool accept;
+	unsigned retries, session, reopen;
+} range;
+
 #if USE_SSL
 static SSL_CTX *SSLctx;
 SSL *ssl;
@@ -160,6 +185,66 @@ static void _disconnect(stream_state state, disconnect_code disconnect) {
 	wake_controller();
 }
 
+static void stream_reopen(void);
+
+/* 
+Find if server accepts ranges and where the body ends, must be called once all response
+headers have been received (stream locked)
+*/
+static void _parse_ranges(void) {
+	char *p;
+
+	range.length = 0;
+
+	if ((p = strcasestr(stream.header, "\nContent-Range:")) != NULL && (p = strchr(p, '/')) != NULL) {
+		range.length = strtoull(p + 1, NULL, 10);
+	} else if ((p = strcasestr(stream.header, "\nContent-Length:")) != NULL) {
+		range.length = range.position + strtoull(p + 16, NULL, 10);
+	}
+
+	// a resumed request does not need to have it again
+	if (!range.expect && (p = strcasestr(stream.header, "\nAccept-Ranges:")) != NULL) {
+		for (p += 15; *p == ' '; p++);
+		range.accept = !strncasecmp(p, "bytes", 5);
+	}
+
+	LOG_DEBUG("ranges accepted: %u, length: " FMT_u64, range.accept, range.length);
+}
+
+// close current connection and let stream thread re-open at offset (stream locked)
+static void _reopen(u64_t offset) {
+#if USE_SSL
+	if (ssl) {
+		SSL_shutdown(ssl);
+		SSL_free(ssl);
+		ssl = NULL;
+	}
+#endif
+	if (fd != -1) {
+		closesocket(fd);
+		fd = -1;
+	}
+
+	range.offset = range.position = offset;
+	range.pending = true;
+	range.expect = false;
+	// not a disconnect so decoder waits
+	stream.state = SEND_HEADERS;
+}
+
+// connection lost in the middle of the body, try to continue where we were (stream locked)
+static bool _stream_resume(void) {
+	if (!range.accept || !range.header_len || stream.meta_interval || range.retries >= RESUME_RETRIES) {
+		return false;
+	}
+
+	range.retries++;
+	LOG_WARN("connection lost at " FMT_u64 ", resuming (%u/%u)", range.position, range.retries, RESUME_RETRIES);
+	_reopen(range.position);
+
+	return true;
+}
+
 static void *stream_thread() {
 
 	while (running) {
@@ -169,6 +254,13 @@ static void *stream_thread() {
 
 		LOCK;
 
+		if (range.pending) {
+			range.pending = false;
+			UNLOCK;
+			stream_reopen();
+			continue;
+		}
+
 		space = min(_buf_space(streambuf), _buf_cont_write(streambuf));
 
 		if (fd < 0 || !space || stream.state <= STREAMING_WAIT) {
@@ -255,6 +347,8 @@ static void *stream_thread() {
 					if (stream.header_len > MAX_HEADER - 1) {
 						LOG_ERROR("received headers too long: %u", stream.header_len);
 						_disconnect(DISCONNECT, LOCAL_DISCONNECT);
+						UNLOCK;
+						continue;
 					}
 
 					if (stream.header_len > 1 && (c == '\r' || c == '\n')) {
@@ -262,7 +356,23 @@ static void *stream_thread() {
 						if (endtok == 4) {
 							*(stream.header + stream.header_len) = '\0';
 							LOG_INFO("headers: len: %d\n%s", stream.header_len, stream.header);
-							stream.state = stream.cont_wait ? STREAMING_WAIT : STREAMING_BUFFERING;
+							_parse_ranges();
+							if (range.expect) {
+								int code = 0;
+								char *p = strcasestr(stream.header, "\nContent-Range:");
+								// LMS already has the headers, anything but partial content at offset is useless
+								range.expect = false;
+								sscanf(stream.header, "HTTP/%*s %d", &code);
+								if (p) p = strcasestr(p, "bytes");
+								if (code == 206 && p && strtoull(p + 5, NULL, 10) == range.offset) {
+									stream.state = STREAMING_HTTP;
+								} else {
+									LOG_WARN("range request not honoured (%d)", code);
+									_disconnect(DISCONNECT, LOCAL_DISCONNECT);
+								}
+							} else {
+								stream.state = stream.cont_wait ? STREAMING_WAIT : STREAMING_BUFFERING;
+							}
 							wake_controller();
 						}
 					} else {
@@ -334,17 +444,28 @@ static void *stream_thread() {
 
 					n = _recv(ssl, fd, streambuf->writep, space, 0);
 					if (n == 0) {
+						// closed before announced length means connection was lost
+						if (range.length && range.position < range.length && _stream_resume()) {
+							UNLOCK;
+							continue;
+						}
 						LOG_INFO("end of stream (%u bytes)", stream.bytes);
 						_disconnect(DISCONNECT, DISCONNECT_OK);
 					}
 					if (n < 0 && _last_error() != ERROR_WOULDBLOCK) {
 						LOG_INFO("error reading: %s", strerror(last_error()));
+						if (_stream_resume()) {
+							UNLOCK;
+							continue;
+						}
 						_disconnect(DISCONNECT, REMOTE_DISCONNECT);
 					}
 					
 					if (n > 0) {
 						_buf_inc_writep(streambuf, n);
 						stream.bytes += n;
+						range.position += n;
+						range.retries = 0;
 						if (stream.meta_interval) {
 							stream.meta_next -= n;
 						}
@@ -416,6 +537,7 @@ void stream_init(log_level level, unsigned stream_buf_size) {
 	stream.state = STOPPED;
 	stream.header = malloc(MAX_HEADER);
 	*stream.header = '\0';
+	range.header = malloc(MAX_HEADER);
 
 	fd = -1;
 
@@ -427,7 +549,13 @@ void stream_init(log_level level, unsigned stream_buf_size) {
 	pthread_attr_t attr;
 	pthread_attr_init(&attr);
 #ifdef PTHREAD_STACK_MIN	
+#if EMBEDDED
+	sched_profile_t sched;
+	sched_get("stream", &sched);
+	pthread_attr_setstacksize(&attr, PTHREAD_STACK_MIN + (sched.stack ? sched.stack : STREAM_THREAD_STACK_SIZE));
+#else
 	pthread_attr_setstacksize(&attr, PTHREAD_STACK_MIN + STREAM_THREAD_STACK_SIZE);
+#endif
 #endif
 	pthread_create_name(&thread, &attr, stream_thread, NULL, "stream");
 	pthread_attr_destroy(&attr);
@@ -446,6 +574,7 @@ void stream_close(void) {
 	pthread_join(thread, NULL);
 #endif
 	free(stream.header);
+	free(range.header);
 	buf_destroy(streambuf);
 }
 
@@ -454,6 +583,11 @@ void stream_file(const char *header, size_t header_len, unsigned threshold) {
 
 	LOCK;
 
+	// local files are never re-opened
+	range.header_len = 0;
+	range.pending = range.expect = false;
+	range.session++;
+
 	stream.header_len = header_len;
 	memcpy(stream.header, header, header_len);
 	*(stream.header+header_len) = '\0';
@@ -485,8 +619,30 @@ void stream_file(const char *header, size_t header_len, unsigned threshold) {
 	UNLOCK;
 }
 
-void stream_sock(u32_t ip, u16_t port, const char *header, size_t header_len, unsigned threshold, bool cont_wait) {
+/*
+ A connection that can't be made fails the stream, unless it's a re-open that has retries
+ left. Re-opens that are not for current stream anymore must not touch it (stream locked)
+*/
+static void _sock_failed(bool ranged) {
+	if (ranged && range.reopen != range.session) return;
+
+	if (ranged && range.retries < RESUME_RETRIES) {
+		range.retries++;
+		range.pending = true;
+		LOG_WARN("re-open failed, retrying (%u/%u)", range.retries, RESUME_RETRIES);
+		return;
+	}
+
+	stream.state = DISCONNECT;
+	stream.disconnect = UNREACHABLE;
+}
+
+static void sock_open(u32_t ip, u16_t port, const char *header, size_t header_len, unsigned threshold, bool cont_wait, bool ranged) {
 	struct sockaddr_in addr;
+#if USE_SSL
+	// only published once we know this connection is still wanted
+	SSL *_ssl = NULL;
+#endif
 
 #if EMBEDDED
 	// wait till we are not polling anymore
@@ -512,9 +668,9 @@ void stream_sock(u32_t ip, u16_t port, const char *header, size_t header_len, un
 
 	if (connect_timeout(sock, (struct sockaddr *) &addr, sizeof(addr), 10) < 0) {
 		LOG_INFO("unable to connect to server");
+		closesocket(sock);
 		LOCK;
-		stream.state = DISCONNECT;
-		stream.disconnect = UNREACHABLE;
+		_sock_failed(ranged);
 		UNLOCK;
 		return;
 	}
@@ -523,52 +679,63 @@ void stream_sock(u32_t ip, u16_t port, const char *header, size_t header_len, un
 	if (ntohs(port) == 443) {
 		char server[256], *p;
 
-		ssl = SSL_new(SSLctx);
-		SSL_set_fd(ssl, sock);
+		_ssl = SSL_new(SSLctx);
+		SSL_set_fd(_ssl, sock);
 
 		// add SNI
 		sscanf(header, "Host:%255s", server);
 		if (server) {
 			if ((p = strchr(server, ':')) != NULL) *p = '\0';
-			SSL_set_tlsext_host_name(ssl, server);
+			SSL_set_tlsext_host_name(_ssl, server);
 		}
 		
 		while (1) {
 			int status, err = 0;
 
 			ERR_clear_error();
-			status = SSL_connect(ssl);
+			status = SSL_connect(_ssl);
 
 			// successful negotiation
 			if (status == 1) break;
 
 			// error or non-blocking requires more time
 			if (status < 0) {
-				err = SSL_get_error(ssl, status);
+				err = SSL_get_error(_ssl, status);
 				if (err == SSL_ERROR_WANT_READ || err == SSL_ERROR_WANT_WRITE) continue;
 			}
 
 			LOG_WARN("unable to open SSL socket %d (%d)", status, err);
 			closesocket(sock);
-			SSL_free(ssl);
-			ssl = NULL;
+			SSL_free(_ssl);
 			LOCK;
-			stream.state = DISCONNECT;
-			stream.disconnect = UNREACHABLE;
+			_sock_failed(ranged);
 			UNLOCK;
 
 			return;
 		}
-	} else {
-		ssl = NULL;	
 	}
 #endif
 
-	buf_flush(streambuf);
+	// a re-opened stream keeps its data, decoder flushes it when needed
+	if (!ranged) buf_flush(streambuf);
 
 	LOCK;
 
+	// stream has been stopped or replaced while we were connecting
+	if (ranged && range.reopen != range.session) {
+		LOG_INFO("stream changed, dropping re-opened connection");
+		UNLOCK;
+#if USE_SSL
+		if (_ssl) SSL_free(_ssl);
+#endif
+		closesocket(sock);
+		return;
+	}
+
 	fd = sock;
+#if USE_SSL
+	ssl = _ssl;
+#endif
 	stream.state = SEND_HEADERS;
 	stream.cont_wait = cont_wait;
 	stream.meta_interval = 0;
@@ -581,13 +748,83 @@ void stream_sock(u32_t ip, u16_t port, const char *header, size_t header_len, un
 
 	LOG_INFO("header: %s", stream.header);
 
-	stream.sent_headers = false;
-	stream.bytes = 0;
+	// a re-opened stream continues the same track for LMS
+	if (!ranged) {
+		stream.sent_headers = false;
+		stream.bytes = 0;
+	}
 	stream.threshold = threshold;
+	range.expect = ranged;
 
 	UNLOCK;
 }
 
+void stream_sock(u32_t ip, u16_t port, const char *header, size_t header_len, unsigned threshold, bool cont_wait) {
+	LOCK;
+	range.pending = false;
+	range.ip = ip;
+	range.port = port;
+	range.header_len = 0;
+	range.position = range.length = 0;
+	range.accept = false;
+	range.retries = 0;
+	range.session++;
+	// leave room for the range header, requests that already have one can't be re-opened
+	if (header_len >= 4 && header_len + 64 < MAX_HEADER && !memcmp(header + header_len - 4, "\r\n\r\n", 4)) {
+		memcpy(range.header, header, header_len);
+		range.header[header_len] = '\0';
+		if (!strcasestr(range.header, "Range:")) range.header_len = header_len;
+	}
+	UNLOCK;
+
+	sock_open(ip, port, header, header_len, threshold, cont_wait, false);
+}
+
+static void stream_reopen(void) {
+	char *header = malloc(MAX_HEADER);
+	size_t len;
+	unsigned threshold;
+
+	LOCK;
+
+	if (!header || !range.header_len) {
+		LOG_ERROR("can't re-open stream");
+		stream.state = DISCONNECT;
+		stream.disconnect = LOCAL_DISCONNECT;
+		wake_controller();
+		UNLOCK;
+		free(header);
+		return;
+	}
+
+	// request ends with an empty line, insert range before it
+	len = range.header_len - 2;
+	memcpy(header, range.header, len);
+	len += sprintf(header + len, "Range: bytes=" FMT_u64 "-\r\n\r\n", (u64_t) range.offset);
+	threshold = stream.threshold;
+	range.reopen = range.session;
+	UNLOCK;
+
+	LOG_INFO("re-opening stream at " FMT_u64, (u64_t) range.offset);
+	sock_open(range.ip, range.port, header, len, threshold, false, true);
+	free(header);
+}
+
+/* 
+called by decoders with streambuf locked, returns false if the stream can't be re-opened. 
+Data is flushed and the new one will start at offset
+*/
+bool _stream_range(u64_t offset) {
+	if (!range.header_len || stream.meta_interval || stream.state == STREAMING_FILE) {
+		return false;
+	}
+
+	_buf_flush(streambuf);
+	_reopen(offset);
+
+	return true;
+}
+
 bool stream_disconnect(void) {
 	bool disc = false;
 	LOCK;
@@ -603,6 +840,10 @@ bool stream_disconnect(void) {
 		fd = -1;
 		disc = true;
 	}
+	// stream has been stopped by LMS, decoder can't bring it back
+	range.header_len = 0;
+	range.pending = range.expect = false;
+	range.session++;
 	stream.state = STOPPED;
 	UNLOCK;
 	return disc;
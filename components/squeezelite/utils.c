@@ -443,7 +443,7 @@ void packn(u16_t *dest, u16_t val) {
 
 u32_t unpackN(u32_t *src) {
 	u8_t *ptr = (u8_t *)src;
-	return *(ptr) << 24 | *(ptr+1) << 16 | *(ptr+2) << 8 | *(ptr+3);
+	return (u32_t) *(ptr) << 24 | *(ptr+1) << 16 | *(ptr+2) << 8 | *(ptr+3);
 } 
 
 u16_t unpackn(u16_t *src) {
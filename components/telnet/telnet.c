@@ -26,13 +26,15 @@
 #include <lwip/sockets.h>
 #include <errno.h>
 #include <string.h>
+#include <sys/param.h>
 #include "sdkconfig.h"
-#include "freertos/ringbuf.h"
 #include "esp_app_trace.h"
 #include "telnet.h"
 #include "esp_vfs.h"
 #include "esp_vfs_dev.h"
 #include "esp_attr.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "soc/uart_struct.h"
 #include "driver/uart.h"
 #include "config.h"
@@ -40,6 +42,8 @@
 #include "platform_esp32.h"
 #include "messaging.h"
 #include "tools.h"
+#include "telemetry.h"
+#include "scheduler.h"
 
 /************************************
  * Globals
@@ -47,6 +51,7 @@
 
 #define TELNET_STACK_SIZE 4096
 #define TELNET_RX_BUF 1024
+#define TELNET_POLL_MS 50
 
 extern bool bypass_network_manager;
 
@@ -54,11 +59,32 @@ struct telnetUserData {
 	int sockfd;
 	telnet_t *tnHandle;
 	char * rxbuf;
+	char * chunk;
+	char * txbuf;
+	size_t txlen, txsize;
 };
 
+/*
+ Logs are written by any task into a byte ring and sent by the telnet task only, so
+ a logging task never waits on the network. Ring is in PSRAM so copies are guarded by
+ a mutex, not a spinlock, to keep interrupts enabled. When full, oldest bytes are
+ dropped, but they are only counted while a client is connected to read them.
+ This is not lock-free on purpose: dropping oldest means writers move the tail the
+ reader is consuming, and publishing reserved slots in order makes a writer spin on
+ a preempted one of lower priority. A mutex has priority inheritance instead.
+*/
+static struct {
+	uint8_t *data;
+	size_t size;
+	size_t head, tail, used;
+	uint32_t dropped;
+	bool reader;
+	SemaphoreHandle_t mutex;
+} log_ring;
+
 const static char TAG[] = "telnet";
+static TELEMETRY_COUNTER_DEFINE(telemetry_dropped, "telnet.dropped");
 static int uart_fd;
-static RingbufHandle_t buf_handle;
 static size_t send_chunk = 512;
 static size_t log_buf_size = 4*1024;
 static bool bIsEnabled=false;
@@ -74,7 +100,8 @@ static int 		stdout_open(const char * path, int flags, int mode);
 static int 		stdout_fstat(int fd, struct stat * st);
 static ssize_t 	stdout_write(int fd, const void * data, size_t size);
 static void 	handle_telnet_conn();
-static size_t 	process_logs( UBaseType_t bytes, bool make_room);
+static bool 	log_ring_write(const uint8_t *data, size_t size);
+static size_t 	log_ring_read(uint8_t *data, size_t size);
 
 void init_telnet(){
 	char *val= get_nvs_value_alloc(NVS_TYPE_STR, "telnet_enable");
@@ -107,14 +134,13 @@ void init_telnet(){
 		free(val);
 	}
 	// Redirect the output to our telnet handler as soon as possible
-	StaticRingbuffer_t *buffer_struct = (StaticRingbuffer_t *) heap_caps_malloc(sizeof(StaticRingbuffer_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-	// All non-split ring buffer must have their memory alignment set to 32 bits.
-	uint8_t *buffer_storage = (uint8_t *)heap_caps_malloc(sizeof(uint8_t)*log_buf_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT );
-	buf_handle = xRingbufferCreateStatic(log_buf_size, RINGBUF_TYPE_BYTEBUF, buffer_storage, buffer_struct);
-	if (buf_handle == NULL) {
+	log_ring.size = log_buf_size;
+	log_ring.mutex = xSemaphoreCreateMutex();
+	log_ring.data = (uint8_t *)heap_caps_malloc(sizeof(uint8_t)*log_buf_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT );
+	if (log_ring.data == NULL || log_ring.mutex == NULL) {
 		ESP_LOGE(TAG,"Failed to create ring buffer for telnet!");
 		messaging_post_message(MESSAGING_ERROR,MESSAGING_CLASS_SYSTEM,"Failed to allocate memory for telnet buffer");
-
+		FREE_AND_NULL(log_ring.data);
 		return;
 	}
 
@@ -141,10 +167,14 @@ void start_telnet(void * pvParameter){
 
 	isStarted=true;	
 
+	sched_profile_t sched;
+	sched_get("telnet", &sched);
+	uint32_t stack = sched.stack ? sched.stack : TELNET_STACK_SIZE;
+
 	StaticTask_t *xTaskBuffer = (StaticTask_t*) heap_caps_malloc(sizeof(StaticTask_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
-	StackType_t *xStack = heap_caps_malloc(TELNET_STACK_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+	StackType_t *xStack = heap_caps_malloc(stack, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
 	
-	xTaskCreateStatic( (TaskFunction_t) &telnet_task, "telnet", TELNET_STACK_SIZE, NULL, ESP_TASK_PRIO_MIN, xStack, xTaskBuffer);
+	xTaskCreateStaticPinnedToCore( (TaskFunction_t) &telnet_task, "telnet", stack, NULL, sched.priority, xStack, xTaskBuffer, sched.core);
 
 }
 
@@ -182,6 +212,27 @@ static void telnet_task(void *data) {
 	vTaskDelete(NULL);
 }
 
+/**
+ * Send what has been batched, returns false on socket error. When not waiting, whatever
+ * the socket can't take now stays in the batch
+ */
+static bool telnet_flush(struct telnetUserData *telnetUserData, bool wait) {
+	size_t sent = 0;
+
+	while (sent < telnetUserData->txlen) {
+		int len = send(telnetUserData->sockfd, telnetUserData->txbuf + sent, telnetUserData->txlen - sent, wait ? 0 : MSG_DONTWAIT);
+		if (len < 0) {
+			if (!wait && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+			return false;
+		}
+		sent += len;
+	}
+
+	telnetUserData->txlen -= sent;
+	memmove(telnetUserData->txbuf, telnetUserData->txbuf + sent, telnetUserData->txlen);
+	return true;
+}
+
 /**
  * Telnet handler.
  */
@@ -190,7 +241,14 @@ static void handle_telnet_events(telnet_t *thisTelnet, telnet_event_t *event, vo
 
 	switch(event->type) {
 	case TELNET_EV_SEND:
-		send(telnetUserData->sockfd, event->data.buffer, event->data.size, 0);
+		// libtelnet emits many small pieces (escaping, CR/LF), gather them into one send()
+		if (telnetUserData->txlen + event->data.size > telnetUserData->txsize) telnet_flush(telnetUserData, true);
+		if (event->data.size > telnetUserData->txsize) {
+			send(telnetUserData->sockfd, event->data.buffer, event->data.size, 0);
+		} else {
+			memcpy(telnetUserData->txbuf + telnetUserData->txlen, event->data.buffer, event->data.size);
+			telnetUserData->txlen += event->data.size;
+		}
 		break;
 	case TELNET_EV_DATA:
 		console_push(event->data.buffer, event->data.size);
@@ -203,30 +261,64 @@ static void handle_telnet_events(telnet_t *thisTelnet, telnet_event_t *event, vo
 	}
 }
 
-static size_t process_logs(UBaseType_t bytes, bool make_room){
-	UBaseType_t pending;
+/**
+ * Add logs to the ring, dropping oldest bytes when there is no room
+ */
+static bool log_ring_write(const uint8_t *data, size_t size) {
+	size_t dropped = 0;
+
+	// mutex can't be taken from ISR or with scheduler stopped, these only go to uart
+	if (xPortInIsrContext() || xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) return false;
 
-	vRingbufferGetInfo(buf_handle, NULL, NULL, NULL, NULL, &pending);
+	// only the tail of a write larger than the ring can fit
+	if (size > log_ring.size) {
+		dropped = size - log_ring.size;
+		data += dropped;
+		size = log_ring.size;
+	}
 
-	// nothing to do or we can do 
-	if (!partnerSocket || (make_room && log_buf_size - pending > bytes)) return pending;
+	xSemaphoreTake(log_ring.mutex, portMAX_DELAY);
 
-	// can't send more than what we have
-	if (bytes > pending) bytes = pending;
+	size_t room = log_ring.size - log_ring.used;
+	if (size > room) {
+		log_ring.tail = (log_ring.tail + size - room) % log_ring.size;
+		log_ring.used -= size - room;
+		dropped += size - room;
+	}
 
-	while (bytes > 0) {
-		size_t size;
-		char *item = (char *)xRingbufferReceiveUpTo(buf_handle, &size, pdMS_TO_TICKS(50), bytes);
-		
-		if (!item || !partnerSocket) break;
+	// without a client, ring is just history and overwriting it is not a loss
+	if (!log_ring.reader) dropped = 0;
+	log_ring.dropped += dropped;
 
-		bytes -= size;
-		telnet_send_text(tnHandle, item, size);
+	size_t first = MIN(size, log_ring.size - log_ring.head);
+	memcpy(log_ring.data + log_ring.head, data, first);
+	memcpy(log_ring.data, data + first, size - first);
+	log_ring.head = (log_ring.head + size) % log_ring.size;
+	log_ring.used += size;
 
-		vRingbufferReturnItem(buf_handle, (void *)item);
-	}
+	xSemaphoreGive(log_ring.mutex);
 
-	return pending - bytes;
+	if (dropped) telemetry_count(&telemetry_dropped, dropped);
+
+	return true;
+}
+
+/**
+ * Take up to size bytes out of the ring
+ */
+static size_t log_ring_read(uint8_t *data, size_t size) {
+	xSemaphoreTake(log_ring.mutex, portMAX_DELAY);
+
+	size = MIN(size, log_ring.used);
+	size_t first = MIN(size, log_ring.size - log_ring.tail);
+	memcpy(data, log_ring.data + log_ring.tail, first);
+	memcpy(data + first, log_ring.data, size - first);
+	log_ring.tail = (log_ring.tail + size) % log_ring.size;
+	log_ring.used -= size;
+
+	xSemaphoreGive(log_ring.mutex);
+
+	return size;
 }
 
 static void handle_telnet_conn() {
@@ -241,45 +333,83 @@ static void handle_telnet_conn() {
 		{TELNET_TELOPT_LINEMODE,   TELNET_WONT, TELNET_DO },
 		{ -1, 0, 0 }
 	};
-	struct telnetUserData *pTelnetUserData = (struct telnetUserData *)heap_caps_malloc(sizeof(struct telnetUserData), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-	tnHandle = telnet_init(my_telopts, handle_telnet_events, 0, pTelnetUserData);
+	struct telnetUserData *pTelnetUserData = (struct telnetUserData *)heap_caps_calloc(1, sizeof(struct telnetUserData), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+
+	if (pTelnetUserData) {
+		pTelnetUserData->rxbuf = (char *) heap_caps_malloc(TELNET_RX_BUF, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+		pTelnetUserData->chunk = (char *) heap_caps_malloc(send_chunk, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+		// escaping at most doubles a chunk, plus some room for negotiation
+		pTelnetUserData->txsize = 2 * send_chunk + 128;
+		pTelnetUserData->txbuf = (char *) heap_caps_malloc(pTelnetUserData->txsize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+	}
 
-	pTelnetUserData->rxbuf = (char *) heap_caps_malloc(TELNET_RX_BUF, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+	if (!pTelnetUserData || !pTelnetUserData->rxbuf || !pTelnetUserData->chunk || !pTelnetUserData->txbuf) {
+		ESP_LOGE(TAG, "can't allocate buffers for telnet session (chunk %zu bytes)", send_chunk);
+		if (pTelnetUserData) {
+			free(pTelnetUserData->rxbuf);
+			free(pTelnetUserData->chunk);
+			free(pTelnetUserData->txbuf);
+			free(pTelnetUserData);
+		}
+		close(partnerSocket);
+		partnerSocket = 0;
+		return;
+	}
+
+	tnHandle = telnet_init(my_telopts, handle_telnet_events, 0, pTelnetUserData);
 	pTelnetUserData->tnHandle = tnHandle;
 	pTelnetUserData->sockfd = partnerSocket;
 
-	bool pending = true;
+	// only report what is lost during this session
+	xSemaphoreTake(log_ring.mutex, portMAX_DELAY);
+	uint32_t dropped = log_ring.dropped;
+	log_ring.reader = true;
+	xSemaphoreGive(log_ring.mutex);
 
 	while(1) {
 		fd_set rfds, wfds;
-		struct timeval timeout = {0, 200*1000};
+
+		// previous batch is gone, gather next one
+		if (!pTelnetUserData->txlen) {
+			if (dropped != log_ring.dropped) {
+				int len = snprintf(pTelnetUserData->chunk, send_chunk, "\n*** %u bytes of log dropped ***\n", (unsigned) (log_ring.dropped - dropped));
+				telnet_send_text(tnHandle, pTelnetUserData->chunk, MIN((size_t) len, send_chunk - 1));
+				dropped = log_ring.dropped;
+			}
+			size_t len = log_ring_read((uint8_t*) pTelnetUserData->chunk, send_chunk);
+			if (len) telnet_send_text(tnHandle, pTelnetUserData->chunk, len);
+		}
 
 		FD_ZERO(&rfds);
 		FD_SET(partnerSocket, &rfds);
 
 		FD_ZERO(&wfds);
-		if (pending) FD_SET(partnerSocket, &wfds);
+		if (pTelnetUserData->txlen) FD_SET(partnerSocket, &wfds);
 
+		// when idle, wake up often enough to pick up new logs
+		struct timeval timeout = {0, (pTelnetUserData->txlen ? 200 : TELNET_POLL_MS) * 1000};
 		int res = select(partnerSocket + 1, &rfds, &wfds, NULL, &timeout);
 		if (res < 0) break;
 
 		if (FD_ISSET(partnerSocket, &rfds)) { 
 			int len = recv(partnerSocket, pTelnetUserData->rxbuf, TELNET_RX_BUF, 0);
-			if (!len) break;
+			if (len <= 0) break;
 			telnet_recv(tnHandle, pTelnetUserData->rxbuf, len);
 		}
 
-		if (FD_ISSET(partnerSocket, &wfds)) {	
-			pending = process_logs(send_chunk, false) > 0;
-		} else {
-			pending = true;
-		}
+		if (FD_ISSET(partnerSocket, &wfds) && !telnet_flush(pTelnetUserData, false)) break;
   	} 
 	
+	xSemaphoreTake(log_ring.mutex, portMAX_DELAY);
+	log_ring.reader = false;
+	xSemaphoreGive(log_ring.mutex);
+
 	telnet_free(tnHandle);
 	tnHandle = NULL;
 
 	free(pTelnetUserData->rxbuf);
+	free(pTelnetUserData->chunk);
+	free(pTelnetUserData->txbuf);
 	free(pTelnetUserData);
 
 	close(partnerSocket);
@@ -288,14 +418,11 @@ static void handle_telnet_conn() {
 
 // ******************* stdout/stderr Redirection to ringbuffer
 static ssize_t stdout_write(int fd, const void * data, size_t size) {
-	// flush the buffer and send item
-	if (buf_handle) {
-		process_logs(size, true);
-		xRingbufferSend(buf_handle, data, size, 0);
-	}
+	// never blocks, telnet task sends it when it can
+	bool queued = log_ring.data && log_ring_write(data, size);
 	
 	// mirror to uart if required
-	return (bMirrorToUART || !buf_handle) ? write(uart_fd, data, size) : size;
+	return (bMirrorToUART || !queued) ? write(uart_fd, data, size) : size;
 }
 
 static int stdout_open(const char * path, int flags, int mode) {
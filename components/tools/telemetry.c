@@ -0,0 +1,107 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "telemetry.h"
+
+static const char TAG[] = "telemetry";
+
+// singly-linked list, metrics are only added (at head) and never removed
+static telemetry_t *telemetry_list;
+
+/****************************************************************************************
+ * Add metric to registry, can be called concurrently and multiple times
+ */
+void telemetry_register(telemetry_t *metric) {
+	// only one caller gets to insert it
+	if (__atomic_exchange_n(&metric->registered, 1, __ATOMIC_ACQ_REL)) return;
+
+	telemetry_t *head = __atomic_load_n(&telemetry_list, __ATOMIC_RELAXED);
+	do {
+		metric->next = head;
+	} while (!__atomic_compare_exchange_n(&telemetry_list, &head, metric, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+	ESP_LOGD(TAG, "registered %s", metric->name);
+}
+
+/****************************************************************************************
+ * Add a sample to histogram
+ */
+void telemetry_observe(telemetry_t *metric, uint32_t value) {
+	telemetry_check(metric);
+
+	int bucket = value ? 32 - __builtin_clz(value) : 0;
+	if (bucket >= TELEMETRY_BUCKETS) bucket = TELEMETRY_BUCKETS - 1;
+
+	__atomic_fetch_add(metric->buckets + bucket, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&metric->sum, value, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&metric->count, 1, __ATOMIC_RELAXED);
+
+	uint32_t old = __atomic_load_n(&metric->max, __ATOMIC_RELAXED);
+	while (value > old && !__atomic_compare_exchange_n(&metric->max, &old, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+/****************************************************************************************
+ * Start a new min/max window for all gauges and histograms
+ */
+void telemetry_reset_window(void) {
+	for (telemetry_t *metric = __atomic_load_n(&telemetry_list, __ATOMIC_ACQUIRE); metric; metric = metric->next) {
+		__atomic_store_n(&metric->min, metric->type == TELEMETRY_GAUGE ? UINT32_MAX : 0, __ATOMIC_RELAXED);
+		__atomic_store_n(&metric->max, 0, __ATOMIC_RELAXED);
+	}
+}
+
+/****************************************************************************************
+ * Compact JSON object of all registered metrics
+ */
+cJSON* telemetry_get_json(void) {
+	cJSON *json = cJSON_CreateObject();
+
+	for (telemetry_t *metric = __atomic_load_n(&telemetry_list, __ATOMIC_ACQUIRE); metric; metric = metric->next) {
+		uint32_t max = __atomic_load_n(&metric->max, __ATOMIC_RELAXED);
+
+		if (metric->type == TELEMETRY_COUNTER) {
+			cJSON_AddNumberToObject(json, metric->name, __atomic_load_n(&metric->value, __ATOMIC_RELAXED));
+		} else if (metric->type == TELEMETRY_GAUGE) {
+			uint32_t min = __atomic_load_n(&metric->min, __ATOMIC_RELAXED);
+			cJSON *item = cJSON_AddObjectToObject(json, metric->name);
+			cJSON_AddNumberToObject(item, "cur", __atomic_load_n(&metric->value, __ATOMIC_RELAXED));
+			cJSON_AddNumberToObject(item, "min", min == UINT32_MAX ? __atomic_load_n(&metric->value, __ATOMIC_RELAXED) : min);
+			cJSON_AddNumberToObject(item, "max", max);
+			if (metric->size) cJSON_AddNumberToObject(item, "size", metric->size);
+		} else {
+			int last = TELEMETRY_BUCKETS - 1;
+			cJSON *item = cJSON_AddObjectToObject(json, metric->name);
+			cJSON_AddNumberToObject(item, "n", __atomic_load_n(&metric->count, __ATOMIC_RELAXED));
+			cJSON_AddNumberToObject(item, "sum", __atomic_load_n(&metric->sum, __ATOMIC_RELAXED));
+			cJSON_AddNumberToObject(item, "max", max);
+			// trailing empty buckets are omitted
+			while (last > 0 && !__atomic_load_n(metric->buckets + last, __ATOMIC_RELAXED)) last--;
+			cJSON *buckets = cJSON_AddArrayToObject(item, "b");
+			for (int i = 0; i <= last; i++) {
+				cJSON_AddItemToArray(buckets, cJSON_CreateNumber(__atomic_load_n(metric->buckets + i, __ATOMIC_RELAXED)));
+			}
+		}
+	}
+
+	return json;
+}
+
+/****************************************************************************************
+ * Same as above, but as a string that caller must free
+ */
+char* telemetry_alloc_json(void) {
+	cJSON *json = telemetry_get_json();
+	char *text = cJSON_PrintUnformatted(json);
+	cJSON_Delete(json);
+	return text;
+}
@@ -0,0 +1,90 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_timer.h"
+#include "cJSON.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ Lock-free telemetry registry. Metrics are statically defined by their owner and
+ register themselves on first update, so they cost nothing until used. Updates only
+ use 32 bits atomics and can be made from any task (not from ISR).
+ - counters are monotonic (wrap at 2^32), receivers should compute rates
+ - gauges keep current value and min/max since last reset (window)
+ - histograms have power-of-2 buckets: bucket 0 is 0, bucket i is [2^(i-1), 2^i[ and
+   last bucket has everything above. Count and sum are monotonic, max is windowed
+ The window is owned by the monitor, which resets it every MONITOR_TIMER, so other
+ readers must not call telemetry_reset_window()
+*/
+
+#define TELEMETRY_BUCKETS	20
+
+typedef enum { TELEMETRY_COUNTER, TELEMETRY_GAUGE, TELEMETRY_HISTOGRAM } telemetry_type_t;
+
+typedef struct telemetry_s {
+	const char *name;
+	telemetry_type_t type;
+	uint32_t size;				// gauge full scale (0 if none)
+	uint32_t registered;
+	struct telemetry_s *next;
+	uint32_t value, min, max;
+	uint32_t count, sum;
+	uint32_t buckets[TELEMETRY_BUCKETS];
+} telemetry_t;
+
+#define TELEMETRY_COUNTER_DEFINE(var, name) 	telemetry_t var = { name, TELEMETRY_COUNTER }
+#define TELEMETRY_GAUGE_DEFINE(var, name) 		telemetry_t var = { name, TELEMETRY_GAUGE, .min = UINT32_MAX }
+#define TELEMETRY_HISTOGRAM_DEFINE(var, name) 	telemetry_t var = { name, TELEMETRY_HISTOGRAM }
+
+void 	telemetry_register(telemetry_t *metric);
+void 	telemetry_observe(telemetry_t *metric, uint32_t value);
+void 	telemetry_reset_window(void);
+cJSON*	telemetry_get_json(void);
+char*	telemetry_alloc_json(void);
+
+static inline void telemetry_check(telemetry_t *metric) {
+	if (__builtin_expect(!__atomic_load_n(&metric->registered, __ATOMIC_ACQUIRE), 0)) telemetry_register(metric);
+}
+
+static inline void telemetry_count(telemetry_t *metric, uint32_t n) {
+	telemetry_check(metric);
+	__atomic_fetch_add(&metric->value, n, __ATOMIC_RELAXED);
+}
+
+static inline void telemetry_gauge(telemetry_t *metric, uint32_t value, uint32_t size) {
+	telemetry_check(metric);
+	__atomic_store_n(&metric->value, value, __ATOMIC_RELAXED);
+	metric->size = size;
+	// min/max are rarely changed, so only pay for CAS then
+	uint32_t old = __atomic_load_n(&metric->min, __ATOMIC_RELAXED);
+	while (value < old && !__atomic_compare_exchange_n(&metric->min, &old, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+	old = __atomic_load_n(&metric->max, __ATOMIC_RELAXED);
+	while (value > old && !__atomic_compare_exchange_n(&metric->max, &old, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+static inline uint32_t telemetry_now(void) {
+	return (uint32_t) esp_timer_get_time();
+}
+
+// observe elapsed microseconds since a telemetry_now() timestamp
+static inline void telemetry_elapsed(telemetry_t *metric, uint32_t start) {
+	telemetry_observe(metric, telemetry_now() - start);
+}
+
+#ifdef __cplusplus
+}
+#endif
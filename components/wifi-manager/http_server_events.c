@@ -0,0 +1,246 @@
+/*
+Copyright (c) 2017-2021 Sebastien L
+*/
+#ifdef NETWORK_HTTP_SERVER_LOG_LEVEL
+#define LOG_LOCAL_LEVEL NETWORK_HTTP_SERVER_LOG_LEVEL
+#endif
+#include "http_server_events.h"
+#include "http_server_handlers.h"
+#include <string.h>
+#include <unistd.h>
+#include "esp_log.h"
+#include "esp_task.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "messaging.h"
+#include "network_manager.h"
+#include "network_status.h"
+#include "tools.h"
+#include "scheduler.h"
+
+/*
+ The web UI used to poll /status.json and /messages.json, each request locking the
+ status buffer, printing a full document and re-triggering a status update. Clients
+ that open /events instead share a single task that drains the messaging ring buffer
+ and only pushes status when it changes. All socket writes are queued to the httpd
+ task so they can't race with session closing.
+*/
+#define EVENTS_MAX_CLIENTS		2
+#define EVENTS_STACK_SIZE		(3*1024)
+#define EVENTS_POLL_MS			250
+#define EVENTS_REFRESH_MS		2000
+#define EVENTS_KEEPALIVE_MS		15000
+
+static const char TAG[] = "httpd_events";
+static const char events_header[] = "HTTP/1.1 200 OK\r\n"
+									"Content-Type: text/event-stream\r\n"
+									"Cache-Control: no-cache\r\n"
+									"Connection: keep-alive\r\n"
+									"Access-Control-Allow-Origin: *\r\n\r\n";
+
+extern messaging_handle_t messaging;
+
+typedef struct {
+	size_t len;
+	char data[];
+} events_frame_t;
+
+static httpd_handle_t events_server;
+static TaskHandle_t events_task;
+static int events_clients[EVENTS_MAX_CLIENTS] = { [0 ... EVENTS_MAX_CLIENTS - 1] = -1 };
+static volatile int events_count;
+
+/****************************************************************************************
+ * Runs in httpd context
+ */
+static bool events_send(httpd_handle_t hd, int fd, const char *data, size_t len) {
+	while (len) {
+		int sent = httpd_socket_send(hd, fd, data, len, 0);
+		if (sent <= 0) return false;
+		data += sent;
+		len -= sent;
+	}
+	return true;
+}
+
+/****************************************************************************************
+ * Runs in httpd context
+ */
+static void events_remove(int fd) {
+	for (int i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+		if (events_clients[i] != fd) continue;
+		events_clients[i] = -1;
+		events_count--;
+		ESP_LOGD(TAG, "client on socket %d removed, %d left", fd, events_count);
+	}
+}
+
+/****************************************************************************************
+ * Queued work: send one frame to all clients
+ */
+static void events_broadcast_work(void *arg) {
+	events_frame_t *frame = (events_frame_t*) arg;
+
+	for (int i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+		int fd = events_clients[i];
+		if (fd < 0 || events_send(events_server, fd, frame->data, frame->len)) continue;
+		ESP_LOGW(TAG, "send failed on socket %d, closing", fd);
+		events_remove(fd);
+		httpd_sess_trigger_close(events_server, fd);
+	}
+
+	free(frame);
+}
+
+/****************************************************************************************
+ * Build an event frame and queue it for sending, json must be unformatted (one line)
+ */
+static void events_broadcast(const char *event, const char *json) {
+	size_t len = event ? strlen("event: \ndata: \n\n") + strlen(event) + strlen(json) : strlen(json);
+	events_frame_t *frame = malloc(sizeof(events_frame_t) + len + 1);
+
+	if (!frame) {
+		ESP_LOGE(TAG, "No memory for %s event", STR_OR_BLANK(event));
+		return;
+	}
+
+	if (event) frame->len = sprintf(frame->data, "event: %s\ndata: %s\n\n", event, json);
+	else frame->len = sprintf(frame->data, "%s", json);
+
+	if (httpd_queue_work(events_server, events_broadcast_work, frame) != ESP_OK) {
+		ESP_LOGW(TAG, "Unable to queue %s event", STR_OR_BLANK(event));
+		free(frame);
+	}
+}
+
+/****************************************************************************************
+ * Current status document, NULL if the buffer is busy
+ */
+static char *events_alloc_status() {
+	char *status = NULL;
+	if (network_status_lock_json_buffer(pdMS_TO_TICKS(200))) {
+		status = network_status_alloc_get_ip_info_json();
+		network_status_unlock_json_buffer();
+	}
+	return status;
+}
+
+/****************************************************************************************
+ * Event task: pushes messages and status changes while there are clients
+ */
+static void events_task_fn(void *arg) {
+	char *last_status = NULL;
+	TickType_t refresh = 0, keepalive = xTaskGetTickCount();
+
+	while (1) {
+		bool notified = ulTaskNotifyTake(pdTRUE, events_count ? pdMS_TO_TICKS(EVENTS_POLL_MS) : portMAX_DELAY) > 0;
+		TickType_t now = xTaskGetTickCount();
+
+		if (!events_count) {
+			FREE_AND_NULL(last_status);
+			continue;
+		}
+
+		// messages are consumed here as long as someone listens, /messages.json gets nothing
+		if (messaging_pending(messaging)) {
+			char *text = messaging_alloc_messages_json(messaging);
+			if (text) events_broadcast("messages", text);
+			free(text);
+		}
+
+		// status is sent when the network task reports an update, and only if it changed
+		if (notified || !last_status) {
+			char *status = events_alloc_status();
+			if (status && (!last_status || strcmp(status, last_status))) {
+				events_broadcast("status", status);
+				free(last_status);
+				last_status = status;
+				keepalive = now;
+			} else {
+				free(status);
+			}
+		}
+
+		// the network task refreshes basic info (battery, jack...) and calls us back
+		if (now - refresh >= pdMS_TO_TICKS(EVENTS_REFRESH_MS)) {
+			network_async_update_status();
+			refresh = now;
+		}
+
+		// comment lines keep proxies and browsers from timing out idle streams
+		if (now - keepalive >= pdMS_TO_TICKS(EVENTS_KEEPALIVE_MS)) {
+			events_broadcast(NULL, ": ping\n\n");
+			keepalive = now;
+		}
+	}
+}
+
+/****************************************************************************************
+ *
+ */
+void http_server_events_notify() {
+	if (events_task && events_count) xTaskNotifyGive(events_task);
+}
+
+/****************************************************************************************
+ *
+ */
+void http_server_events_close(httpd_handle_t hd, int sockfd) {
+	events_remove(sockfd);
+	close(sockfd);
+}
+
+/****************************************************************************************
+ *
+ */
+esp_err_t events_get_handler(httpd_req_t *req) {
+	int fd = httpd_req_to_sockfd(req);
+	int slot = -1;
+
+	ESP_LOGD_LOC(TAG, "serving [%s] on socket %d", req->uri, fd);
+
+	for (int i = 0; i < EVENTS_MAX_CLIENTS; i++) {
+		if (events_clients[i] == fd) return ESP_OK;
+		if (events_clients[i] < 0 && slot < 0) slot = i;
+	}
+
+	// browser falls back to polling
+	if (slot < 0) {
+		ESP_LOGW(TAG, "Too many event clients");
+		httpd_resp_set_status(req, "503 Service Unavailable");
+		return httpd_resp_send(req, NULL, 0);
+	}
+
+	if (!events_task) {
+		sched_profile_t sched;
+		sched_get("http_events", &sched);
+		if (xTaskCreatePinnedToCore(&events_task_fn, "http_events", sched.stack ? sched.stack : EVENTS_STACK_SIZE, NULL, sched.priority, &events_task, sched.core) != pdPASS) {
+			ESP_LOGE(TAG, "Unable to start events task");
+			events_task = NULL;
+			return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Unable to start events");
+		}
+	}
+
+	// no length and no chunking: the stream ends when the socket does
+	if (!events_send(req->handle, fd, events_header, strlen(events_header))) return ESP_FAIL;
+
+	// new client needs the full status, then the task sends changes
+	char *status = events_alloc_status();
+	if (status) {
+		char *frame = malloc(strlen("event: status\ndata: \n\n") + strlen(status) + 1);
+		if (frame) {
+			sprintf(frame, "event: status\ndata: %s\n\n", status);
+			events_send(req->handle, fd, frame, strlen(frame));
+			free(frame);
+		}
+		free(status);
+	}
+
+	events_server = req->handle;
+	events_clients[slot] = fd;
+	events_count++;
+	ESP_LOGI(TAG, "client on socket %d registered, %d total", fd, events_count);
+	xTaskNotifyGive(events_task);
+
+	return ESP_OK;
+}
@@ -0,0 +1,19 @@
+/*
+Copyright (c) 2017-2021 Sebastien L
+*/
+#pragma once
+#include "esp_http_server.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* GET /events: Server-Sent Events stream pushing "status" and "messages" to the web UI */
+esp_err_t events_get_handler(httpd_req_t *req);
+/* httpd close_fn: forgets event clients before closing their socket */
+void http_server_events_close(httpd_handle_t hd, int sockfd);
+/* wakes up the event task when network status has been updated */
+void http_server_events_notify();
+
+#ifdef __cplusplus
+}
+#endif
@@ -27,8 +27,10 @@ Copyright (c) 2017-2021 Sebastien L
 #include "network_wifi.h"
 #include "network_status.h"
 #include "tools.h"
+#include "telemetry.h"
 
 #define HTTP_STACK_SIZE	(5*1024)
+#define RESOURCE_CHUNK_SIZE	(8*1024)
 const char str_na[]="N/A";
 #define STR_OR_NA(s) s?s:str_na
 /* @brief tag used for ESP serial console messages */
@@ -36,7 +38,7 @@ static const char TAG[] = "httpd_handlers";
 /* @brief task handle for the http server */
 
 SemaphoreHandle_t http_server_config_mutex = NULL;
-extern RingbufHandle_t messaging;
+extern messaging_handle_t messaging;
 #define AUTH_TOKEN_SIZE 50
 typedef struct session_context {
     char * auth_token;
@@ -338,6 +340,42 @@ int resource_get_index(const char * fileName){
 	}
 	return -1;
 }
+/* Sends an embedded resource with its ETag, or 304 when the client already has it.
+ * Fingerprinted resources can be cached forever, others must be revalidated */
+static esp_err_t resource_send(httpd_req_t *req, int idx, bool immutable){
+	const char * etag = resource_etags[idx];
+	const char * data = (const char *)resource_map_start[idx];
+	size_t file_size = (resource_map_end[idx] - resource_map_start[idx]);
+	char if_none_match[48];
+
+	httpd_resp_set_hdr(req, "ETag", etag);
+	httpd_resp_set_hdr(req, "Cache-Control", immutable ? "public, max-age=31536000, immutable" : "no-cache");
+
+	// only exact (or list containing) match, we don't do weak validators
+	if(httpd_req_get_hdr_value_str(req, "If-None-Match", if_none_match, sizeof(if_none_match)) == ESP_OK &&
+	   (strstr(if_none_match, etag) || strcmp(if_none_match, "*") == 0)){
+		ESP_LOGD_LOC(TAG, "[%s] not modified", resource_lookups[idx]);
+		httpd_resp_set_status(req, "304 Not Modified");
+		return httpd_resp_send(req, NULL, 0);
+	}
+
+	if(file_size <= RESOURCE_CHUNK_SIZE){
+		return httpd_resp_send(req, data, file_size);
+	}
+
+	// large bundles go in chunks so each socket write stays short
+	while(file_size){
+		size_t len = MIN(file_size, RESOURCE_CHUNK_SIZE);
+		if(httpd_resp_send_chunk(req, data, len) != ESP_OK){
+			ESP_LOGW_LOC(TAG, "Sending [%s] aborted", resource_lookups[idx]);
+			return ESP_FAIL;
+		}
+		data += len;
+		file_size -= len;
+	}
+	return httpd_resp_send_chunk(req, NULL, 0);
+}
+
 esp_err_t root_get_handler(httpd_req_t *req){
 	esp_err_t err = ESP_OK;
     ESP_LOGD_LOC(TAG, "serving [%s]", req->uri);
@@ -349,11 +387,10 @@ esp_err_t root_get_handler(httpd_req_t *req){
     }
 	int idx=-1;
 	if((idx=resource_get_index("index.html"))>=0){
-		const size_t file_size = (resource_map_end[idx] - resource_map_start[idx]);
 		httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
 		err = set_content_type_from_req(req);
 		if(err == ESP_OK){
-			httpd_resp_send(req, (const char *)resource_map_start[idx], file_size);
+			err = resource_send(req, idx, false);
 		} 
 	}
     else{
@@ -392,8 +429,11 @@ esp_err_t resource_filehandler(httpd_req_t *req){
 		if(strstr(resource_lookups[idx], ".gz")) {
 			httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
 		}
-	    const size_t file_size = (resource_map_end[idx] - resource_map_start[idx]);
-	    httpd_resp_send(req, (const char *)resource_map_start[idx], file_size);
+		// webpack puts a content hash in bundle names, so these never change
+		bool immutable = strncmp(resource_lookups[idx], "/js/", 4) == 0 || strncmp(resource_lookups[idx], "/css/", 5) == 0;
+		if(resource_send(req, idx, immutable) != ESP_OK){
+			return ESP_FAIL;
+		}
 	}
 	else {
 	   ESP_LOGE_LOC(TAG, "Unknown resource [%s] from path [%s] ", filename,filepath);
@@ -1091,12 +1131,10 @@ esp_err_t messages_get_handler(httpd_req_t *req){
 	if(err != ESP_OK){
 		return err;
 	}
-	cJSON * json_messages=  messaging_retrieve_messages(messaging);
-	if(json_messages!=NULL){
-		char * json_text= cJSON_Print(json_messages);
+	char * json_text = messaging_alloc_messages_json(messaging);
+	if(json_text!=NULL){
 		httpd_resp_send(req, (const char *)json_text, strlen(json_text));
 		free(json_text);
-		cJSON_Delete(json_messages);
 	}
 	else {
 		httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR , "Unable to retrieve messages");
@@ -1104,6 +1142,23 @@ esp_err_t messages_get_handler(httpd_req_t *req){
 	return ESP_OK;
 }
 
+esp_err_t telemetry_get_handler(httpd_req_t *req){
+    ESP_LOGD_LOC(TAG, "serving [%s]", req->uri);
+    esp_err_t err = set_content_type_from_req(req);
+	if(err != ESP_OK){
+		return err;
+	}
+	char * json_text = telemetry_alloc_json();
+	if(json_text){
+		httpd_resp_send(req, (const char *)json_text, strlen(json_text));
+		free(json_text);
+	}
+	else {
+		httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR , "Unable to retrieve telemetry");
+	}
+	return ESP_OK;
+}
+
 esp_err_t status_get_handler(httpd_req_t *req){
     ESP_LOGD_LOC(TAG, "serving [%s]", req->uri);
     if(!is_user_authenticated(req)){
@@ -3,6 +3,7 @@
 #endif
 
 #include "network_status.h"
+#include "http_server_events.h"
 #include <string.h>
 #ifdef CONFIG_BT_ENABLED
 #include "bt_app_core.h"
@@ -188,6 +189,7 @@ static void connect_notify(in_addr_t ip, u16_t hport, u16_t cport) {
 void network_status_update_basic_info() {
     // locking happens below this level
     network_status_get_basic_info(&ip_info_cjson);
+    http_server_events_notify();
 }
 
 cJSON* network_status_update_float(cJSON** root, const char* key, float value) {
@@ -345,5 +347,6 @@ void network_status_update_ip_info(update_reason_code_t update_reason_code) {
     } else {
         ESP_LOGW(TAG, "Unable to lock status json buffer. ");
     }
+    http_server_events_notify();
     ESP_LOGV(TAG, "wifi_status_generate_ip_info_json done");
 }
@@ -1,2 +0,0 @@
-(()=>{"use strict";var t,e={322:(t,e,n)=>{n.r(e);var a=n(531),s=n(152),o=n(687),i=n.n(o),r=n(955),c=n(755);function l(t,e){var n="undefined"!=typeof Symbol&&t[Symbol.iterator]||t["@@iterator"];if(!n){if(Array.isArray(t)||(n=function(t,e){if(!t)return;if("string"==typeof t)return u(t,e);var n=Object.prototype.toString.call(t).slice(8,-1);"Object"===n&&t.constructor&&(n=t.constructor.name);if("Map"===n||"Set"===n)return Array.from(t);if("Arguments"===n||/^(?:Ui|I)nt(?:8|16|32)(?:Clamped)?Array$/.test(n))return u(t,e)}(t))||e&&t&&"number"==typeof t.length){n&&(t=n);var a=0,s=function(){};return{s,n:function(){return a>=t.length?{done:!0}:{done:!1,value:t[a++]}},e:function(t){throw t},f:s}}throw new TypeError("Invalid attempt to iterate non-iterable instance.\nIn order to be iterable, non-array objects must have a [Symbol.iterator]() method.")}var o,i=!0,r=!1;return{s:function(){n=n.call(t)},n:function(){var t=n.next();return i=t.done,t},e:function(t){r=!0,o=t},f:function(){try{i||null==n.return||n.return()}finally{if(r)throw o}}}}function u(t,e){(null==e||e>t.length)&&(e=t.length);for(var n=0,a=new Array(e);n<e;n++)a[n]=t[n];return a}var d=n(492),h=n(702).Promise;function f(){var t=p(r.Z.get("show-nvs"));c("input#show-nvs")[0].checked=t,c("input#show-nvs")[0].checked||D?c('*[href*="-nvs"]').show():c('*[href*="-nvs"]').hide()}function p(t){return null!=t&&"string"==typeof t&&t.match("[Yy1]")}window.bootstrap=n(138),String.prototype.format||Object.assign(String.prototype,{format:function(){var t=arguments;return this.replace(/{(\d+)}/g,(function(e,n){return void 0!==t[n]?t[n]:e}))}}),String.prototype.encodeHTML||Object.assign(String.prototype,{encodeHTML:function(){return d.encode(this).replace(/\n/g,"<br />")}}),Object.assign(Date.prototype,{toLocalShort:function(){return this.toLocaleString(void 0,{dateStyle:"short",timeStyle:"short"})}});var m=1,b=17,g=2,v=18,S=4,_=20,y=8,w=24,T={bt_playing:{label:"",icon:"media_bluetooth_on"},bt_disconnected:{label:"",icon:"media_bluetooth_off"},bt_neutral:{label:"",icon:"bluetooth"},bt_connecting:{label:"",icon:"bluetooth_searching"},bt_connected:{label:"",icon:"bluetooth_connected"},bt_disabled:{label:"",icon:"bluetooth_disabled"},play_arrow:{label:"",icon:"play_circle_filled"},pause:{label:"",icon:"pause_circle"},stop:{label:"",icon:"stop_circle"},"":{label:"",icon:""}},E=[{icon:"battery_0_bar",label:"▪",ranges:[{f:5.8,t:6.8},{f:8.8,t:10.2}]},{icon:"battery_2_bar",label:"▪▪",ranges:[{f:6.8,t:7.4},{f:10.2,t:11.1}]},{icon:"battery_3_bar",label:"▪▪▪",ranges:[{f:7.4,t:7.5},{f:11.1,t:11.25}]},{icon:"battery_4_bar",label:"▪▪▪▪",ranges:[{f:7.5,t:7.8},{f:11.25,t:11.7}]}],A=[{desc:"Idle",sub:["bt_neutral"]},{desc:"Discovering",sub:["bt_connecting"]},{desc:"Discovered",sub:["bt_connecting"]},{desc:"Unconnected",sub:["bt_disconnected"]},{desc:"Connecting",sub:["bt_connecting"]},{desc:"Connected",sub:["bt_connected","play_arrow","bt_playing","pause","stop"]},{desc:"Disconnecting",sub:["bt_disconnected"]}],O={MESSAGING_INFO:"badge-success",MESSAGING_WARNING:"badge-warning",MESSAGING_ERROR:"badge-danger"},k={OK:0,FAIL:1,DISC:2,LOST:3,RESTORE:4,ETH:5},N={0:"eRunning",1:"eReady",2:"eBlocked",3:"eSuspended",4:"eDeleted"},R={NONE:0,REBOOT_TO_RECOVERY:2,SET_FWURL:5,FLASHING:6,DONE:7,UPLOADING:8,ERROR:9,UPLOADCOMPLETE:10,_state:-1,olderRecovery:!1,statusText:"",flashURL:"",flashFileName:"",statusPercent:0,Completed:!1,recovery:!1,prevRecovery:!1,updateModal:new bootstrap.Modal(document.getElementById("otadiv"),{}),reset:function(){return this.olderRecovery=!1,this.statusText="",this.statusPercent=-1,this.flashURL="",this.flashFileName=void 0,this.UpdateProgress(),c("#rTable tr.release").removeClass("table-success table-warning"),c(".flact").prop("disabled",!1),c("#flashfilename").value=null,c("#fw-url-input").value=null,this.isStateError()||(c("span#flash-status").html(""),c("#fwProgressLabel").parent().removeClass("bg-danger")),this._state=this.NONE,this},isStateUploadComplete:function(){return this._state==this.UPLOADCOMPLETE},isStateError:function(){return this._state==this.ERROR},isStateNone:function(){return this._state==this.NONE},isStateRebootRecovery:function(){return this._state==this.REBOOT_TO_RECOVERY},isStateSetUrl:function(){return this._state==this.SET_FWURL},isStateFlashing:function(){return this._state==this.FLASHING},isStateDone:function(){return this._state==this.DONE},isStateUploading:function(){return this._state==this.UPLOADING},init:function(){return this._state=this.NONE,this},SetStateError:function(){return this._state=this.ERROR,c("#fwProgressLabel").parent().addClass("bg-danger"),this},SetStateNone:function(){return this._state=this.NONE,this},SetStateRebootRecovery:function(){return this._state=this.REBOOT_TO_RECOVERY,this.SetStatusText("Starting recovery mode."),c.ajax({url:"/recovery.json",context:this,dataType:"text",method:"POST",cache:!1,contentType:"application/json; charset=utf-8",data:JSON.stringify({timestamp:Date.now()}),error:function(t,e,n){var a;this.setOTAError("Unexpected error while trying to restart to recovery. (status=".concat(null!==(a=t.status)&&void 0!==a?a:"",", error=").concat(null!=n?n:""," ) "))},complete:function(t){this.SetStatusText("Waiting for system to boot.")}}),this},SetStateSetUrl:function(){return this._state=this.SET_FWURL,this.statusText="Sending firmware download location.",I({fwurl:{value:this.flashURL,type:33}}),this},SetStateFlashing:function(){return this._state=this.FLASHING,this},SetStateDone:function(){return this._state=this.DONE,this.reset(),this},SetStateUploading:function(){return this._state=this.UPLOADING,this.SetStatusText("Sending file to device.")},SetStateUploadComplete:function(){return this._state=this.UPLOADCOMPLETE,this},isFlashExecuting:function(){return!0==(this._state!=this.UPLOADING&&(""!==this.statusText||this.statusPercent>=0))},toString:function(){var t=this;return Object.keys(this).find((function(e){return t[e]===t._state}))},setOTATargets:function(){this.flashURL="",this.flashFileName="",this.flashURL=c("#fw-url-input").val();var t=c("#flashfilename")[0].files;return t.length>0&&(this.flashFileName=t[0]),0==this.flashFileName.length&&0==this.flashURL.length&&this.setOTAError("Invalid url or file. Cannot start OTA"),this},setOTAError:function(t){return this.SetStateError().SetStatusPercent(0).SetStatusText(t).reset(),this},ShowDialog:function(){return this.isStateNone()||(this.updateModal.show(),c(".flact").prop("disabled",!0)),this},SetStatusPercent:function(t){var e=this.statusPercent!=t;return this.statusPercent=t,e&&(this.isStateUploading()||this.isStateFlashing()||this.SetStateFlashing(),100==t&&(this.isStateFlashing()?this.SetStateDone():this.isStateUploading()&&(this.statusPercent=0,this.SetStateFlashing())),this.UpdateProgress().ShowDialog()),this},SetStatusText:function(t){var e=this.statusText!=t;return this.statusText=t,e&&(c("span#flash-status").html(this.statusText),this.ShowDialog()),this},UpdateProgress:function(){return c(".progress-bar").css("width",this.statusPercent+"%").attr("aria-valuenow",this.statusPercent).text(this.statusPercent+"%"),c(".progress-bar").html((this.isStateDone()?100:this.statusPercent)+"%"),this},StartOTA:function(){return this.logEvent(this.StartOTA.name),c("#fwProgressLabel").parent().removeClass("bg-danger"),this.setOTATargets(),this.isStateError()||(D?this.SetStateFlashing().TargetReadyStartOTA():this.SetStateRebootRecovery()),this},UploadLocalFile:function(){this.SetStateUploading();var t=new XMLHttpRequest;t.context=this;var e=this.HandleUploadProgressEvent.bind(this),n=this.setOTAError.bind(this);t.upload.addEventListener("progress",e,!1),t.onreadystatechange=function(){4===t.readyState&&(0!==t.status&&404!==t.status||n("Upload Failed. Recovery version might not support uploading. Please use web update instead."))},t.open("POST","/flash.json",!0),t.send(this.flashFileName)},TargetReadyStartOTA:function(){return D&&this.prevRecovery&&!this.isStateRebootRecovery()&&!this.isStateFlashing()?this:(this.logEvent(this.TargetReadyStartOTA.name),D?(this.prevRecovery=!0,void(""!==this.flashFileName?this.UploadLocalFile():""!=this.flashURL?this.SetStateSetUrl():this.setOTAError("Invalid URL or file name while trying to start the OTa process"))):(console.error("Event TargetReadyStartOTA fired in the wrong mode "),this))},HandleUploadProgressEvent:function(t){this.logEvent(this.HandleUploadProgressEvent.name),this.SetStateUploading().SetStatusPercent(Math.round(t.loaded/t.total*100)).SetStatusText("Uploading file to device")},EventTargetStatus:function(t){var e,n;this.isStateNone()||this.logEvent(this.EventTargetStatus.name),null!==(e=t.ota_pct)&&void 0!==e&&e&&(this.olderRecovery=!0,this.SetStatusPercent(t.ota_pct)),""!=(null!==(n=t.ota_dsc)&&void 0!==n?n:"")&&(this.olderRecovery=!0,this.SetStatusText(t.ota_dsc)),null!=t.recovery&&(this.recovery=1===t.recovery),this.isStateRebootRecovery()&&this.recovery&&this.TargetReadyStartOTA()},EventOTAMessageClass:function(t){this.logEvent(this.EventOTAMessageClass.name);var e=JSON.parse(t);this.SetStatusPercent(e.ota_pct).SetStatusText(e.ota_dsc)},logEvent:function(t){console.log("".concat(t,", flash state ").concat(this.toString(),", recovery: ").concat(this.recovery,", ota pct: ").concat(this.statusPercent,", ota desc: ").concat(this.statusText))}};window.hideSurrounding=function(t){c(t).parent().parent().hide()};var x=!1,C=2500;function I(t){var e={timestamp:Date.now(),config:t};c.ajax({url:"/config.json",dataType:"text",method:"POST",cache:!1,contentType:"application/json; charset=utf-8",data:JSON.stringify(e),error:P})}function G(){return tt.hasOwnProperty("ip")&&"0.0.0.0"!=tt.ip&&""!=tt.ip}function M(t){return G()?t.icon:t.label}function P(t,e,n){console.log(t.status),console.log(n),""!==n&&yt(n,"MESSAGING_ERROR")}function j(t,e,n){var a=arguments.length>3&&void 0!==arguments[3]&&arguments[3],s="table-success";"MESSAGING_WARNING"===e?s="table-warning":"MESSAGING_ERROR"===e&&(s="table-danger"),c("#toast_"+t).removeClass("table-success").removeClass("table-warning").removeClass("table-danger").addClass(s).addClass("show");var o=n.substring(0,n.length-1).encodeHTML().replace(/\n/g,"<br />");o=(c("#msg_"+t).html().length>0&&a?c("#msg_"+t).html()+"<br/>":"")+o,c("#msg_"+t).html(o)}window.hFlash=function(){c("#flashfilename").value=null,R.StartOTA()},window.handleReboot=function(t){"reboot_ota"==t?(c("#reboot_ota_nav").removeClass("active").prop("disabled",!0),ot(500,"","reboot_ota")):(c("#reboot_nav").removeClass("active"),ot(500,"",t))};var U,L="https://api.github.com/repos/sle118/squeezelite-esp32/releases",D=!1,F=!1,J="",H=0,W="MESSAGING_INFO",B={},Y=null,q="",z="Squeezelite-ESP32",V="",Z=z,K="",Q=z,X="",$="#cfg-audio-bt_source-sink_name",tt={},et={},nt="",at={CONN:0,MAN:1,STS:2};function st(t){var e={};c("input.nvs").each((function(n,a){if(t)e[a.id]=a.value;else{var s=parseInt(a.attributes.nvs_type.value,10);""!==a.id&&(e[a.id]={},e[a.id].value=s===m||s===b||s===g||s===v||s===S||s===_||s===y||s===w?parseInt(a.value):a.value,e[a.id].type=s)}}));var n=c("#nvs-new-key").val(),a=c("#nvs-new-value").val();return""!==n&&(t?e[n]=a:(e[n]={},e[n].value=a,e[n].type=33)),e}function ot(t,e){var n="/"+(arguments.length>2&&void 0!==arguments[2]?arguments[2]:"reboot")+".json";c("tbody#tasks").empty(),c("#tasks_sect").css("visibility","collapse"),h.resolve({cmdname:e,url:n}).delay(t).then((function(t){t.cmdname.length>0?j(t.cmdname,"MESSAGING_WARNING","System is rebooting.\n",!0):yt("System is rebooting.\n","MESSAGING_WARNING"),console.log("now triggering reboot"),c("button[onclick*='handleReboot']").addClass("rebooting"),c.ajax({url:t.url,dataType:"text",method:"POST",cache:!1,contentType:"application/json; charset=utf-8",data:JSON.stringify({timestamp:Date.now()}),error:P,complete:function(){console.log("reboot call completed"),h.resolve(t).delay(6e3).then((function(t){t.cmdname.length>0&&function(t){c("#toast_"+t).removeClass("table-success").removeClass("table-warning").removeClass("table-danger").addClass("table-success").removeClass("show"),c("#msg_"+t).html("")}(t.cmdname),St(),_t()}))}})}))}function it(t){return c(".upf").filter((function(){return c(this).text().toUpperCase()===t.toUpperCase()})).length>0&&(c("#splf").val(t).trigger("input"),!0)}function rt(t){return t>=-55?{label:"****",icon:"signal_wifi_statusbar_4_bar"}:t>=-60?{label:"***",icon:"network_wifi_3_bar"}:t>=-65?{label:"**",icon:"network_wifi_2_bar"}:t>=-70?{label:"*",icon:"network_wifi_1_bar"}:{label:".",icon:"signal_wifi_statusbar_null"}}function ct(){var t;(null===(t=tt)||void 0===t?void 0:t.urc)!==k.ETH&&(c.ajaxSetup({timeout:3e3}),c.getJSON("/scan.json",(0,a.Z)(i().mark((function t(){return i().wrap((function(t){for(;;)switch(t.prev=t.next){case 0:return t.next=2,Tt(2e3);case 2:c.getJSON("/ap.json",(function(t){t.length>0&&(t.sort((function(t,e){var n=t.rssi,a=e.rssi;return n<a?1:n>a?-1:0})),ut(t))}));case 3:case"end":return t.stop()}}),t)})))))}function lt(t,e,n){var a=rt(e),s={label:0==n?"🔓":"🔒",icon:0==n?"no_encryption":"lock"};return'<tr data-bs-toggle="modal" data-bs-target="#WifiConnectDialog"><td></td><td>'.concat(t,'</td><td>\n  <span class="material-icons" style="fill:white; display: inline" aria-label="').concat(a.label,'" icon="').concat(a.icon,'" >').concat(M(a),'</span>\n  \t</td><td>\n    <span class="material-icons" aria-label="').concat(s.label,'" icon="').concat(s.icon,'">').concat(M(s),"</span>\n  </td></tr>")}function ut(t){var e,n="";if(c("#wifiTable tr td:first-of-type").text(""),c("#wifiTable tr").removeClass("table-success table-warning"),t&&(t.forEach((function(t){n+=lt(t.ssid,t.rssi,t.auth)})),c("#wifiTable").html(n)),0==c(".manual_add").length&&(c("#wifiTable").append(lt("Manual add",0,0)),c("#wifiTable tr:last").addClass("table-light text-dark").addClass("manual_add")),!tt.ssid||tt.urc!==k.OK&&tt.urc!==k.RESTORE)(null===(e=tt)||void 0===e?void 0:e.urc)!==k.ETH&&c("span#foot-if").html("");else{var a,s='#wifiTable td:contains("'.concat(tt.ssid,'")');if(0==c(s).filter((function(){return c(this).text()===tt.ssid})).length)c("#wifiTable").prepend("".concat(lt(tt.ssid,null!==(a=tt.rssi)&&void 0!==a?a:0,0)));c(s).filter((function(){return c(this).text()===tt.ssid})).siblings().first().html("&check;").parent().addClass(tt.urc===k.OK?"table-success":"table-warning"),c("span#foot-if").html("SSID: <strong>".concat(tt.ssid,"</strong>, IP: <strong>").concat(tt.ip,"</strong>")),c("#wifiStsIcon").html(rt(tt.rssi))}}function dt(t){console.debug(this.toLocaleString()+"\t"+t.nme+"\t"+t.cpu+"\t"+N[t.st]+"\t"+t.minstk+"\t"+t.bprio+"\t"+t.cprio+"\t"+t.num),c("tbody#tasks").append('<tr class="table-primary"><th scope="row">'+t.num+"</th><td>"+t.nme+"</td><td>"+t.cpu+"</td><td>"+N[t.st]+"</td><td>"+t.minstk+"</td><td>"+t.bprio+"</td><td>"+t.cprio+"</td></tr>")}function ht(t){return c("".concat($," option:contains('").concat(t,"')"))}function ft(){c.ajaxSetup({timeout:C}),c.getJSON("/messages.json",function(){var t=(0,a.Z)(i().mark((function t(e){var n,a,s,o,r,u,d,h,f,p;return i().wrap((function(t){for(;;)switch(t.prev=t.next){case 0:n=l(e),t.prev=1,s=i().mark((function t(){var e,n;return i().wrap((function(t){for(;;)switch(t.prev=t.next){case 0:e=a.value,n=e.current_time-e.sent_time,(o=new Date).setTime(o.getTime()-n),t.t0=e.class,t.next="MESSAGING_CLASS_OTA"===t.t0?7:"MESSAGING_CLASS_STATS"===t.t0?9:"MESSAGING_CLASS_SYSTEM"===t.t0?14:"MESSAGING_CLASS_CFGCMD"===t.t0?16:"MESSAGING_CLASS_BT"===t.t0?19:23;break;case 7:return R.EventOTAMessageClass(e.message),t.abrupt("break",24);case 9:return r=JSON.parse(e.message),console.debug(o.toLocalShort()+" - Number of running tasks: "+r.ntasks),console.debug(o.toLocalShort()+"\tname\tcpu\tstate\tminstk\tbprio\tcprio\tnum"),r.tasks?("collapse"===c("#tasks_sect").css("visibility")&&c("#tasks_sect").css("visibility","visible"),c("tbody#tasks").html(""),r.tasks.sort((function(t,e){return e.cpu-t.cpu})).forEach(dt,o)):"visible"===c("#tasks_sect").css("visibility")&&(c("tbody#tasks").empty(),c("#tasks_sect").css("visibility","collapse")),t.abrupt("break",24);case 14:return wt(e,o),t.abrupt("break",24);case 16:return j((u=e.message.split(/([^\n]*)\n([\s\S]*)/g))[1],e.type,u[2],!0),t.abrupt("break",24);case 19:if(c("#cfg-audio-bt_source-sink_name").is("input")){for(d=c("#cfg-audio-bt_source-sink_name")[0].attributes,h="",f=0;f<d.length;f++)"type"!=d.item(f).name&&(h+="".concat(d.item(f).name,' = "').concat(d.item(f).value,'" '));p=c("#cfg-audio-bt_source-sink_name")[0].value,c("#cfg-audio-bt_source-sink_name").replaceWith('<select id="cfg-audio-bt_source-sink_name" '.concat(h,'><option value="').concat(p,'" data-bs-description="').concat(p,'">').concat(p,"</option></select> "))}return JSON.parse(e.message).forEach((function(t){ht(t.name).length>0||(c("#cfg-audio-bt_source-sink_name").append("<option>".concat(t.name,"</option>")),wt({type:e.type,message:"BT Audio device found: ".concat(t.name," RSSI: ").concat(t.rssi," ")},o)),ht(t.name).attr("data-bs-description","".concat(t.name," (").concat(t.rssi,"dB)")).attr("rssi",t.rssi).attr("value",t.name).text("".concat(t.name," [").concat(t.rssi,"dB]")).trigger("change")})),c($).append(c("".concat($," option")).remove().sort((function(t,e){return console.log("".concat(parseInt(c(t).attr("rssi"))," < ").concat(parseInt(c(e).attr("rssi"))," ? ")),parseInt(c(t).attr("rssi"))<parseInt(c(e).attr("rssi"))?1:-1}))),t.abrupt("break",24);case 23:return t.abrupt("break",24);case 24:case"end":return t.stop()}}),t)})),n.s();case 4:if((a=n.n()).done){t.next=8;break}return t.delegateYield(s(),"t0",6);case 6:t.next=4;break;case 8:t.next=13;break;case 10:t.prev=10,t.t1=t.catch(1),n.e(t.t1);case 13:return t.prev=13,n.f(),t.finish(13);case 16:setTimeout(ft,C);case 17:case"end":return t.stop()}}),t,null,[[1,10,13,16]])})));return function(e){return t.apply(this,arguments)}}()).fail((function(t,e,n){404==t.status?(c(".orec").hide(),F=!0):P(t,0,n),0==t.status&&0==t.readyState?setTimeout(ft,2*C):F||setTimeout(ft,C)}))}function pt(t){if(c("#WifiConnectDialog").is(":visible")){if(tt.ip&&c("#ipAddress").text(tt.ip),tt.ssid&&c("#connectedToSSID").text(tt.ssid),tt.gw&&c("#gateway").text(tt.gw),tt.netmask&&c("#netmask").text(tt.netmask),(void 0===et.Action||et.Action&&et.Action==at.STS)&&(c("*[class*='connecting']").hide(),c(".connecting-status").show()),B.ap_ssid&&c("#apName").text(B.ap_ssid.value),B.ap_pwd&&c("#apPass").text(B.ap_pwd.value),!t)return;switch(t.urc){case k.OK:t.ssid&&t.ssid===et.ssid&&(c("*[class*='connecting']").hide(),c(".connecting-success").show(),et.Action=at.STS);break;case k.FAIL:et.Action!=at.STS&&et.ssid==t.ssid&&(c("*[class*='connecting']").hide(),c(".connecting-fail").show());break;case k.LOST:break;case k.RESTORE:et.Action!=at.STS&&et.ssid!=t.ssid&&(c("*[class*='connecting']").hide(),c(".connecting-fail").show());case k.DISC:}}}function mt(t){c(".material-icons").each((function(e,n){n.textContent=n.attributes[t?"aria-label":"icon"].value}))}function bt(t){mt(!G()),!function(t){return t.urc!==tt.urc||t.ssid!==tt.ssid||t.gw!==tt.gw||t.netmask!==tt.netmask||t.ip!==tt.ip||t.rssi!==tt.rssi}(t)&&t.urc||(tt=t,c(".if_eth").hide(),c(".if_wifi").hide(),t.urc&&tt.urc==k.ETH?(c(".if_eth").show(),tt.urc===k.ETH&&c("span#foot-if").html("Network: Ethernet, IP: <strong>".concat(tt.ip,"</strong>"))):(c(".if_wifi").show(),ut())),pt(t)}function gt(){c.ajaxSetup({timeout:2e3}),c.getJSON("/status.json",(function(t){var e;if(function(t){var e;1===(null!==(e=t.recovery)&&void 0!==e?e:0)?(D=!0,c(".recovery_element").show(),c(".ota_element").hide(),c("#boot-button").html("Reboot"),c("#boot-form").attr("action","/reboot_ota.json")):(!D&&F&&(F=!1,setTimeout(ft,C)),D=!1,c(".recovery_element").hide(),c(".ota_element").show(),c("#boot-button").html("Recovery"),c("#boot-form").attr("action","/recovery.json"))}(t),f(),bt(t),function(t){var e="",n="";if(void 0!==t.bt_status&&void 0!==t.bt_sub_status){var a=A[t.bt_status].sub[t.bt_sub_status];a?(e=T[a],n=A[t.bt_status].desc):(e=T.bt_connected,n="Output status")}c("#o_type").attr("title",n),c("#o_bt").html(G()?e.label:e.text)}(t),R.EventTargetStatus(t),t.depth&&(16==t.depth?c("#cmd_opt_R").show():c("#cmd_opt_R").hide()),t.project_name&&""!==t.project_name&&(Z=t.project_name),t.platform_name&&""!==t.platform_name&&(Q=t.platform_name),""===K&&(K=Z),""===K&&(K="Squeezelite-ESP32"),t.version&&""!==t.version?(z=t.version,c("#navtitle").html("".concat(K).concat(D?"<br>[recovery]":"")),c("span#foot-fw").html("fw: <strong>".concat(z,"</strong>, mode: <strong>").concat(D?"Recovery":Z,"</strong>"))):c("span#flash-status").html(""),t.Voltage){var n=function(t){for(var e=0,n=E;e<n.length;e++){var a,s=n[e],o=l(s.ranges);try{for(o.s();!(a=o.n()).done;){var i=a.value;if(((r=t)-i.f)*(r-i.t)<=0)return{label:s.label,icon:s.icon}}}catch(t){o.e(t)}finally{o.f()}}var r;return{label:"▪▪▪▪",icon:"battery_full"}}(t.Voltage);c("#battery").html("".concat(M(n))),c("#battery").attr("aria-label",n.label),c("#battery").attr("icon",n.icon),c("#battery").show()}else c("#battery").hide();if(""!=(null!==(e=t.message)&&void 0!==e?e:"")&&V!=t.message&&(V=t.message,yt(t.message,"MESSAGING_INFO")),t.is_i2c_locked?c("flds-cfg-hw-preset").hide():c("flds-cfg-hw-preset").show(),c("button[onclick*='handleReboot']").removeClass("rebooting"),void 0===U||t.lms_ip!=nt&&t.lms_ip&&t.lms_port){var a="http://"+t.lms_ip+":"+t.lms_port;nt=t.lms_ip,c.ajax({url:a+"/plugins/SqueezeESP32/firmware/-check.bin",type:"HEAD",dataType:"text",cache:!1,error:function(){U=""},success:function(){U=a}})}c("#o_jack").css({display:Number(t.Jack)?"inline":"none"}),setTimeout(gt,2e3)})).fail((function(t,e,n){P(t,0,n),0==t.status&&0==t.readyState?setTimeout(gt,2*C):setTimeout(gt,C)}))}function vt(t,e,n){return void 0!==t.values[e]?t.values[e][n]:""}function St(){c.ajaxSetup({timeout:7e3}),c.getJSON("/commands.json",(function(t){console.log(t),c(".orec").show(),t.commands.forEach((function(e){if(0===c("#flds-"+e.name).length){var n=e.name.split("-"),a="cfg"===n[0],s="#tab-"+n[0]+"-"+n[1],o="";o+='<div class="card mb-3"><div class="card-header">'.concat(e.help.encodeHTML().replace(/\n/g,"<br />"),'</div><div class="card-body"><fieldset id="flds-').concat(e.name,'">'),e.argtable&&e.argtable.forEach((function(n){var a=n.datatype||"",s=e.name+"-"+n.longopts,i=vt(t,e.name,n.longopts),r="hasvalue="+n.hasvalue+" ";r+='longopts="'+n.longopts+'" ',r+='shortopts="'+n.shortopts+'" ',r+="checkbox="+n.checkbox+" ",r+='cmdname="'+e.name+'" ',r+='id="'+s+'" name="'+s+'" ',n.longopts&&n.longopts.startsWith("_")&&(r+="readonly ");var c=n.mincount>0?"is-invalid":"";"hidden"===n.glossary&&(r+=' style="visibility: hidden;"'),n.checkbox?o+='<div class="form-check"><label class="form-check-label"><input type="checkbox" '.concat(r,' class="form-check-input ').concat(c,'" value="" >').concat(n.glossary.encodeHTML(),"</label></div><div>"):n.remark?o+='<div class="form-group"><label>'.concat(n.glossary.encodeHTML(),"</label>"):(o+='<div class="form-group" ><label for="'.concat(s,'">').concat(n.glossary.encodeHTML(),"</label>"),a.includes("|")?(c=a.startsWith("+")?" multiple ":"",a=a.replace("<","").replace("=","").replace(">",""),o+="<select ".concat(r,' class="form-control ').concat(c,'" >'),(a="--|"+a).split("|").forEach((function(t){o+="<option >"+t+"</option>"})),o+="</select>"):o+='<input type="text" class="form-control '.concat(c,'" placeholder="').concat(a,'" ').concat(r,">")),n.remark||(o+='<small class="form-text text-muted">Previous value: '.concat(n.checkbox?i?"Checked":"Unchecked":i||"","</small>")),o+="</div>"})),o+='<div style="margin-top: 16px;">\n        <div class="toast hide" role="alert" aria-live="assertive" aria-atomic="true" id="toast_'.concat(e.name,'">\n        <div class="toast-header">\n        <strong class="mr-auto">Result</strong\n          <button type="button" class="btn-close" data-bs-dismiss="toast" aria-label="Close"></button>\n        </div>\n        <div class="toast-body" id="msg_').concat(e.name,'"></div>\n      </div>'),o+=a?'<button type="submit" class="btn btn-info sclk" id="btn-save-'.concat(e.name,'" cmdname="').concat(e.name,'">Save</button>\n<button type="submit" class="btn btn-warning cclk" id="btn-commit-').concat(e.name,'" cmdname="').concat(e.name,'">Apply</button>'):'<button type="submit" class="btn btn-success sclk" id="btn-run-'.concat(e.name,'" cmdname="').concat(e.name,'">Execute</button>'),o+="</div></fieldset></div></div>",a?c(s).append(o):c("#commands-list").append(o)}})),c(".sclk").off("click").on("click",(function(){runCommand(this,!1)})),c(".cclk").off("click").on("click",(function(){runCommand(this,!0)})),t.commands.forEach((function(e){c("[cmdname="+e.name+"]:input").val(""),c("[cmdname="+e.name+"]:checkbox").prop("checked",!1),e.argtable&&e.argtable.forEach((function(n){var a="#"+e.name+"-"+n.longopts,s=vt(t,e.name,n.longopts);n.checkbox?c(a)[0].checked=s:n.remark||(void 0!==s&&(c(a).val(s).trigger("change"),n.mincount&&n.mincount>0&&(c(a).removeClass("is-invalid"),c(a).addClass("is-valid"))),0===c(a)[0].value.length&&(n.datatype||"").includes("|")&&(c(a)[0].value="--"))}))})),0!=c("#cfg-hw-preset-model_config").length&&(x||(x=!0,c("#cfg-hw-preset-model_config").html("<option>--</option>"),c.getJSON("https://gist.githubusercontent.com/sle118/dae585e157b733a639c12dc70f0910c5/raw/",{_:(new Date).getTime()},(function(t){c.each(t,(function(t,e){c("#cfg-hw-preset-model_config").append("<option value='".concat(JSON.stringify(e).replace(/"/g,'"').replace(/\'/g,'"'),"'>").concat(e.name,"</option>")),""!==X&&X==e.name&&c("#cfg-hw-preset-model_config").val(X)})),""!==X&&"#prev_preset".show().val(X)})).fail((function(t,e,n){var a=e+", "+n;console.log("Request Failed: "+a)}))))})).fail((function(t,e,n){404==t.status?c(".orec").hide():P(t,0,n),c("#commands-list").empty()}))}function _t(){c.ajaxSetup({timeout:7e3}),c.getJSON("/config.json",(function(t){c("#nvsTable tr").remove();var e=t.config?t.config:t;B=e,J="",Object.keys(e).sort().forEach((function(t){var n=e[t].value;"autoexec"===t||("host_name"===t?(n=n.replaceAll('"',""),c("input#dhcp-name1").val(n),c("input#dhcp-name2").val(n),0==c("#cmd_opt_n").length&&c("#cmd_opt_n").val(n),document.title=n,q=n):"rel_api"===t?L=n:"enable_airplay"===t?c("#s_airplay").css({display:p(n)?"inline":"none"}):"enable_cspot"===t?c("#s_cspot").css({display:p(n)?"inline":"none"}):"preset_name"==t?X=n:"board_model"==t&&(K=n)),c("tbody#nvsTable").append("<tr><td>"+t+"</td><td class='value'><input type='text' class='form-control nvs' id='"+t+"'  nvs_type="+e[t].type+" ></td></tr>"),c("input#"+t).val(e[t].value)})),J.length>0&&c("#cfg-audio-bt_source-sink_name").val(J),c("tbody#nvsTable").append("<tr><td><input type='text' class='form-control' id='nvs-new-key' placeholder='new key'></td><td><input type='text' class='form-control' id='nvs-new-value' placeholder='new value' nvs_type=33 ></td></tr>"),t.gpio?(c("#pins").show(),c("tbody#gpiotable tr").remove(),t.gpio.forEach((function(t){c("tbody#gpiotable").append("<tr class="+(t.fixed?"table-secondary":"table-primary")+'><th scope="row">'+t.group+"</th><td>"+t.name+"</td><td>"+t.gpio+"</td><td>"+(t.fixed?"Fixed":"Configuration")+"</td></tr>")}))):c("#pins").hide()})).fail((function(t,e,n){P(t,0,n)}))}function yt(t,e){wt({message:t,type:e},new Date)}function wt(t,e){var n="table-success";"MESSAGING_WARNING"===t.type?(n="table-warning","MESSAGING_INFO"===W&&(W="MESSAGING_WARNING")):"MESSAGING_ERROR"===t.type&&("MESSAGING_INFO"!==W&&"MESSAGING_WARNING"!==W||(W="MESSAGING_ERROR"),n="table-danger"),++H>0&&(c("#msgcnt").removeClass("badge-success"),c("#msgcnt").removeClass("badge-warning"),c("#msgcnt").removeClass("badge-danger"),c("#msgcnt").addClass(O[W]),c("#msgcnt").text(H)),c("#syslogTable").append("<tr class='"+n+"'><td>"+e.toLocalShort()+"</td><td>"+t.message.encodeHTML()+"</td></tr>")}function Tt(t){return new h((function(e){return setTimeout(e,t)}))}h.prototype.delay=function(t){return this.then((function(e){return new h((function(n){setTimeout((function(){n(e)}),t)}))}),(function(e){return new h((function(n,a){setTimeout((function(){a(e)}),t)}))}))},window.handleDisconnect=function(){c.ajax({url:"/connect.json",dataType:"text",method:"DELETE",cache:!1,contentType:"application/json; charset=utf-8",data:JSON.stringify({timestamp:Date.now()})})},window.handleConnect=function(){et.ssid=c("#manual_ssid").val(),et.pwd=c("#manual_pwd").val(),et.dhcpname=c("#dhcp-name2").val(),c("*[class*='connecting']").hide(),c("#ssid-wait").text(et.ssid),c(".connecting").show(),c.ajax({url:"/connect.json",dataType:"text",method:"POST",cache:!1,contentType:"application/json; charset=utf-8",data:JSON.stringify({timestamp:Date.now(),ssid:et.ssid,pwd:et.pwd}),error:P})},c(document).ready((function(){c(".material-icons").each((function(t,e){e.attributes.icon=e.textContent})),mt(!0),f(),R.init(),c("#fw-url-input").on("input",(function(){c(this).val().length>8&&(c(this).val().startsWith("http://")||c(this).val().startsWith("https://"))?c("#start-flash").show():c("#start-flash").hide()})),c(".upSrch").on("input",(function(){var t=this.value;c("#rTable tr").removeClass(this.id+"_hide"),t.length>0&&c("#rTable td:nth-child(".concat(c(this).parent().index()+1,")")).filter((function(){return!c(this).text().toUpperCase().includes(t.toUpperCase())})).parent().addClass(this.id+"_hide"),c('[class*="_hide"]').hide(),c("#rTable tr").not('[class*="_hide"]').show()})),setTimeout(ct,1500),c("#WifiConnectDialog")[0].addEventListener("shown.bs.modal",(function(t){c("*[class*='connecting']").hide(),null!=t&&t.relatedTarget&&(et.Action=at.CONN,c(t.relatedTarget).children("td:eq(1)").text()==tt.ssid?et.Action=at.STS:c(t.relatedTarget).is(":last-child")?(et.Action=at.MAN,et.ssid="",c("#manual_ssid").val(et.ssid)):(et.ssid=c(t.relatedTarget).children("td:eq(1)").text(),c("#manual_ssid").val(et.ssid))),et.Action!==at.STS?(c(".connecting-init").show(),c("#manual_ssid").trigger("focus")):pt()})),c("#WifiConnectDialog")[0].addEventListener("hidden.bs.modal",(function(){c("#WifiConnectDialog input").val("")})),c("#uCnfrm")[0].addEventListener("shown.bs.modal",(function(){c("#selectedFWURL").text(c("#fw-url-input").val())})),c("input#show-commands")[0].checked=1===Y,c('a[href^="#tab-commands"]').hide(),c("#load-nvs").on("click",(function(){c("#nvsfilename").trigger("click")})),c("#nvsfilename").on("change",(function(){if("function"!=typeof window.FileReader)throw"The file API isn't supported on this browser.";if(!this.files)throw"This browser does not support the `files` property of the file input.";if(this.files[0]){var t=this.files[0],e=new FileReader;e.onload=function(t){var e={};try{e=JSON.parse(t.target.result)}catch(t){alert("Parsing failed!\r\n "+t)}c("input.nvs").each((function(t,n){c(this).parent().removeClass("bg-warning").removeClass("bg-success"),e[n.id]&&(e[n.id]!==n.value?(console.log("Changed "+n.id+" "+n.value+"==>"+e[n.id]),c(this).parent().addClass("bg-warning"),c(this).val(e[n.id])):c(this).parent().addClass("bg-success"))})),c("input.nvs").children(".bg-warning")&&alert("Highlighted values were changed. Press Commit to change on the device")},e.readAsText(t),this.value=null}})),c("#clear-syslog").on("click",(function(){H=0,W="MESSAGING_INFO",c("#msgcnt").text(""),c("#syslogTable").html("")})),c("#ok-credits").on("click",(function(){c("#credits").slideUp("fast",(function(){})),c("#app").slideDown("fast",(function(){}))})),c("#acredits").on("click",(function(t){t.preventDefault(),c("#app").slideUp("fast",(function(){})),c("#credits").slideDown("fast",(function(){}))})),c("input#show-commands").on("click",(function(){this.checked=this.checked?1:0,this.checked?(c('a[href^="#tab-commands"]').show(),Y=1):(Y=0,c('a[href^="#tab-commands"]').hide())})),c("input#show-nvs").on("click",(function(){this.checked=this.checked?1:0,r.Z.set("show-nvs",this.checked?"Y":"N"),f()})),c("#btn_reboot_recovery").on("click",(function(){handleReboot("recovery")})),c("#btn_reboot").on("click",(function(){handleReboot("reboot")})),c("#btn_flash").on("click",(function(){hFlash()})),c("#btn_disconnect").on("click",(function(){tt={},ut(),c.ajax({url:"/connect.json",dataType:"text",method:"DELETE",cache:!1,contentType:"application/json; charset=utf-8",data:JSON.stringify({timestamp:Date.now()})})})),c("#btnJoin").on("click",(function(){handleConnect()})),c("#reboot_nav").on("click",(function(){handleReboot("reboot")})),c("#reboot_ota_nav").on("click",(function(){handleReboot("reboot_ota")})),c("#save-as-nvs").on("click",(function(){var t=st(!0),e=document.createElement("a");e.href=URL.createObjectURL(new Blob([JSON.stringify(t,null,2)],{type:"text/plain"})),e.setAttribute("download","nvs_config_"+q+"_"+Date.now()+"json"),document.body.appendChild(e),e.click(),document.body.removeChild(e)})),c("#save-nvs").on("click",(function(){I(st(!1))})),c("#fwUpload").on("click",(function(){0===document.getElementById("flashfilename").files.length?alert("No file selected!"):(c("#fw-url-input").value=null,R.StartOTA())})),c("#chkUpdates").on("click",(function(){c("#rTable").html(""),c.getJSON(L,(function(t){var e=[];t.forEach((function(t){var n=t.name.split("#")[3];e.includes(n)||e.push(n)}));var n="";e.forEach((function(t){n+='<option value="'+t+'">'+t+"</option>"})),c("#fwbranch").append(n),t.forEach((function(t){var e="";t.assets.forEach((function(t){t.name.match(/\.bin$/)&&(e=t.browser_download_url)}));var n=t.name.split("#"),a=n[0],s=n[2],o=n[3],i=a.substr(a.lastIndexOf("-")+1);i="32"==i||"16"==i?i:"";var r=t.body;r=(r=(r=r.replace(/'/gi,'"')).replace(/[\s\S]+(### Revision Log[\s\S]+)### ESP-IDF Version Used[\s\S]+/,"$1")).replace(/- \(.+?\) /g,"- ").encodeHTML(),c("#rTable").append("<tr class='release ' fwurl='".concat(e,"'>\n        <td data-bs-toggle='tooltip' title='").concat(r,"'>").concat(a,"</td><td>").concat(new Date(t.created_at).toLocalShort(),"\n        </td><td class='upf'>").concat(s,"</td><td>").concat(o,"</td><td>").concat(i,"</td></tr>"))})),c("#searchfw").css("display","inline"),it(Q)||it(Z),c("#rTable tr.release").on("click",(function(){var t=this.attributes.fwurl.value;U&&(t=t.replace(/.*\/download\//,U+"/plugins/SqueezeESP32/firmware/")),c("#fw-url-input").val(t),c("#start-flash").show(),c("#rTable tr.release").removeClass("table-success table-warning"),c(this).addClass("table-success table-warning")}))})).fail((function(){alert("failed to fetch release history!")}))})),c("#fwcheck").on("click",(function(){c("#releaseTable").html(""),c("#fwbranch").empty(),c.getJSON(L,(function(t){var e,n=0,a=[];t.forEach((function(t){var e=t.name.split("#")[3];a.includes(e)||a.push(e)})),a.forEach((function(t){e+='<option value="'+t+'">'+t+"</option>"})),c("#fwbranch").append(e),t.forEach((function(t){var e="";t.assets.forEach((function(t){t.name.match(/\.bin$/)&&(e=t.browser_download_url)}));var a=t.name.split("#"),s=a[0],o=a[1],i=a[2],r=a[3],l=t.body;l=(l=(l=l.replace(/'/gi,'"')).replace(/[\s\S]+(### Revision Log[\s\S]+)### ESP-IDF Version Used[\s\S]+/,"$1")).replace(/- \(.+?\) /g,"- ");var u=n++>6?" hide":"";c("#releaseTable").append("<tr class='release"+u+"'><td data-bs-toggle='tooltip' title='"+l+"'>"+s+"</td><td>"+new Date(t.created_at).toLocalShort()+"</td><td>"+i+"</td><td>"+o+"</td><td>"+r+"</td><td><input type='button' class='btn btn-success' value='Select' data-bs-url='"+e+"' onclick='setURL(this);' /></td></tr>")})),n>7&&(c("#releaseTable").append("<tr id='showall'><td colspan='6'><input type='button' id='showallbutton' class='btn btn-info' value='Show older releases' /></td></tr>"),c("#showallbutton").on("click",(function(){c("tr.hide").removeClass("hide"),c("tr#showall").addClass("hide")}))),c("#searchfw").css("display","inline")})).fail((function(){alert("failed to fetch release history!")}))})),c("#updateAP").on("click",(function(){ct(),console.log("refresh AP")})),_t(),St(),ft(),gt()})),window.setURL=function(t){var e=t.dataset.url;c('[data-bs-url^="http"]').addClass("btn-success").removeClass("btn-danger"),c('[data-bs-url="'+e+'"]').addClass("btn-danger").removeClass("btn-success"),U&&(e=e.replace(/.*\/download\//,U+"/plugins/SqueezeESP32/firmware/")),c("#fwurl").val(e)},window.runCommand=function(t,e){var n=t.attributes.cmdname.value;j(t.attributes.cmdname.value,"MESSAGING_INFO","Executing.",!1);var a=document.getElementById("flds-"+n),o=null==a?void 0:a.querySelectorAll("select,input");if("cfg-hw-preset"===n)return function(t,e){var n=JSON.parse(t[0].value),a=t[0].attributes.cmdname.value;console.log("selected model: ".concat(n.name));for(var o={timestamp:Date.now(),config:{model_config:{value:n.name,type:33}}},i=0,r=Object.entries(n.config);i<r.length;i++){var l=(0,s.Z)(r[i],2),u=l[0],d=l[1],h="string"==typeof d||d instanceof String?d:JSON.stringify(d);o.config[u]={value:h,type:33},j(a,"MESSAGING_INFO","Setting ".concat(u,"=").concat(h," "),!0)}j(a,"MESSAGING_INFO","Committing ",!0),c.ajax({url:"/config.json",dataType:"text",method:"POST",cache:!1,contentType:"application/json; charset=utf-8",data:JSON.stringify(o),error:function(t,e,n){P(t,0,n),j(a,"MESSAGING_ERROR","Unexpected error ".concat(""!==n?n:"with return status = "+t.status," "),!0)},success:function(t){j(a,"MESSAGING_INFO","Saving complete ",!0),console.log(t),e&&ot(2500,a)}})}(o,e);if(n+=" ",a){var i,r=l(o);try{for(r.s();!(i=r.n()).done;){var u,d=i.value,h="",f="",p=d.attributes,m=c(d).is("select"),b="true"===(null==p||null===(u=p.hasvalue)||void 0===u?void 0:u.value),g=m&&"--"!==d.value||!m&&""!==d.value;if(!b||b&&g){var v,S,_,y;if("undefined"!==(null==p||null===(v=p.longopts)||void 0===v?void 0:v.value))f+="--"+(null==p||null===(y=p.longopts)||void 0===y?void 0:y.value);else"undefined"!==(null==p||null===(S=p.shortopts)||void 0===S?void 0:S.value)&&(f="-"+p.shortopts.value);"true"===(null==p||null===(_=p.hasvalue)||void 0===_?void 0:_.value)?""!==(null==p?void 0:p.value)&&(n+=f+" "+(h=/\s/.test(d.value)?'"':"")+d.value+h+" "):null!=d&&d.checked&&(n+=f+" ")}}}catch(t){r.e(t)}finally{r.f()}}console.log(n);var w={timestamp:Date.now()};w.command=n,c.ajax({url:"/commands.json",dataType:"text",method:"POST",cache:!1,contentType:"application/json; charset=utf-8",data:JSON.stringify(w),error:function(t,e,n){var a=JSON.parse(this.data).command;404==t.status?j(a.substr(0,a.indexOf(" ")),"MESSAGING_ERROR","".concat(D?"Limited recovery mode active. Unsupported action ":"Unexpected error while processing command"),!0):(P(t,0,n),j(a.substr(0,a.indexOf(" ")-1),"MESSAGING_ERROR","Unexpected error ".concat(""!==n?n:"with return status = "+t.status),!0))},success:function(n){c(".orec").show(),console.log(n),"Success"===JSON.parse(n).Result&&e&&ot(2500,t.attributes.cmdname.value)}})}},393:(t,e,n)=>{n.r(e)},607:(t,e,n)=>{n(138),n(393),n(861),n(322)},861:t=>{t.exports="data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAACAAAAAgCAMAAABEpIrGAAAAb1BMVEXIycuswsKMjI4rqqZyc3RQlpQ6jIEmJifW2dq5ursppJ8Om4zC0NAFdGYmmpb///8Hg3O4x8cHkoEggX0jko5Ks6/P0dM5r6ocoZb3+PgiiYVevrp/y8bg4uOS09FtxMDs7+7M6um529qoysik2tiNn72gAAAAF3RSTlP94Fr/Wf39BP26/////////////////kibhL0AAAGjSURBVDjLbZMJkoMgEEWtmETEJWpkiSC45P5nnF4wk7HmW2jLfzYIdFYUxbXUYp5nIbTOUFoLAR2ivIKZFQXYuu6TahSHmdAlAqWub0/QNI1jSxrHacKeWw9EdtH1xHbbyiRgCJn67JqVAr9nO2fJnBDMoUuYEvsfmxnJBM66Zj8/iYmaAPKlOvRNJAC/fz8OefINEAngAbYPEMiHTJCCAZrACciVMpCCgDEBKwsAowymMO3IAP3Btqa5vYJx0ZlcOSUZaE/AWznvnTHOyfZ/wMUQvAIg/wb27QNEH94BgGj+APsZiF8AXAhQQEMwkIYYLW7xvsENoyUoF0I0ysf0F2O743kDQNXzXM8+j8Eb6byzDEz7gtpsO1PgrXG5Nd6btNTP+YXarKTny1uQ9JiAN6vbqT9au+BzMQjAWtlq6BiYttdjiVVVqfXxWFWFkk6Cz0DTdYOFPmpHAAK/YQCJoTppQJ8A3TAxVAAhR439Bg5tKe7NgSDEje3mDsf+ovuGCUbYZb/BwoHS6ykHMYfo/U6lx8Xb/+qo3U/x/lf+VP9c/j9c3zy20WEMxgAAAABJRU5ErkJggg=="}},n={};function a(t){var s=n[t];if(void 0!==s)return s.exports;var o=n[t]={id:t,loaded:!1,exports:{}};return e[t].call(o.exports,o,o.exports,a),o.loaded=!0,o.exports}a.m=e,t=[],a.O=(e,n,s,o)=>{if(!n){var i=1/0;for(u=0;u<t.length;u++){for(var[n,s,o]=t[u],r=!0,c=0;c<n.length;c++)(!1&o||i>=o)&&Object.keys(a.O).every((t=>a.O[t](n[c])))?n.splice(c--,1):(r=!1,o<i&&(i=o));if(r){t.splice(u--,1);var l=s();void 0!==l&&(e=l)}}return e}o=o||0;for(var u=t.length;u>0&&t[u-1][2]>o;u--)t[u]=t[u-1];t[u]=[n,s,o]},a.n=t=>{var e=t&&t.__esModule?()=>t.default:()=>t;return a.d(e,{a:e}),e},a.d=(t,e)=>{for(var n in e)a.o(e,n)&&!a.o(t,n)&&Object.defineProperty(t,n,{enumerable:!0,get:e[n]})},a.g=function(){if("object"==typeof globalThis)return globalThis;try{return this||new Function("return this")()}catch(t){if("object"==typeof window)return window}}(),a.o=(t,e)=>Object.prototype.hasOwnProperty.call(t,e),a.r=t=>{"undefined"!=typeof Symbol&&Symbol.toStringTag&&Object.defineProperty(t,Symbol.toStringTag,{value:"Module"}),Object.defineProperty(t,"__esModule",{value:!0})},a.nmd=t=>(t.paths=[],t.children||(t.children=[]),t),(()=>{var t={826:0};a.O.j=e=>0===t[e];var e=(e,n)=>{var s,o,[i,r,c]=n,l=0;if(i.some((e=>0!==t[e]))){for(s in r)a.o(r,s)&&(a.m[s]=r[s]);if(c)var u=c(a)}for(e&&e(n);l<i.length;l++)o=i[l],a.o(t,o)&&t[o]&&t[o][0](),t[o]=0;return a.O(u)},n=self.webpackChunksqueezelite_esp32=self.webpackChunksqueezelite_esp32||[];n.forEach(e.bind(null,0)),n.push=e.bind(null,n.push.bind(n))})();var s=a.O(void 0,[987],(()=>a(607)));s=a.O(s)})();
-//# sourceMappingURL=index.27f381.bundle.js.map
\ No newline at end of file
@@ -1174,8 +1174,10 @@ $(document).ready(function () {
   // first time the page loads: attempt to get the connection status and start the wifi scan
   getConfig();
   getCommands();
-  getMessages();
-  checkStatus();
+  if (!startEvents()) {
+    getMessages();
+    checkStatus();
+  }
 
 });
 
@@ -1322,11 +1324,7 @@ function btExists(name) {
 function getBTSinkOpt(name) {
   return $(`${btSinkNamesOptSel} option:contains('${name}')`);
 }
-function getMessages() {
-  $.ajaxSetup({
-    timeout: messageInterval //Time in milliseconds
-  });
-  $.getJSON('/messages.json', async function (data) {
+function handleMessages(data) {
     for (const msg of data) {
       const msgAge = msg.current_time - msg.sent_time;
       var msgTime = new Date();
@@ -1409,6 +1407,13 @@ function getMessages() {
           break;
       }
     }
+}
+function getMessages() {
+  $.ajaxSetup({
+    timeout: messageInterval //Time in milliseconds
+  });
+  $.getJSON('/messages.json', function (data) {
+    handleMessages(data);
     setTimeout(getMessages, messageInterval);
   }).fail(function (xhr, ajaxOptions, thrownError) {
 
@@ -1586,11 +1591,7 @@ function batteryToIcon(voltage) {
 
   return { label: '▪▪▪▪', icon: "battery_full" };
 }
-function checkStatus() {
-  $.ajaxSetup({
-    timeout: statusInterval //Time in milliseconds
-  });
-  $.getJSON('/status.json', function (data) {
+function handleStatus(data) {
     handleRecoveryMode(data);
     handleNVSVisible();
     handleNetworkStatus(data);
@@ -1663,6 +1664,13 @@ function checkStatus() {
       });
     }
     $('#o_jack').css({ display: Number(data.Jack) ? 'inline' : 'none' });
+}
+function checkStatus() {
+  $.ajaxSetup({
+    timeout: statusInterval //Time in milliseconds
+  });
+  $.getJSON('/status.json', function (data) {
+    handleStatus(data);
     setTimeout(checkStatus, statusInterval);
   }).fail(function (xhr, ajaxOptions, thrownError) {
     handleExceptionResponse(xhr, ajaxOptions, thrownError);
@@ -1675,6 +1683,26 @@ function checkStatus() {
     }
   });
 }
+// status and messages are pushed by the target when it supports it, otherwise we poll
+function startEvents() {
+  if (!window.EventSource) return false;
+  const events = new EventSource('/events');
+  events.addEventListener('status', function (e) {
+    handleStatus(JSON.parse(e.data));
+  });
+  events.addEventListener('messages', function (e) {
+    handleMessages(JSON.parse(e.data));
+  });
+  events.onerror = function () {
+    // browser reconnects by itself unless the target refused (e.g. older recovery)
+    if (events.readyState === EventSource.CLOSED) {
+      events.close();
+      getMessages();
+      checkStatus();
+    }
+  };
+  return true;
+}
 // eslint-disable-next-line no-unused-vars
 window.runCommand = function (button, reboot) {
   let cmdstring = button.attributes.cmdname.value;
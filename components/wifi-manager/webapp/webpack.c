@@ -6,29 +6,36 @@ extern const uint8_t _favicon_32x32_png_start[] asm("_binary_favicon_32x32_png_s
 extern const uint8_t _favicon_32x32_png_end[] asm("_binary_favicon_32x32_png_end");
 extern const uint8_t _index_html_gz_start[] asm("_binary_index_html_gz_start");
 extern const uint8_t _index_html_gz_end[] asm("_binary_index_html_gz_end");
-extern const uint8_t _index_27f381_bundle_js_gz_start[] asm("_binary_index_27f381_bundle_js_gz_start");
-extern const uint8_t _index_27f381_bundle_js_gz_end[] asm("_binary_index_27f381_bundle_js_gz_end");
-extern const uint8_t _node_vendors_27f381_bundle_js_gz_start[] asm("_binary_node_vendors_27f381_bundle_js_gz_start");
-extern const uint8_t _node_vendors_27f381_bundle_js_gz_end[] asm("_binary_node_vendors_27f381_bundle_js_gz_end");
+extern const uint8_t _index_23a1d7_bundle_js_gz_start[] asm("_binary_index_23a1d7_bundle_js_gz_start");
+extern const uint8_t _index_23a1d7_bundle_js_gz_end[] asm("_binary_index_23a1d7_bundle_js_gz_end");
+extern const uint8_t _node_vendors_23a1d7_bundle_js_gz_start[] asm("_binary_node_vendors_23a1d7_bundle_js_gz_start");
+extern const uint8_t _node_vendors_23a1d7_bundle_js_gz_end[] asm("_binary_node_vendors_23a1d7_bundle_js_gz_end");
 const char * resource_lookups[] = {
 	"/css/index.79b066409aae272d620d.css.gz",
 	"/favicon-32x32.png",
 	"/index.html.gz",
-	"/js/index.27f381.bundle.js.gz",
-	"/js/node_vendors.27f381.bundle.js.gz",
+	"/js/index.23a1d7.bundle.js.gz",
+	"/js/node_vendors.23a1d7.bundle.js.gz",
 ""
 };
 const uint8_t * resource_map_start[] = {
 	_index_79b066409aae272d620d_css_gz_start,
 	_favicon_32x32_png_start,
 	_index_html_gz_start,
-	_index_27f381_bundle_js_gz_start,
-	_node_vendors_27f381_bundle_js_gz_start
+	_index_23a1d7_bundle_js_gz_start,
+	_node_vendors_23a1d7_bundle_js_gz_start
 };
 const uint8_t * resource_map_end[] = {
 	_index_79b066409aae272d620d_css_gz_end,
 	_favicon_32x32_png_end,
 	_index_html_gz_end,
-	_index_27f381_bundle_js_gz_end,
-	_node_vendors_27f381_bundle_js_gz_end
+	_index_23a1d7_bundle_js_gz_end,
+	_node_vendors_23a1d7_bundle_js_gz_end
+};
+const char * resource_etags[] = {
+	"\"500347bf1c66a545\"",
+	"\"4a056287ad0d7309\"",
+	"\"19abb69ee75274b8\"",
+	"\"fa52468a3aec801c\"",
+	"\"8b0a32917a9f3941\""
 };
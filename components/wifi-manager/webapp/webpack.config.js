@@ -17,6 +17,7 @@ const { merge } = require('webpack-merge');
 const devserver = require('./webpack/webpack.dev.js');
 const fs = require('fs');
 const zlib = require("zlib");
+const crypto = require('crypto');
 const PurgeCSSPlugin = require('purgecss-webpack-plugin')
 const whitelister = require('purgecss-whitelister');
 
@@ -295,12 +296,14 @@ ${arguments[1]}
 #include <inttypes.h>
 extern const char * resource_lookups[];
 extern const uint8_t * resource_map_start[];
-extern const uint8_t * resource_map_end[];`;
+extern const uint8_t * resource_map_end[];
+extern const char * resource_etags[];`;
                 let exportDef = '// Automatically generated. Do not edit manually!.\n' +
                   '#include <inttypes.h>\n';
                 let lookupDef = 'const char * resource_lookups[] = {\n';
                 let lookupMapStart = 'const uint8_t * resource_map_start[] = {\n';
                 let lookupMapEnd = 'const uint8_t * resource_map_end[] = {\n';
+                let lookupEtags = 'const char * resource_etags[] = {\n';
                 let cMake='';
                 
                 list.forEach(foundFile => {
@@ -312,6 +315,9 @@ extern const uint8_t * resource_map_end[];`;
                   lookupDef += `\t"${httpRelativePath}",\n`;
                   lookupMapStart += '\t_' + exportName + '_start,\n';
                   lookupMapEnd += '\t_' + exportName + '_end,\n';
+                  // content hash, served as a strong ETag for conditional requests
+                  let etag = crypto.createHash('sha256').update(fs.readFileSync(foundFile)).digest('hex').substring(0, 16);
+                  lookupEtags += `\t"\\"${etag}\\"",\n`;
                   cMake += `target_add_binary_data( __idf_wifi-manager ${cmakeFileName} BINARY)\n`;
                   console.log(`Post build: adding cmake file reference to ${cmakeFileName} from C project, with web path ${httpRelativePath}.`);
                 });
@@ -319,9 +325,10 @@ extern const uint8_t * resource_map_end[];`;
                 lookupDef += '""\n};\n';
                 lookupMapStart = lookupMapStart.substring(0, lookupMapStart.length - 2) + '\n};\n';
                 lookupMapEnd = lookupMapEnd.substring(0, lookupMapEnd.length - 2) + '\n};\n';
+                lookupEtags = lookupEtags.substring(0, lookupEtags.length - 2) + '\n};\n';
                 try {
                   fs.writeFileSync('webapp.cmake', cMake);
-                  fs.writeFileSync('webpack.c', exportDef + lookupDef + lookupMapStart + lookupMapEnd);
+                  fs.writeFileSync('webpack.c', exportDef + lookupDef + lookupMapStart + lookupMapEnd + lookupEtags);
                   fs.writeFileSync('webpack.h', exportDefHead);
                   //file written successfully
                 } catch (e) {
@@ -1,9 +1,10 @@
 /***********************************
 webpack_headers
-dist/css/index.79b066409aae272d620d.css.gz,dist/favicon-32x32.png,dist/index.html.gz,dist/js/index.27f381.bundle.js.gz,dist/js/node_vendors.27f381.bundle.js.gz
+dist/css/index.79b066409aae272d620d.css.gz,dist/favicon-32x32.png,dist/index.html.gz,dist/js/index.23a1d7.bundle.js.gz,dist/js/node_vendors.23a1d7.bundle.js.gz
 ***********************************/
 #pragma once
 #include <inttypes.h>
 extern const char * resource_lookups[];
 extern const uint8_t * resource_map_start[];
-extern const uint8_t * resource_map_end[];
\ No newline at end of file
+extern const uint8_t * resource_map_end[];
+extern const char * resource_etags[];
\ No newline at end of file
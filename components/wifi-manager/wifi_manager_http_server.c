@@ -23,6 +23,7 @@
  */
 
 #include "http_server_handlers.h"
+#include "http_server_events.h"
 #include "esp_log.h"
 #include "esp_http_server.h"
 #include <inttypes.h>
@@ -35,12 +36,13 @@
 #include "platform_esp32.h"
 #include "trace.h"
 #include "tools.h"
+#include "scheduler.h"
 static const char TAG[] = "http_server";
 
 EXT_RAM_ATTR static httpd_handle_t _server;
 EXT_RAM_ATTR static int _port;
 EXT_RAM_ATTR rest_server_context_t *rest_context;
-EXT_RAM_ATTR RingbufHandle_t messaging;
+EXT_RAM_ATTR messaging_handle_t messaging;
 
 httpd_handle_t http_get_server(int *port) {
 	if (port) *port = _port;
@@ -71,6 +73,10 @@ void register_regular_handlers(httpd_handle_t server){
 	httpd_register_uri_handler(server, &status_get);
 	httpd_uri_t messages_get = { .uri = "/messages.json", .method = HTTP_GET, .handler = messages_get_handler, .user_ctx = rest_context };
 	httpd_register_uri_handler(server, &messages_get);
+	httpd_uri_t events_get = { .uri = "/events", .method = HTTP_GET, .handler = events_get_handler, .user_ctx = rest_context };
+	httpd_register_uri_handler(server, &events_get);
+	httpd_uri_t telemetry_get = { .uri = "/telemetry.json", .method = HTTP_GET, .handler = telemetry_get_handler, .user_ctx = rest_context };
+	httpd_register_uri_handler(server, &telemetry_get);
 
 	httpd_uri_t commands_get = { .uri = "/commands.json", .method = HTTP_GET, .handler = console_cmd_get_handler, .user_ctx = rest_context };
 	httpd_register_uri_handler(server, &commands_get);
@@ -148,11 +154,17 @@ esp_err_t http_server_start()
 
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.max_uri_handlers = 30;
-    config.max_open_sockets = 3;
+    // event streams keep their socket open, leave room for regular requests
+    config.max_open_sockets = 5;
 	config.lru_purge_enable = true;
 	config.backlog_conn = 1;
     config.uri_match_fn = httpd_uri_match_wildcard;
-	config.task_priority = ESP_TASK_PRIO_MIN;
+	sched_profile_t sched;
+	sched_get("httpd", &sched);
+	config.task_priority = sched.priority;
+	config.core_id = sched.core;
+	if (sched.stack) config.stack_size = sched.stack;
+	config.close_fn = http_server_events_close;
 	_port = config.server_port;
     //todo:  use the endpoint below to configure session token?
     // config.open_fn
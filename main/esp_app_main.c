@@ -289,8 +289,11 @@ void register_default_with_mac(const char* key,  char* defval) {
 void register_default_nvs(){
 #ifdef CONFIG_CSPOT_SINK
 	register_default_string_val("enable_cspot", STR(CONFIG_CSPOT_SINK));
-	cJSON * cspot_config=config_alloc_get_cjson("cspot_config");
-	if(!cspot_config){
+	config_view_lock();
+	bool has_cspot_config = config_get_cjson_view("cspot_config") != NULL;
+	config_view_unlock();
+	if(!has_cspot_config){
+		cJSON * cspot_config = NULL;
 		char * name = alloc_get_string_with_mac(DEFAULT_HOST_NAME);
 		if(name){
 			cjson_update_string(&cspot_config,"deviceName",name);
@@ -0,0 +1,33 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+/*
+ Same cost report as the "bench" console command, for what can be built on a PC.
+ Numbers are only meaningful without sanitizers and are not those of the target.
+*/
+
+#include <stdio.h>
+#include "host.h"
+
+int main(int argc, char *argv[]) {
+	char report[1024];
+
+	host_init();
+	dop_bench(report, sizeof(report));
+	printf("%s", report);
+
+#if RESAMPLE16
+	// only poly is real, the library is replaced by a linear interpolation (see resample16_stub.c)
+	resample_bench(report, sizeof(report));
+	printf("%s", report);
+#endif
+
+	return 0;
+}
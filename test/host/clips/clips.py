@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+#
+# Regenerates reference clips and their manifest for the conformance test.
+# Expected output is computed here from the samples, not from a decoder run,
+# so that a hash is a statement of what the decoder must produce.
+#
+#   python3 clips.py [clips directory]
+#
+# Manifest: <clip> <strm params> <frames> <fnv1a 64 of 16 bits output> <fnv1a 64 of 32 bits output>
+# strm params are sample size, rate, channels and endianness as LMS sends them, the
+# codec is chosen from the extension (.mp3 is mad, others are pcm)
+
+import os
+import struct
+import sys
+
+root = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__))
+FRAMES = 4500
+
+def samples(bits, count, seed):
+	# full scale noise that always includes both extremes
+	x, out = seed, [-(1 << (bits - 1)), (1 << (bits - 1)) - 1]
+	while len(out) < count:
+		x = (x * 6364136223846793005 + 1442695040888963407) & 0xFFFFFFFFFFFFFFFF
+		out.append((x >> 32) % (1 << bits) - (1 << (bits - 1)))
+	return out
+
+def pack(values, bits, bigendian):
+	size = bits // 8
+	return b''.join((v & ((1 << bits) - 1)).to_bytes(size, 'big' if bigendian else 'little') for v in values)
+
+def fnv1a(data):
+	h = 0xcbf29ce484222325
+	for b in data:
+		h = ((h ^ b) * 0x100000001b3) & 0xFFFFFFFFFFFFFFFF
+	return h
+
+# what outputbuf must hold, interleaved stereo in host (little endian) order
+def expected(values, bits, channels):
+	s16, s32 = bytearray(), bytearray()
+	for i in range(0, len(values), channels):
+		frame = values[i:i + channels] * (2 // channels)
+		for v in frame:
+			v32 = v << (32 - bits)
+			s32 += struct.pack('<i', v32)
+			s16 += struct.pack('<h', v32 >> 16)
+	return fnv1a(s16), fnv1a(s32)
+
+def chunk(id, data, bigendian):
+	return id + struct.pack('>I' if bigendian else '<I', len(data)) + data + (b'\0' if len(data) & 1 else b'')
+
+def wav(channels, rate, bits, data, extra=b'', size=None):
+	fmt = struct.pack('<HHIIHH', 1, channels, rate, rate * channels * bits // 8, channels * bits // 8, bits)
+	body = b'WAVE' + chunk(b'fmt ', fmt, False) + extra + b'data' + struct.pack('<I', len(data) if size is None else size) + data
+	return b'RIFF' + struct.pack('<I', len(body)) + body
+
+def aiff(channels, rate, bits, data, offset=0):
+	exponent, mantissa = 16383 + 31, rate
+	while not mantissa & 0x80000000:
+		mantissa <<= 1
+		exponent -= 1
+	comm = struct.pack('>hIh', channels, len(data) // (channels * bits // 8), bits) + struct.pack('>HII', exponent, mantissa, 0)
+	body = b'AIFF' + chunk(b'COMM', comm, True) + chunk(b'SSND', struct.pack('>II', offset, 0) + b'\0' * offset + data, True)
+	return b'FORM' + struct.pack('>I', len(body)) + body
+
+RATES = { 11025: '0', 22050: '1', 32000: '2', 44100: '3', 48000: '4', 8000: '5', 16000: '7', 96000: '9' }
+
+clips = []
+
+def clip(name, kind, channels, rate, bits, seed, **args):
+	values = samples(bits, FRAMES * channels, seed)
+	bigendian = kind == 'aiff' or args.pop('bigendian', False)
+	data = pack(values, bits, bigendian)
+	if kind == 'wav':
+		# a trailing partial frame is part of the data chunk but must not be played
+		tail = args.pop('tail', 0)
+		payload = wav(channels, rate, bits, data + b'\x55' * tail, **args)
+	elif kind == 'aiff':
+		payload = aiff(channels, rate, bits, data, **args)
+	else:
+		payload = data
+	with open(os.path.join(root, name), 'wb') as f:
+		f.write(payload)
+	# server's guess, headers override it
+	params = '%c%c%c%c' % (chr(ord('0') + bits // 8 - 1), RATES[rate], chr(ord('0') + channels), '0' if bigendian else '1')
+	clips.append('%s %s %u %016x %016x' % ((name, params, FRAMES) + expected(values, bits, channels)))
+
+clip('wav_s16_stereo_44k.wav', 'wav', 2, 44100, 16, 1)
+clip('wav_s24_stereo_48k.wav', 'wav', 2, 48000, 24, 2)
+clip('wav_s32_stereo_96k.wav', 'wav', 2, 96000, 32, 3)
+clip('wav_s16_mono_22k.wav', 'wav', 1, 22050, 16, 4)
+clip('wav_s24_mono_32k.wav', 'wav', 1, 32000, 24, 5)
+clip('wav_s32_mono_16k.wav', 'wav', 1, 16000, 32, 6)
+clip('wav_s16_stereo_partial.wav', 'wav', 2, 44100, 16, 7, tail=3,
+	 extra=chunk(b'LIST', b'INFOISFT\x0e\0\0\0squeezelite 1\0', False))
+clip('aiff_s16_stereo_44k.aif', 'aiff', 2, 44100, 16, 8)
+clip('aiff_s24_mono_48k.aif', 'aiff', 1, 48000, 24, 9, offset=6)
+clip('raw_s16_stereo_be.pcm', 'raw', 2, 44100, 16, 10, bigendian=True)
+clip('raw_s24_mono_le.pcm', 'raw', 1, 11025, 24, 11)
+
+# mp3 clips check mad.c around the decoder, which the host replaces with a stand-in
+# (see mad_stub.c) whose sample n of channel c is (s16) (n * 40503 + c * 9973)
+MAD_DELAY = 529
+
+def ramp(first, count, channels):
+	values = []
+	for n in range(first, first + count):
+		for c in range(channels):
+			x = (n * 40503 + c * 9973) & 0xffff
+			values.append(x - 0x10000 if x & 0x8000 else x)
+	return values
+
+def mpeg_frame(mpeg1, rate_index, bitrate_index, length, mono, payload=b''):
+	version = 3 if mpeg1 else 2
+	header = bytes([0xff, 0xe0 | version << 3 | 1 << 1 | 1, bitrate_index << 4 | rate_index << 2, (3 if mono else 0) << 6])
+	body = payload + bytes((i * 29 + 7) & 0x7f for i in range(length - 4 - len(payload)))
+	return header + body
+
+def id3(size):
+	body = b'\0' * (size - 10)
+	syncsafe = bytes([(len(body) >> 21) & 0x7f, (len(body) >> 14) & 0x7f, (len(body) >> 7) & 0x7f, len(body) & 0x7f])
+	return b'ID3\4\0\0' + syncsafe + body
+
+def xing(frames, side, lame=None):
+	tag = b'\0' * (side - 4) + b'Info' + struct.pack('>I', 0x0f) + struct.pack('>II', frames, 0) + bytes(100) + struct.pack('>I', 0)
+	if lame:
+		delay, padding = lame
+		tag += b'LAME3.100' + bytes(12) + bytes([delay >> 4, (delay & 0xf) << 4 | padding >> 8, padding & 0xff])
+	return tag
+
+def mp3(name, frames, mpeg1=True, rate=44100, mono=False, tag=0, lame=None, info=True, junk=0):
+	rate_index = { 44100: 0, 48000: 1, 32000: 2, 22050: 0, 24000: 1, 16000: 2 }[rate]
+	bitrate_index, samples = (9, 1152) if mpeg1 else (8, 576)
+	bitrate = (128000 if mpeg1 else 64000)
+	length = samples // 8 * bitrate // rate
+	side = 4 + (17 if mono else 32) if mpeg1 else 4 + (9 if mono else 17)
+	data = id3(tag) if tag else b''
+	if info:
+		data += mpeg_frame(mpeg1, rate_index, bitrate_index, length, mono, xing(frames, side, lame))
+	for i in range(frames):
+		data += mpeg_frame(mpeg1, rate_index, bitrate_index, length, mono)
+		# garbage between frames makes libmad lose sync, it must not change output
+		if junk and i == frames // 2:
+			data += bytes([0x55]) * junk
+	with open(os.path.join(root, name), 'wb') as f:
+		f.write(data)
+	if lame:
+		skip, padding = lame[0] + MAD_DELAY, max(lame[1] - MAD_DELAY, 0)
+		count = frames * samples - skip - padding
+	else:
+		skip, count = MAD_DELAY, frames * samples - MAD_DELAY
+	channels = 1 if mono else 2
+	clips.append('%s ???? %u %016x %016x' % ((name, count) + expected(ramp(skip, count, channels), 16, channels)))
+
+mp3('mp3_lame_id3_44k.mp3', 40, tag=290, lame=(576, 1200))
+mp3('mp3_lame_mono_48k.mp3', 30, rate=48000, mono=True, lame=(576, 300))
+mp3('mp3_lame_mpeg2_22k.mp3', 60, mpeg1=False, rate=22050, lame=(1105, 2000))
+mp3('mp3_xing_no_lame_32k.mp3', 25, rate=32000)
+mp3('mp3_plain_resync_44k.mp3', 35, info=False, junk=37)
+
+with open(os.path.join(root, 'clips.txt'), 'w') as f:
+	f.write('\n'.join(clips) + '\n')
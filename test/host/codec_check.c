@@ -0,0 +1,168 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+/*
+ Decodes reference clips through the real codec structs and checks that the
+ output is bit-exact with the hashes of the manifest (see clips/clips.py). mp3
+ clips are decoded from the start of streambuf and from offsets where headers and
+ tags straddle its wrap. Then it is decoded again for a while to report
+ throughput and bytes per call. Only pcm and mad.c build for host, libmad is
+ replaced by a stand-in so mp3 clips check tags and gapless, not cost.
+
+   codec_check <clips directory> [seconds per clip]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "host.h"
+
+extern bool pcm_check_header;
+
+struct check {
+	u64_t hash;
+	size_t bytes;
+};
+
+static u64_t now_us(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// fnv1a 64 over what lands in outputbuf
+static void hash(u8_t *frames, size_t bytes, void *ctx) {
+	struct check *check = ctx;
+	check->bytes += bytes;
+	while (bytes--) check->hash = (check->hash ^ *frames++) * 0x100000001b3ULL;
+}
+
+static u8_t *load(const char *path, size_t *len) {
+	FILE *file = fopen(path, "rb");
+	u8_t *data = NULL;
+	long size;
+
+	if (!file) return NULL;
+
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	rewind(file);
+
+	if (size > 0 && (data = malloc(size)) != NULL && fread(data, 1, size, file) != (size_t) size) {
+		free(data);
+		data = NULL;
+	}
+
+	fclose(file);
+	*len = size;
+
+	return data;
+}
+
+int main(int argc, char *argv[]) {
+	char line[256], path[1024];
+	double seconds = argc > 2 ? atof(argv[2]) : 0.2;
+	int clips = 0, failed = 0;
+	// bytes before the wrap where data starts, 0 is the beginning of streambuf
+	static const size_t offsets[] = { 0, 5, 100, 301, 1400 };
+	struct codec *pcm, *mad;
+	FILE *manifest;
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <clips directory> [seconds per clip]\n", argv[0]);
+		return 1;
+	}
+
+	snprintf(path, sizeof(path), "%s/clips.txt", argv[1]);
+	if ((manifest = fopen(path, "r")) == NULL) {
+		fprintf(stderr, "can't open %s\n", path);
+		return 1;
+	}
+
+	host_init();
+	pcm_check_header = true;
+	pcm = register_pcm();
+	mad = register_mad();
+
+	printf("%u bits output\n", BYTES_PER_FRAME * 4);
+	printf("%-28s %8s %12s %10s %8s\n", "clip", "frames", "frames/s", "bytes/call", "result");
+
+	while (fgets(line, sizeof(line), manifest)) {
+		char name[128], open[5];
+		unsigned long long hash16, hash32;
+		unsigned frames, runs = 0;
+		struct check check;
+		struct host_stats stats;
+		struct codec *codec;
+		decode_state state;
+		u64_t start, elapsed;
+		size_t len, in_bytes = 0, calls = 0, offset = 0;
+		bool ok = true;
+		u8_t *data;
+
+		if (sscanf(line, "%127s %4s %u %llx %llx", name, open, &frames, &hash16, &hash32) != 5) continue;
+
+		snprintf(path, sizeof(path), "%s/%s", argv[1], name);
+		if ((data = load(path, &len)) == NULL) {
+			printf("%-28s can't load\n", name);
+			failed++;
+			continue;
+		}
+
+		clips++;
+		codec = strstr(name, ".mp3") ? mad : pcm;
+
+		// pcm re-aligns streambuf when opened, so its data always starts at the beginning
+		for (int i = 0; ok && i < (codec == mad ? sizeof(offsets) / sizeof(*offsets) : 1); i++) {
+			offset = offsets[i];
+			check = (struct check) { 0xcbf29ce484222325ULL, 0 };
+			host_offset(HOST_STREAMBUF_SIZE - offset);
+			state = host_decode(codec, open, data, len, hash, &check, NULL);
+			ok = state == DECODE_COMPLETE && check.bytes == frames * BYTES_PER_FRAME &&
+				 check.hash == (BYTES_PER_FRAME == 4 ? hash16 : hash32);
+		}
+
+		host_offset(0);
+		if (!ok) {
+			printf("%-28s %8zu %12s %10s %8s at %zu\n", name, check.bytes / BYTES_PER_FRAME, "-", "-",
+				   state != DECODE_COMPLETE ? "error" : "MISMATCH", offset);
+			failed++;
+			free(data);
+			continue;
+		}
+
+		// cost of the stand-in decoder means nothing
+		if (codec == mad) {
+			printf("%-28s %8zu %12s %10s %8s\n", name, check.bytes / BYTES_PER_FRAME, "-", "-", "ok");
+			free(data);
+			continue;
+		}
+
+		// decode again without checking, for cost
+		start = now_us();
+		do {
+			host_decode(codec, open, data, len, NULL, NULL, &stats);
+			in_bytes += stats.in_bytes;
+			calls += stats.calls;
+			runs++;
+			elapsed = now_us() - start;
+		} while (elapsed < seconds * 1000000);
+
+		printf("%-28s %8zu %12.0f %10.0f %8s\n", name, check.bytes / BYTES_PER_FRAME,
+			   (double) frames * runs * 1000000 / elapsed, (double) in_bytes / calls, "ok");
+
+		free(data);
+	}
+
+	fclose(manifest);
+	printf("%d clips, %d failed\n", clips, failed);
+
+	return failed || !clips;
+}
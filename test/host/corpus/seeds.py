@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+#
+# Regenerates the seed corpus of host fuzz targets: valid inputs plus the
+# corner cases parsers must survive (truncations, odd sizes, wrong order)
+#
+#   python3 seeds.py [corpus directory]
+
+import os
+import struct
+import sys
+
+root = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__))
+
+def save(target, name, data):
+	os.makedirs(os.path.join(root, target), exist_ok=True)
+	with open(os.path.join(root, target, name), 'wb') as f:
+		f.write(data)
+
+# ---------------------------------------------------------------- wav & aiff
+
+def chunk_le(id, data):
+	return id + struct.pack('<I', len(data)) + data + (b'\0' if len(data) & 1 else b'')
+
+def chunk_be(id, data):
+	return id + struct.pack('>I', len(data)) + data + (b'\0' if len(data) & 1 else b'')
+
+def wav(channels, rate, bits, samples, extra=b'', size=None):
+	fmt = struct.pack('<HHIIHH', 1, channels, rate, rate * channels * bits // 8, channels * bits // 8, bits)
+	data = bytes((i * 37) & 0xff for i in range(samples * channels * bits // 8))
+	body = b'WAVE' + chunk_le(b'fmt ', fmt) + extra
+	body += b'data' + struct.pack('<I', len(data) if size is None else size) + data
+	return b'RIFF' + struct.pack('<I', len(body)) + body
+
+def ieee_extended(rate):
+	exponent, mantissa = 16383 + 31, rate
+	while not mantissa & 0x80000000:
+		mantissa <<= 1
+		exponent -= 1
+	return struct.pack('>HII', exponent, mantissa, 0)
+
+def aiff(channels, rate, bits, samples, offset=0, kind=b'AIFF'):
+	comm = struct.pack('>hIh', channels, samples, bits) + ieee_extended(rate)
+	data = bytes((i * 53) & 0xff for i in range(samples * channels * bits // 8))
+	ssnd = struct.pack('>II', offset, 0) + b'\0' * offset + data
+	body = kind + chunk_be(b'COMM', comm) + chunk_be(b'SSND', ssnd)
+	return b'FORM' + struct.pack('>I', len(body)) + body
+
+save('pcm', 'wav_s16_stereo', wav(2, 44100, 16, 600))
+save('pcm', 'wav_s24_mono', wav(1, 48000, 24, 500))
+save('pcm', 'wav_s32_stereo', wav(2, 96000, 32, 300))
+save('pcm', 'wav_u8_mono', wav(1, 8000, 8, 700))
+save('pcm', 'wav_list_before_data', wav(2, 44100, 16, 200, extra=chunk_le(b'LIST', b'INFOISFT\x05\0\0\0test\0')))
+save('pcm', 'wav_unknown_size', wav(2, 44100, 16, 200, size=0xFFFFFFFF))
+save('pcm', 'wav_short_data', wav(2, 44100, 16, 200, size=7))
+save('pcm', 'wav_zero_channels', wav(0, 44100, 16, 100))
+save('pcm', 'wav_huge_chunk', wav(2, 44100, 16, 100, extra=b'junk' + struct.pack('<I', 0xFFFFFFF0)))
+save('pcm', 'wav_truncated_header', wav(2, 44100, 16, 10)[:30])
+save('pcm', 'aiff_s16_stereo', aiff(2, 44100, 16, 600))
+save('pcm', 'aiff_s24_mono_offset', aiff(1, 32000, 24, 400, offset=16))
+save('pcm', 'aifc_s16_mono', aiff(1, 22050, 16, 400, kind=b'AIFC'))
+save('pcm', 'aiff_bad_offset', aiff(2, 44100, 16, 50)[:-200] + b'\xff' * 4)
+save('pcm', 'raw_pcm', bytes(range(256)) * 9)
+
+# ---------------------------------------------------------------- mp4
+
+def box(type, payload):
+	return struct.pack('>I', 8 + len(payload)) + type + payload
+
+def full(type, payload, version=0):
+	return box(type, struct.pack('>I', version << 24) + payload)
+
+def mp4(codec=b'alac', wide=False, moov_first=True, co64=False, large=False, counts=(10, 20, 30, 0, 40)):
+	samples = [bytes([n]) * size for n, size in enumerate(counts)]
+	if codec == b'alac':
+		entry = box(b'alac', b'\0' * 28 + full(b'alac', struct.pack('>IBBBBBBHIII', 4096, 0, 16, 40, 10, 14, 2, 255, 0, 0, 44100)))
+	else:
+		entry = box(b'mp4a', b'\0' * 28 + full(b'esds', bytes.fromhex('03190000000411400000000000000000000000051212100000000000000000000000060102')))
+
+	def moov(offset):
+		stsd = full(b'stsd', struct.pack('>I', 1) + entry)
+		stts = full(b'stts', struct.pack('>III', 1, len(samples), 4096))
+		stsc = full(b'stsc', struct.pack('>IIII', 2, 1, 2, 1) + struct.pack('>III', 2, 3, 1))
+		stsz = full(b'stsz', struct.pack('>II', 0, len(samples)) + b''.join(struct.pack('>I', len(s)) for s in samples))
+		chunks = [offset, offset + len(samples[0]) + len(samples[1])]
+		if co64:
+			stco = full(b'co64', struct.pack('>I', 2) + b''.join(struct.pack('>Q', c) for c in chunks))
+		else:
+			stco = full(b'stco', struct.pack('>I', 2) + b''.join(struct.pack('>I', c) for c in chunks))
+		stbl = box(b'stbl', stsd + stts + stsc + stsz + stco)
+		udta = box(b'udta', full(b'meta', box(b'ilst', box(b'----', full(b'mean', b'com.apple.iTunes') + full(b'name', b'iTunSMPB') +
+			box(b'data', struct.pack('>II', 1, 0) + b' 00000000 00000840 000001CA 00000000000046E0')))))
+		return box(b'moov', box(b'trak', box(b'mdia', box(b'minf', stbl))) + udta)
+
+	ftyp = box(b'ftyp', b'M4A \0\0\0\0')
+	payload = b''.join(samples)
+	mdat = (struct.pack('>I', 1) + b'mdat' + struct.pack('>Q', 16 + len(payload))) if large else struct.pack('>I', 8 + len(payload)) + b'mdat'
+	size = len(moov(0))
+	if moov_first:
+		return ftyp + moov(len(ftyp) + size + len(mdat)) + mdat + payload
+	return ftyp + mdat + payload + moov(len(ftyp) + len(mdat))
+
+save('mp4', 'alac', mp4())
+save('mp4', 'aac', mp4(codec=b'mp4a'))
+save('mp4', 'alac_co64_large_mdat', mp4(co64=True, large=True))
+save('mp4', 'alac_mdat_first', mp4(moov_first=False))
+save('mp4', 'alac_truncated', mp4()[:300])
+save('mp4', 'stsz_empty_box', box(b'moov', box(b'trak', box(b'mdia', box(b'minf', box(b'stbl',
+	full(b'stsd', struct.pack('>I', 1) + box(b'alac', b'\0' * 28)) + box(b'stsz', b'') + full(b'stco', struct.pack('>II', 1, 64))))))))
+save('mp4', 'box_size_zero', struct.pack('>I', 0) + b'moov' + b'\0' * 16)
+
+# ---------------------------------------------------------------- slimproto
+
+def packets(*pkts):
+	return b''.join(struct.pack('>H', len(p)) + p for p in pkts)
+
+def strm(command, format=b'p', header=b'', autostart=b'1', ip=0, port=9000):
+	return b'strm' + command + autostart + format + b'1321' + struct.pack('>BBBBBBB', 255, 0, 10, ord('0'), 0, 1, 0) + \
+		struct.pack('>IHI', 0x10000, port, ip) + header
+
+save('slimproto', 'stream', packets(strm(b's', header=b'GET /stream.mp3?player=aa HTTP/1.0\r\n\r\n'),
+	b'cont' + struct.pack('>IB', 16000, 0), strm(b'u'), strm(b'p'), strm(b'a'), strm(b't'), strm(b'q')))
+save('slimproto', 'stream_unknown_codec', packets(strm(b's', format=b'?', autostart=b'3', header=b'GET / HTTP/1.0\r\n\r\n'),
+	b'codc' + b'p1321', b'cont' + struct.pack('>IB', 0, 0)))
+save('slimproto', 'stream_file', packets(strm(b's', header=b'/tmp/none.wav', ip=0x7f000001, port=0xffff)))
+save('slimproto', 'audio', packets(b'aude\1\1', b'audg' + struct.pack('>IIBBII', 0, 0, 1, 255, 0x8000, 0x4000), b'aude\0\0'))
+save('slimproto', 'setd', packets(b'setd\0', b'setd\0esp32 kitchen', b'setd\0' + b'x' * 200, b'setd\4'))
+save('slimproto', 'serv', packets(b'serv' + struct.pack('>I', 0xc0a80001) + b'0123456789', b'serv' + struct.pack('>I', 0xc0a80002)))
+save('slimproto', 'short', packets(b'str', b'strm', b'audg\0', b'cont', b'dsco', b'vers7.9'))
+
+# ---------------------------------------------------------------- mad (id3 and Xing/LAME tags)
+
+# first byte sets how many bytes (x4) before the end of streambuf the stream starts
+
+def mpeg_frame(mpeg1=True, mono=False, payload=b''):
+	header = bytes([0xff, 0xfb if mpeg1 else 0xf3, 0x90 if mpeg1 else 0x80, 0xc0 if mono else 0])
+	length = 417 if mpeg1 else 208
+	return header + payload + bytes((i * 29 + 7) & 0x7f for i in range(length - 4 - len(payload)))
+
+def id3(size, footer=False, syncsafe=True):
+	body = b'\0' * size
+	length = bytes([(size >> 21) & 0x7f, (size >> 14) & 0x7f, (size >> 7) & 0x7f, size & 0x7f]) if syncsafe else struct.pack('>I', size)
+	return b'ID3\4\0' + (b'\x10' if footer else b'\0') + length + body
+
+def info(frames, mpeg1=True, mono=False, flags=0x0f, lame=(576, 1200), tag=b'Info'):
+	side = 4 + ((17 if mono else 32) if mpeg1 else (9 if mono else 17))
+	payload = b'\0' * (side - 4) + tag + struct.pack('>I', flags)
+	payload += (struct.pack('>I', frames) if flags & 0x01 else b'') + (b'\0' * 4 if flags & 0x02 else b'')
+	payload += (bytes(100) if flags & 0x04 else b'') + (b'\0' * 4 if flags & 0x08 else b'')
+	if lame:
+		delay, padding = lame
+		payload += b'LAME3.100' + bytes(12) + bytes([delay >> 4, (delay & 0xf) << 4 | padding >> 8, padding & 0xff])
+	return mpeg_frame(mpeg1, mono, payload)
+
+def frames(count, mpeg1=True, mono=False):
+	return b''.join(mpeg_frame(mpeg1, mono) for i in range(count))
+
+save('mad', 'lame_id3', b'\0' + id3(300) + info(8) + frames(8))
+save('mad', 'lame_id3_wrap', b'\x50' + id3(300) + info(8) + frames(8))
+save('mad', 'lame_wrap', b'\x20' + info(8) + frames(8))
+save('mad', 'lame_mono_mpeg2', b'\x10' + info(12, mpeg1=False, mono=True, lame=(1105, 2000)) + frames(12, mpeg1=False, mono=True))
+save('mad', 'lame_padding_over_total', b'\0' + info(2, lame=(4000, 4000)) + frames(2))
+save('mad', 'xing_no_frames', b'\x08' + info(0, flags=0x0e, tag=b'Xing') + frames(3))
+save('mad', 'xing_no_lame', b'\0' + info(5, lame=None) + frames(5))
+save('mad', 'id3_footer', b'\x40' + id3(64, footer=True) + b'\0' * 10 + frames(4))
+save('mad', 'id3_not_syncsafe', b'\0' + id3(0x80, syncsafe=False) + frames(4))
+save('mad', 'id3_huge', b'\0' + id3(0x0fffffff)[:200] + frames(2))
+save('mad', 'id3_truncated', b'\x01' + b'ID3\4\0\0\0')
+save('mad', 'info_truncated', b'\x03' + info(8)[:60])
+save('mad', 'junk_then_frames', b'\x02' + b'\x55' * 37 + frames(6))
+
+# ---------------------------------------------------------------- icy
+
+# first 2 bytes are icy-metaint, then response headers, then body with meta data every metaint bytes
+
+def icy(interval, metas, body=b'\x11', headers=b'ICY 200 OK\r\nicy-metaint: %u\r\n\r\n'):
+	data = struct.pack('>H', interval) + (headers % interval if b'%u' in headers else headers)
+	for meta in metas:
+		padded = meta + b'\0' * (-len(meta) % 16)
+		data += body * interval + bytes([len(padded) // 16]) + padded
+	return data
+
+save('icy', 'title', icy(64, [b"StreamTitle='artist - song';StreamUrl='';", b'', b"StreamTitle='next';"]))
+save('icy', 'meta_max', icy(16, [b'x' * 255 * 16]))
+save('icy', 'meta_truncated', icy(32, [b"StreamTitle='cut short';"])[:-10])
+save('icy', 'meta_length_only', icy(32, [])+ b'\x22' * 32 + b'\xff')
+save('icy', 'no_metaint', icy(0, [], headers=b'HTTP/1.0 200 OK\r\nContent-Length: 100\r\nAccept-Ranges: bytes\r\n\r\n') + b'\x33' * 120)
+save('icy', 'interval_one', icy(1, [b'a', b'', b'b' * 40, b'']))
+save('icy', 'headers_too_long', struct.pack('>H', 16) + b'HTTP/1.0 200 OK\r\n' + b'X' * 4078 + b'\r\n\r\n')
+# end of headers on the last byte that fits
+save('icy', 'headers_full', struct.pack('>H', 16) + b'HTTP/1.0 200 OK\r\n' + b'X' * 4075 + b'\r\n\r\n')
+save('icy', 'headers_unterminated', struct.pack('>H', 16) + b'ICY 200 OK\r\nicy-name: none')
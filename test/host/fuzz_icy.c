@@ -0,0 +1,79 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+/*
+ stream.c is included so that its thread can be run in place on a socketpair
+ that holds the input: response headers then body interleaved with icy meta
+ data. The thread returns when it disconnects, which it signals through
+ wake_controller(). Nothing else from the host fixture is used as stream.c
+ owns streambuf and stream itself.
+*/
+
+#include "stream.c"
+
+#define FUZZ_STREAMBUF_SIZE	(64 * 1024)
+
+// slimproto reads meta data once stream thread has set it, do the same
+void wake_controller(void) {
+	if (stream.meta_send) {
+		volatile size_t len = strlen(stream.header);
+		stream.meta_send = false;
+	}
+	if (stream.state <= DISCONNECT) running = false;
+}
+
+// first 2 bytes are icy-metaint as LMS sends it in cont, the rest is what the server sends
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+	static bool init;
+	char *header;
+	int sv[2];
+
+	if (size < 2) return 0;
+
+	if (!init) {
+		loglevel = getenv("HOST_DEBUG") ? lDEBUG : lERROR;
+		buf_init(streambuf, FUZZ_STREAMBUF_SIZE);
+		stream.header = malloc(MAX_HEADER);
+		range.header = malloc(MAX_HEADER);
+		init = true;
+	}
+
+	// streambuf is never drained so all input must fit
+	size = min(size, FUZZ_STREAMBUF_SIZE / 2);
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv)) return 0;
+	if (send(sv[1], data + 2, size - 2, MSG_NOSIGNAL) != (ssize_t) (size - 2)) {
+		close(sv[0]);
+		close(sv[1]);
+		return 0;
+	}
+	shutdown(sv[1], SHUT_WR);
+
+	buf_flush(streambuf);
+	header = range.header;
+	memset(&range, 0, sizeof(range));
+	range.header = header;
+	stream.header_len = 0;
+	stream.bytes = 0;
+	stream.threshold = 0;
+	stream.cont_wait = false;
+	stream.meta_interval = stream.meta_next = data[0] << 8 | data[1];
+	stream.meta_left = 0;
+	stream.meta_send = false;
+	stream.state = RECV_HEADERS;
+
+	fd = sv[0];
+	running = true;
+	stream_thread();
+
+	if (fd >= 0) closesocket(fd);
+	close(sv[1]);
+
+	return 0;
+}
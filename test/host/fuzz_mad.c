@@ -0,0 +1,33 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+#include "host.h"
+
+/*
+ id3 and Xing/LAME tags are parsed by mad.c before libmad (see mad_stub.c) sees
+ anything. First byte of input sets how far before the end of streambuf data
+ starts, so that tags straddle the wrap, the rest is the mp3 stream.
+*/
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+	static struct codec *mad;
+
+	if (!size) return 0;
+
+	if (!mad) {
+		host_init();
+		mad = register_mad();
+	}
+
+	host_offset(HOST_STREAMBUF_SIZE - data[0] * 4);
+	host_decode(mad, "????", data + 1, size - 1, NULL, NULL, NULL);
+	host_offset(0);
+
+	return 0;
+}
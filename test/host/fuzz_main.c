@@ -0,0 +1,93 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+/*
+ Replays files or directories through a libFuzzer target when the compiler has
+ no -fsanitize=fuzzer (gcc), so that corpora can still run under sanitizers.
+ Options (-runs=...) are ignored so the same command line works for both.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+static int replay(const char *path) {
+	FILE *file = fopen(path, "rb");
+	uint8_t *data = NULL;
+	long size;
+
+	if (!file) {
+		fprintf(stderr, "can't open %s\n", path);
+		return -1;
+	}
+
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	rewind(file);
+
+	// exact size so that sanitizers see any over-read
+	if (size < 0 || (data = malloc(size ? size : 1)) == NULL || fread(data, 1, size, file) != (size_t) size) {
+		fprintf(stderr, "can't read %s\n", path);
+		fclose(file);
+		free(data);
+		return -1;
+	}
+
+	fclose(file);
+	LLVMFuzzerTestOneInput(data, size);
+	free(data);
+
+	return 1;
+}
+
+static int replay_path(const char *path) {
+	struct stat st;
+	struct dirent *entry;
+	DIR *dir;
+	int count = 0;
+
+	if (stat(path, &st) || !S_ISDIR(st.st_mode)) return replay(path);
+	if ((dir = opendir(path)) == NULL) return -1;
+
+	while ((entry = readdir(dir)) != NULL) {
+		char name[1024];
+		int n;
+
+		if (entry->d_name[0] == '.') continue;
+		snprintf(name, sizeof(name), "%s/%s", path, entry->d_name);
+		if ((n = replay_path(name)) < 0) count = -1;
+		else if (count >= 0) count += n;
+	}
+
+	closedir(dir);
+
+	return count;
+}
+
+int main(int argc, char *argv[]) {
+	int count = 0;
+
+	for (int i = 1; i < argc; i++) {
+		int n;
+
+		if (argv[i][0] == '-') continue;
+		if ((n = replay_path(argv[i])) < 0) return 1;
+		count += n;
+	}
+
+	printf("%s: %d inputs replayed\n", argv[0], count);
+
+	return count ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+#include "host.h"
+#include "mp4.h"
+
+#define LOCK_S   mutex_lock(streambuf->mutex)
+#define UNLOCK_S mutex_unlock(streambuf->mutex)
+
+// codecs parse their sample description, this one only reads all of it
+static bool config(void *ctx, u8_t *box, u32_t len) {
+	while (len--) *(volatile u8_t*) ctx = *box++;
+	return true;
+}
+
+// refill streambuf, returns false when there is nothing left to feed
+static bool feed(const u8_t **data, size_t *size) {
+	size_t n;
+
+	UNLOCK_S;
+	n = host_feed(data, size);
+	if (!*size) stream.state = DISCONNECT;
+	LOCK_S;
+
+	return n != 0;
+}
+
+/*
+ Drive the demuxer the way alac and aac do: header first, then samples until
+ the end, with streambuf refilled whenever the parser wants more
+*/
+static void demux(const char *codec, const uint8_t *data, size_t size) {
+	static struct mp4 m;
+	volatile u8_t sink;
+	int found = 0, stall = 0;
+
+	buf_flush(streambuf);
+	stream.state = STREAMING_FILE;
+	mp4_init(&m, codec, config, (void*) &sink);
+
+	LOCK_S;
+
+	while (!found && stall < 4) {
+		u64_t pos = m.pos;
+		bool fed = feed(&data, &size);
+
+		found = mp4_header(&m);
+		stall = (fed || m.pos != pos) ? 0 : stall + 1;
+	}
+
+	while (found > 0 && stall < 4) {
+		int bytes = mp4_next(&m);
+
+		if (bytes == MP4_END || bytes == MP4_ERROR) break;
+
+		if (bytes > 0) {
+			u8_t *scratch = malloc(bytes);
+			u8_t *sample = mp4_data(bytes, scratch);
+			sink = sample[0];
+			sink = sample[bytes - 1];
+			free(scratch);
+			mp4_advance(&m, bytes);
+			stall = 0;
+		} else if (!feed(&data, &size)) {
+			stall++;
+		}
+	}
+
+	UNLOCK_S;
+	mp4_close(&m);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+	host_init();
+	demux("alac", data, size);
+	demux("esds", data, size);
+
+	return 0;
+}
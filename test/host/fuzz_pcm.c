@@ -0,0 +1,29 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+#include "host.h"
+
+extern bool pcm_check_header;
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+	static struct codec *pcm;
+	// strm parameters depend on size so that raw pcm goes through all formats, wav/aiff headers override them
+	char open[4] = { '0' + size % 4, '3', '1' + (size / 4) % 2, '0' + (size / 8) % 2 };
+
+	if (!pcm) {
+		host_init();
+		pcm_check_header = true;
+		pcm = register_pcm();
+	}
+
+	host_decode(pcm, open, data, size, NULL, NULL, NULL);
+
+	return 0;
+}
@@ -0,0 +1,60 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+/*
+ slimproto.c is included so that process() and its handlers can be reached
+ directly. What embedded.h provides to it on target is declared here.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define PLAYER_ID 12
+extern bool (*slimp_handler)(uint8_t *data, int len);
+extern void (*slimp_loop)(void);
+
+#include "slimproto.c"
+
+// squeezelite.h can't be included twice
+void host_init(void);
+
+// input is a sequence of packets, each prefixed by its 16 bits big endian length like LMS sends them
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+	static bool init;
+
+	if (!init) {
+		host_init();
+		wake_create(wake_e);
+		loglevel = lERROR;
+		init = true;
+	}
+
+	while (size >= 2) {
+		size_t len = min(data[0] << 8 | data[1], size - 2);
+		u8_t *pkt;
+
+		data += 2;
+		size -= 2;
+
+		// serv to 0.0.0.1 resolves mysqueezebox.com
+		if (len >= 8 && !memcmp(data, "serv", 4) && !memcmp(data + 4, "\0\0\0\1", 4)) break;
+
+		// handlers are given the packet in place, exact size so that over-reads are caught
+		if ((pkt = malloc(len ? len : 1)) == NULL) break;
+		memcpy(pkt, data, len);
+		process(pkt, len);
+		free(pkt);
+
+		data += len;
+		size -= len;
+	}
+
+	return 0;
+}
@@ -0,0 +1,176 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+#include <stdlib.h>
+#include "host.h"
+
+#define LOCK_S   mutex_lock(streambuf->mutex)
+#define UNLOCK_S mutex_unlock(streambuf->mutex)
+#define LOCK_O   mutex_lock(outputbuf->mutex)
+#define UNLOCK_O mutex_unlock(outputbuf->mutex)
+
+// rounds without input, consumption or output before a codec is declared stuck
+#define MAX_STALL	16
+
+log_level loglevel;
+
+static struct buffer buf_s, buf_o;
+struct buffer *streambuf = &buf_s;
+struct buffer *outputbuf = &buf_o;
+
+struct streamstate stream;
+struct decodestate decode;
+struct outputstate output;
+struct codec *codecs[MAX_CODECS];
+
+bool (*slimp_handler)(u8_t *data, int len);
+void (*slimp_loop)(void);
+
+// where data starts in streambuf, so that it can straddle the wrap
+static size_t offset;
+
+/****************************************************************************************
+ * What the rest of squeezelite would provide, just enough for parsers and decoders
+ */
+unsigned decode_newstream(unsigned sample_rate, unsigned supported_rates[]) {
+	return sample_rate;
+}
+
+void _checkfade(bool start) { }
+
+// data comes from memory, there is nothing to re-open
+bool _stream_range(u64_t offset) {
+	return false;
+}
+
+void codec_open(u8_t format, u8_t sample_size, u8_t sample_rate, u8_t channels, u8_t endianness) { }
+void decode_flush(bool close) { }
+void output_flush(void) { }
+bool stream_disconnect(void) { return false; }
+void stream_file(const char *header, size_t header_len, unsigned threshold) { }
+void stream_sock(u32_t ip, u16_t port, const char *header, size_t header_len, unsigned threshold, bool cont_wait) { }
+void set_volume(unsigned left, unsigned right) { }
+
+/****************************************************************************************
+ * Buffers are created once, set HOST_DEBUG to see codecs' logs
+ */
+void host_init(void) {
+	static bool done;
+
+	if (done) return;
+	done = true;
+
+	loglevel = getenv("HOST_DEBUG") ? lDEBUG : lERROR;
+	buf_init(streambuf, HOST_STREAMBUF_SIZE);
+	buf_init(outputbuf, HOST_OUTPUTBUF_SIZE);
+}
+
+/****************************************************************************************
+ * Next decodes start at that offset of streambuf instead of its beginning
+ */
+void host_offset(size_t start) {
+	offset = start;
+}
+
+/****************************************************************************************
+ * Copy what fits in streambuf and move data forward
+ */
+size_t host_feed(const u8_t **data, size_t *len) {
+	size_t n;
+
+	LOCK_S;
+	n = min(*len, min(_buf_space(streambuf), _buf_cont_write(streambuf)));
+	memcpy(streambuf->writep, *data, n);
+	_buf_inc_writep(streambuf, n);
+	UNLOCK_S;
+
+	*data += n;
+	*len -= n;
+
+	return n;
+}
+
+static size_t host_drain(host_output_t out, void *ctx) {
+	size_t bytes = 0;
+
+	LOCK_O;
+	while (_buf_used(outputbuf)) {
+		size_t cont = _buf_cont_read(outputbuf);
+		if (out) out(outputbuf->readp, cont, ctx);
+		_buf_inc_readp(outputbuf, cont);
+		bytes += cont;
+	}
+	UNLOCK_O;
+
+	return bytes;
+}
+
+/****************************************************************************************
+ * Run a codec like decode_thread does, as if data was a local file opened with the
+ * strm parameters in 'open'. Output is handed to 'out' as soon as it is produced
+ */
+decode_state host_decode(struct codec *codec, const char open[4], const u8_t *data, size_t len,
+						 host_output_t out, void *ctx, struct host_stats *stats) {
+	struct host_stats ignore;
+	unsigned stall = 0;
+
+	if (!stats) stats = &ignore;
+	memset(stats, 0, sizeof(*stats));
+
+	buf_flush(streambuf);
+	buf_flush(outputbuf);
+	codec->open(open[0], open[1], open[2], open[3]);
+
+	// codecs may have resized streambuf in open
+	streambuf->readp = streambuf->writep = streambuf->buf + offset % streambuf->size;
+
+	stream.state = STREAMING_FILE;
+	decode.new_stream = true;
+	decode.state = DECODE_RUNNING;
+
+	while (decode.state == DECODE_RUNNING) {
+		size_t bytes, space, fed, drained;
+		bool toend;
+
+		fed = host_feed(&data, &len);
+		if (!len) stream.state = DISCONNECT;
+
+		LOCK_S;
+		bytes = _buf_used(streambuf);
+		toend = (stream.state <= DISCONNECT);
+		UNLOCK_S;
+		LOCK_O;
+		space = _buf_space(outputbuf);
+		UNLOCK_O;
+
+		if (space > codec->min_space && (bytes > codec->min_read_bytes || toend)) {
+			decode.state = codec->decode();
+			stats->calls++;
+		}
+
+		LOCK_S;
+		bytes -= _buf_used(streambuf);
+		UNLOCK_S;
+
+		drained = host_drain(out, ctx);
+		stats->in_bytes += bytes;
+		stats->out_bytes += drained;
+
+		if (fed || bytes || drained) stall = 0;
+		else if (++stall == MAX_STALL) {
+			LOG_ERROR("codec %c is stuck with %u bytes left", codec->id, _buf_used(streambuf));
+			decode.state = DECODE_ERROR;
+		}
+	}
+
+	codec->close();
+
+	return decode.state;
+}
@@ -0,0 +1,43 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+#pragma once
+
+/*
+ Host fixture for parsers and decoders: it owns the squeezelite globals that
+ decode.c, stream.c and output.c would define and drives a codec the way
+ decode_thread does, feeding streambuf from memory.
+*/
+
+#include "squeezelite.h"
+
+#define HOST_STREAMBUF_SIZE	(16 * 1024)
+#define HOST_OUTPUTBUF_SIZE	(256 * 1024)
+
+extern log_level loglevel;
+extern struct buffer *streambuf;
+extern struct buffer *outputbuf;
+extern struct streamstate stream;
+extern struct decodestate decode;
+extern struct outputstate output;
+
+typedef void (*host_output_t)(u8_t *frames, size_t bytes, void *ctx);
+
+struct host_stats {
+	unsigned calls;			// codec->decode() calls
+	size_t in_bytes;		// consumed from streambuf
+	size_t out_bytes;		// produced in outputbuf
+};
+
+void   host_init(void);
+void   host_offset(size_t start);
+size_t host_feed(const u8_t **data, size_t *len);
+decode_state host_decode(struct codec *codec, const char open[4], const u8_t *data, size_t len,
+						 host_output_t out, void *ctx, struct host_stats *stats);
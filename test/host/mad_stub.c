@@ -0,0 +1,130 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+/*
+ Stand-in for libmad, which is only built for xtensa. It finds, sizes and
+ consumes frames like libmad does (sync search, guard bytes, BUFLEN/LOSTSYNC)
+ but instead of decoding, the synth produces a ramp where each sample tells
+ its position in the stream. That is enough to check what mad.c does around
+ the decoder: id3 and Xing/LAME tags, gapless trimming and end of stream.
+
+ Sample n of channel c is (s16_t) (n * 40503 + c * 9973) at full scale, see
+ clips/clips.py which computes the same.
+*/
+
+#include <string.h>
+#include "squeezelite.h"
+#include <mad.h>
+
+static struct {
+	u32_t count;	// samples synthesized since mad_stream_init
+	unsigned samples, channels, rate;
+} stub;
+
+static const char *errors[] = { "no error", "buffer length", "lost synchronization" };
+
+// frame length of a valid mpeg audio header, 0 otherwise
+static unsigned header(const u8_t *ptr, unsigned *samples, unsigned *channels, unsigned *rate) {
+	static const u16_t bitrates[2][3][15] = {
+		{ { 0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448 },
+		  { 0, 32, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384 },
+		  { 0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320 } },
+		{ { 0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256 },
+		  { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 },
+		  { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 } },
+	};
+	static const u32_t rates[3] = { 44100, 48000, 32000 };
+	unsigned version = (ptr[1] >> 3) & 0x03, layer = 4 - ((ptr[1] >> 1) & 0x03);
+	unsigned index = ptr[2] >> 4, sr = (ptr[2] >> 2) & 0x03, padding = (ptr[2] >> 1) & 0x01;
+	bool mpeg1 = version == 3;
+	u32_t bitrate;
+
+	if (ptr[0] != 0xff || (ptr[1] & 0xe0) != 0xe0 || version == 1 || layer == 4 || index == 0 || index == 15 || sr == 3) {
+		return 0;
+	}
+
+	bitrate = bitrates[!mpeg1][layer - 1][index] * 1000;
+	*rate = rates[sr] >> (mpeg1 ? 0 : (version == 2 ? 1 : 2));
+	*channels = (ptr[3] >> 6) == 3 ? 1 : 2;
+
+	if (layer == 1) {
+		*samples = 384;
+		return (12 * bitrate / *rate + padding) * 4;
+	}
+
+	*samples = (layer == 3 && !mpeg1) ? 576 : 1152;
+	return *samples / 8 * bitrate / *rate + padding;
+}
+
+void mad_stream_init(struct mad_stream *stream) {
+	memset(stream, 0, sizeof(*stream));
+	stub.count = 0;
+}
+
+void mad_stream_finish(struct mad_stream *stream) { }
+
+void mad_stream_buffer(struct mad_stream *stream, unsigned char const *buffer, unsigned long length) {
+	stream->buffer = stream->this_frame = stream->next_frame = buffer;
+	stream->bufend = buffer + length;
+}
+
+char const *mad_stream_errorstr(struct mad_stream const *stream) {
+	return errors[stream->error == MAD_ERROR_BUFLEN ? 1 : 2];
+}
+
+void mad_frame_init(struct mad_frame *frame) { }
+void mad_frame_finish(struct mad_frame *frame) { }
+
+int mad_frame_decode(struct mad_frame *frame, struct mad_stream *stream) {
+	const u8_t *ptr = stream->next_frame;
+	unsigned len = 0;
+
+	// like libmad, a header is only read with guard bytes behind it
+	while (ptr + MAD_BUFFER_GUARD <= stream->bufend && (len = header(ptr, &stub.samples, &stub.channels, &stub.rate)) == 0) ptr++;
+
+	if (!len) {
+		stream->next_frame = ptr;
+		stream->error = MAD_ERROR_BUFLEN;
+		return -1;
+	}
+
+	if (ptr != stream->next_frame) {
+		stream->next_frame = ptr;
+		stream->error = MAD_ERROR_LOSTSYNC;
+		return -1;
+	}
+
+	if (len + MAD_BUFFER_GUARD > (size_t) (stream->bufend - ptr)) {
+		stream->error = MAD_ERROR_BUFLEN;
+		return -1;
+	}
+
+	stream->this_frame = ptr;
+	stream->next_frame = ptr + len;
+	stream->error = MAD_ERROR_NONE;
+
+	return 0;
+}
+
+void mad_synth_init(struct mad_synth *synth) {
+	memset(&synth->pcm, 0, sizeof(synth->pcm));
+}
+
+void mad_synth_frame(struct mad_synth *synth, struct mad_frame const *frame) {
+	synth->pcm.samplerate = stub.rate;
+	synth->pcm.channels = stub.channels;
+	synth->pcm.length = stub.samples;
+
+	for (unsigned i = 0; i < stub.samples; i++, stub.count++) {
+		for (unsigned c = 0; c < stub.channels; c++) {
+			synth->pcm.samples[c][i] = (s16_t) (stub.count * 40503 + c * 9973) * (1 << (MAD_F_FRACBITS - 15));
+		}
+	}
+}
@@ -0,0 +1,58 @@
+/*
+ *  Squeezelite for esp32
+ *
+ *  (c) Philippe G. 2023, philippe_44@outlook.com
+ *
+ *  This software is released under the MIT License.
+ *  https://opensource.org/licenses/MIT
+ *
+ */
+
+/*
+ Stand-in for libresample16, which is only built for xtensa, so that resample16.c
+ and its polyphase path can run on a PC. Whatever the filter, it is a linear
+ interpolation, so bench numbers of the library's profiles are not theirs.
+*/
+
+#include <stdlib.h>
+#include <resample16.h>
+
+struct resample16_s {
+	double step, pos;		// input samples per output sample, position after last input
+	HWORD last[2];
+};
+
+struct resample16_s *resample16_create(float factor, resample16_filter_e filter, resample16_filter_t *custom, BOOL interp) {
+	struct resample16_s *r = calloc(1, sizeof(struct resample16_s));
+	if (r) r->step = 1 / factor;
+	return r;
+}
+
+void resample16_delete(struct resample16_s *r) {
+	free(r);
+}
+
+void resample16_flush(struct resample16_s *r) {
+	r->pos = 0;
+	r->last[0] = r->last[1] = 0;
+}
+
+WORD resample16(struct resample16_s *r, HWORD X[], int inCount, HWORD Y[]) {
+	WORD count = 0;
+
+	// pos is relative to X[0], the previous input being at -1
+	for (; r->pos < inCount - 1; r->pos += r->step, count++) {
+		int i = (int) (r->pos + 1) - 1;
+		double frac = r->pos - i;
+		for (int c = 0; c < 2; c++) {
+			double a = i < 0 ? r->last[c] : X[2*i + c], b = X[2*(i + 1) + c];
+			*Y++ = (HWORD) (a + (b - a) * frac);
+		}
+	}
+
+	r->pos -= inCount;
+	r->last[0] = X[2*(inCount - 1)];
+	r->last[1] = X[2*(inCount - 1) + 1];
+
+	return count;
+}